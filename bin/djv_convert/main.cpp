@@ -31,6 +31,7 @@
 
 #include <djvAV/AVSystem.h>
 #include <djvAV/IO.h>
+#include <djvAV/OCIO.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/Error.h>
@@ -96,6 +97,8 @@ namespace djv
                 }
                 AV::IO::WriteOptions writeOptions;
                 writeOptions.videoQueueSize = _writeQueueSize;
+                writeOptions.colorSpaceConvert = _colorSpace;
+                writeOptions.lut3DEdgeLen = _lut3DEdgeLen;
                 _write = io->write(writeFileInfo, info, writeOptions);
                 _write->setThreadCount(_writeThreadCount);
                 
@@ -183,6 +186,29 @@ namespace djv
                         i = args.erase(i);
                         _resize.reset(new AV::Image::Size(resize));
                     }
+                    else if ("-colorSpace" == *i)
+                    {
+                        i = args.erase(i);
+                        if (i != args.end())
+                        {
+                            _colorSpace.input = *i;
+                            i = args.erase(i);
+                        }
+                        if (i != args.end())
+                        {
+                            _colorSpace.output = *i;
+                            i = args.erase(i);
+                        }
+                    }
+                    else if ("-lut3D" == *i)
+                    {
+                        i = args.erase(i);
+                        int value = 0;
+                        std::stringstream ss(*i);
+                        ss >> value;
+                        i = args.erase(i);
+                        _lut3DEdgeLen = std::max(value, 0);
+                    }
                     else if ("-readSeq" == *i)
                     {
                         i = args.erase(i);
@@ -260,6 +286,12 @@ namespace djv
                 std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_resize")) << std::endl;
                 std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_resize_description")) << std::endl;
                 std::cout << std::endl;
+                std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_colorspace")) << std::endl;
+                std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_colorspace_description")) << std::endl;
+                std::cout << std::endl;
+                std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_lut3d")) << std::endl;
+                std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_lut3d_description")) << std::endl;
+                std::cout << std::endl;
                 std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_readseq")) << std::endl;
                 std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_option_readseq_description")) << std::endl;
                 std::cout << std::endl;
@@ -283,6 +315,8 @@ namespace djv
             std::string _input;
             std::string _output;
             std::unique_ptr<AV::Image::Size> _resize;
+            AV::OCIO::Convert _colorSpace;
+            size_t _lut3DEdgeLen = 0;
             bool _readSeq = false;
             bool _writeSeq = false;
             //! \todo What's a good default for this?
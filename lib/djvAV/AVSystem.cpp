@@ -36,6 +36,7 @@
 #include <djvAV/OCIOSystem.h>
 #include <djvAV/Render2D.h>
 #include <djvAV/ThumbnailSystem.h>
+#include <djvAV/WaveformSystem.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/Error.h>
@@ -58,7 +59,9 @@ namespace djv
             std::shared_ptr<ValueSubject<Time::FPS> > defaultSpeed;
             std::shared_ptr<ValueSubject<Render::ImageFilterOptions> > imageFilterOptions;
             std::shared_ptr<ValueSubject<bool> > lcdText;
+            std::shared_ptr<ValueSubject<size_t> > dynamicTextureCacheMax;
             std::shared_ptr<ThumbnailSystem> thumbnailSystem;
+            std::shared_ptr<WaveformSystem> waveformSystem;
             std::shared_ptr<Render::Render2D> render2D;
         };
 
@@ -78,7 +81,9 @@ namespace djv
             auto ioSystem = IO::System::create(context);
             auto fontSystem = Font::System::create(context);
             p.thumbnailSystem = ThumbnailSystem::create(context);
+            p.waveformSystem = WaveformSystem::create(context);
             p.render2D = Render::Render2D::create(context);
+            p.dynamicTextureCacheMax = ValueSubject<size_t>::create(p.render2D->getDynamicTextureCacheMax());
             auto audioSystem = Audio::System::create(context);
 
             addDependency(glfwSystem);
@@ -86,6 +91,7 @@ namespace djv
             addDependency(ioSystem);
             addDependency(fontSystem);
             addDependency(p.thumbnailSystem);
+            addDependency(p.waveformSystem);
             addDependency(p.render2D);
             addDependency(audioSystem);
         }
@@ -167,6 +173,20 @@ namespace djv
             }
         }
 
+        std::shared_ptr<IValueSubject<size_t> > AVSystem::observeDynamicTextureCacheMax() const
+        {
+            return _p->dynamicTextureCacheMax;
+        }
+
+        void AVSystem::setDynamicTextureCacheMax(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.dynamicTextureCacheMax->setIfChanged(value))
+            {
+                p.render2D->setDynamicTextureCacheMax(value);
+            }
+        }
+
         std::string AVSystem::getLabel(Frame::Number value, const Time::Speed& speed) const
         {
             DJV_PRIVATE_PTR();
@@ -75,6 +75,10 @@ namespace djv
             std::shared_ptr<Core::IValueSubject<bool> > observeLCDText() const;
             void setLCDText(bool);
 
+            //! Observe the maximum number of bytes used by dynamic textures.
+            std::shared_ptr<Core::IValueSubject<size_t> > observeDynamicTextureCacheMax() const;
+            void setDynamicTextureCacheMax(size_t);
+
             std::string getLabel(Core::Frame::Number, const Core::Time::Speed&) const;
 
         private:
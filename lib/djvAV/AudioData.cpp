@@ -27,15 +27,23 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //------------------------------------------------------------------------------
 
+
 #include <djvAV/AudioData.h>
 
+#include <atomic>
+
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DJV_AUDIO_SSE2
+#include <emmintrin.h>
+#endif // DJV_AUDIO_SSE2
+
 #define _CONVERT(a, b) \
     { \
-        const a##_T * inP = reinterpret_cast<const a##_T *>(data->getData()); \
-        b##_T * outP = reinterpret_cast<b##_T *>(out->getData()); \
-        for (size_t i = 0; i < sampleCount * channelCount; ++i, ++inP, ++outP) \
+        const a##_T * inP = reinterpret_cast<const a##_T *>(in); \
+        b##_T * outP = reinterpret_cast<b##_T *>(out); \
+        for (size_t i = 0; i < size; ++i, ++inP, ++outP) \
         { \
             a##To##b(*inP, *outP); \
         } \
@@ -58,6 +66,285 @@ namespace djv
     {
         namespace Audio
         {
+            namespace
+            {
+#if defined(DJV_AUDIO_SSE2)
+                std::atomic<bool> simdEnabled(true);
+#else // DJV_AUDIO_SSE2
+                std::atomic<bool> simdEnabled(false);
+#endif // DJV_AUDIO_SSE2
+
+            } // namespace
+
+            bool hasSIMD()
+            {
+#if defined(DJV_AUDIO_SSE2)
+                return true;
+#else // DJV_AUDIO_SSE2
+                return false;
+#endif // DJV_AUDIO_SSE2
+            }
+
+            bool isSIMDEnabled()
+            {
+                return simdEnabled;
+            }
+
+            void setSIMDEnabled(bool value)
+            {
+                simdEnabled = value && hasSIMD();
+            }
+
+#if defined(DJV_AUDIO_SSE2)
+            namespace
+            {
+                // The SSE2 versions produce the same results as the scalar
+                // conversion functions. The remaining samples that do not fill
+                // a vector are processed with the scalar functions.
+
+                inline __m128i _S16ToS32Lo(__m128i value)
+                {
+                    return _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+                }
+
+                inline __m128i _S16ToS32Hi(__m128i value)
+                {
+                    return _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16);
+                }
+
+                void _S16ToS32SSE2(const S16_T* in, S32_T* out, size_t size)
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(zero, v));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(zero, v));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        S16ToS32(in[i], out[i]);
+                    }
+                }
+
+                void _S16ToF32SSE2(const S16_T* in, F32_T* out, size_t size)
+                {
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(S16Range.max));
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        _mm_storeu_ps(out + i, _mm_div_ps(_mm_cvtepi32_ps(_S16ToS32Lo(v)), scale));
+                        _mm_storeu_ps(out + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_S16ToS32Hi(v)), scale));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        S16ToF32(in[i], out[i]);
+                    }
+                }
+
+                inline __m128i _S32ToS16(__m128i value)
+                {
+                    // Round towards zero like integer division.
+                    const __m128i bias = _mm_srli_epi32(_mm_srai_epi32(value, 31), 16);
+                    return _mm_srai_epi32(_mm_add_epi32(value, bias), 16);
+                }
+
+                void _S32ToS16SSE2(const S32_T* in, S16_T* out, size_t size)
+                {
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4));
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i*>(out + i),
+                            _mm_packs_epi32(_S32ToS16(v0), _S32ToS16(v1)));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        S32ToS16(in[i], out[i]);
+                    }
+                }
+
+                void _S32ToF32SSE2(const S32_T* in, F32_T* out, size_t size)
+                {
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(S32Range.max));
+                    size_t i = 0;
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        _mm_storeu_ps(out + i, _mm_div_ps(_mm_cvtepi32_ps(v), scale));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        S32ToF32(in[i], out[i]);
+                    }
+                }
+
+                void _F32ToS16SSE2(const F32_T* in, S16_T* out, size_t size)
+                {
+                    const __m128 scale = _mm_set1_ps(static_cast<float>(S16Range.max));
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        const __m128i v0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i), scale));
+                        const __m128i v1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(in + i + 4), scale));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(v0, v1));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        F32ToS16(in[i], out[i]);
+                    }
+                }
+
+                inline __m128i _F64ToS32(__m128d value, __m128d scale, __m128d min, __m128d max)
+                {
+                    return _mm_cvttpd_epi32(_mm_max_pd(_mm_min_pd(_mm_mul_pd(value, scale), max), min));
+                }
+
+                void _F32ToS32SSE2(const F32_T* in, S32_T* out, size_t size)
+                {
+                    // Convert through double precision since the S32 range does not
+                    // fit in a float.
+                    const __m128d scale = _mm_set1_pd(static_cast<double>(S32Range.max));
+                    const __m128d min = _mm_set1_pd(static_cast<double>(S32Range.min));
+                    const __m128d max = _mm_set1_pd(static_cast<double>(S32Range.max));
+                    size_t i = 0;
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        const __m128 v = _mm_loadu_ps(in + i);
+                        const __m128i lo = _F64ToS32(_mm_cvtps_pd(v), scale, min, max);
+                        const __m128i hi = _F64ToS32(_mm_cvtps_pd(_mm_movehl_ps(v, v)), scale, min, max);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi64(lo, hi));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        F32ToS32(in[i], out[i]);
+                    }
+                }
+
+                bool _convertSSE2(const uint8_t* in, Type inType, uint8_t* out, Type outType, size_t size)
+                {
+                    bool out_ = true;
+                    switch (inType)
+                    {
+                    case Type::S16:
+                        switch (outType)
+                        {
+                        case Type::S32: _S16ToS32SSE2(reinterpret_cast<const S16_T*>(in), reinterpret_cast<S32_T*>(out), size); break;
+                        case Type::F32: _S16ToF32SSE2(reinterpret_cast<const S16_T*>(in), reinterpret_cast<F32_T*>(out), size); break;
+                        default: out_ = false; break;
+                        }
+                        break;
+                    case Type::S32:
+                        switch (outType)
+                        {
+                        case Type::S16: _S32ToS16SSE2(reinterpret_cast<const S32_T*>(in), reinterpret_cast<S16_T*>(out), size); break;
+                        case Type::F32: _S32ToF32SSE2(reinterpret_cast<const S32_T*>(in), reinterpret_cast<F32_T*>(out), size); break;
+                        default: out_ = false; break;
+                        }
+                        break;
+                    case Type::F32:
+                        switch (outType)
+                        {
+                        case Type::S16: _F32ToS16SSE2(reinterpret_cast<const F32_T*>(in), reinterpret_cast<S16_T*>(out), size); break;
+                        case Type::S32: _F32ToS32SSE2(reinterpret_cast<const F32_T*>(in), reinterpret_cast<S32_T*>(out), size); break;
+                        default: out_ = false; break;
+                        }
+                        break;
+                    default: out_ = false; break;
+                    }
+                    return out_;
+                }
+
+                void _volumeS16SSE2(const S16_T* in, S16_T* out, float volume, size_t size)
+                {
+                    const __m128 v = _mm_set1_ps(volume);
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8)
+                    {
+                        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        const __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_S16ToS32Lo(s)), v));
+                        const __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_S16ToS32Hi(s)), v));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        out[i] = static_cast<S16_T>(in[i] * volume);
+                    }
+                }
+
+                void _volumeS32SSE2(const S32_T* in, S32_T* out, float volume, size_t size)
+                {
+                    const __m128 v = _mm_set1_ps(volume);
+                    size_t i = 0;
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i*>(out + i),
+                            _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(s), v)));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        out[i] = static_cast<S32_T>(in[i] * volume);
+                    }
+                }
+
+                void _volumeF32SSE2(const F32_T* in, F32_T* out, float volume, size_t size)
+                {
+                    const __m128 v = _mm_set1_ps(volume);
+                    size_t i = 0;
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(in + i), v));
+                    }
+                    for (; i < size; ++i)
+                    {
+                        out[i] = in[i] * volume;
+                    }
+                }
+
+                void _planarInterleaveS16SSE2(const S16_T* in0, const S16_T* in1, S16_T* out, size_t sampleCount)
+                {
+                    size_t i = 0;
+                    for (; i + 8 <= sampleCount; i += 8)
+                    {
+                        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + i));
+                        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_unpacklo_epi16(a, b));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 8), _mm_unpackhi_epi16(a, b));
+                    }
+                    for (; i < sampleCount; ++i)
+                    {
+                        out[i * 2] = in0[i];
+                        out[i * 2 + 1] = in1[i];
+                    }
+                }
+
+                template<typename T>
+                void _planarInterleave32SSE2(const T* in0, const T* in1, T* out, size_t sampleCount)
+                {
+                    size_t i = 0;
+                    for (; i + 4 <= sampleCount; i += 4)
+                    {
+                        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + i));
+                        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), _mm_unpacklo_epi32(a, b));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2 + 4), _mm_unpackhi_epi32(a, b));
+                    }
+                    for (; i < sampleCount; ++i)
+                    {
+                        out[i * 2] = in0[i];
+                        out[i * 2 + 1] = in1[i];
+                    }
+                }
+
+            } // namespace
+#endif // DJV_AUDIO_SSE2
+
             bool Info::operator == (const Info & other) const
             {
                 return
@@ -92,131 +379,160 @@ namespace djv
 
             std::shared_ptr<Data> Data::convert(const std::shared_ptr<Data> & data, Type type)
             {
-                const Type dataType = data->getType();
-                const size_t sampleCount = data->getSampleCount();
-                const size_t channelCount = static_cast<size_t>(data->getChannelCount());
-                auto out = Data::create(Info(channelCount, type, data->getSampleRate(), sampleCount));
-                if (dataType == type)
+                const Info& info = data->getInfo();
+                auto out = Data::create(Info(info.channelCount, type, info.sampleRate, info.sampleCount));
+                convert(data->getData(), info.type, out->getData(), type, info.sampleCount, info.channelCount);
+                return out;
+            }
+
+            void Data::convert(const uint8_t* in, Type inType, uint8_t* out, Type outType, size_t sampleCount, uint8_t channelCount)
+            {
+                const size_t size = sampleCount * static_cast<size_t>(channelCount);
+                if (inType == outType)
                 {
-                    memcpy(out->getData(), data->getData(), sampleCount * channelCount * Audio::getByteCount(type));
+                    if (in != out)
+                    {
+                        memcpy(out, in, size * Audio::getByteCount(inType));
+                    }
+                    return;
                 }
-                else
+#if defined(DJV_AUDIO_SSE2)
+                if (simdEnabled && _convertSSE2(in, inType, out, outType, size))
+                    return;
+#endif // DJV_AUDIO_SSE2
+                switch (inType)
                 {
-                    switch (dataType)
-                    {
-                        case Type::S8:
-                            switch (type)
-                            {
-                            case Type::S16: _CONVERT(S8, S16); break;
-                            case Type::S32: _CONVERT(S8, S32); break;
-                            case Type::F32: _CONVERT(S8, F32); break;
-                            case Type::F64: _CONVERT(S8, F64); break;
-                            default: break;
-                            }
-                            break;
-                        case Type::S16:
-                            switch (type)
-                            {
-                            case Type::S8:  _CONVERT(S16, S8);  break;
-                            case Type::S32: _CONVERT(S16, S32); break;
-                            case Type::F32: _CONVERT(S16, F32); break;
-                            case Type::F64: _CONVERT(S16, F64); break;
-                            default: break;
-                            }
-                            break;
-                        case Type::S32:
-                            switch (type)
-                            {
-                            case Type::S8:  _CONVERT(S32, S8);  break;
-                            case Type::S16: _CONVERT(S32, S16); break;
-                            case Type::F32: _CONVERT(S32, F32); break;
-                            case Type::F64: _CONVERT(S32, F64); break;
-                            default: break;
-                            }
-                            break;
-                        case Type::F32:
-                            switch (type)
-                            {
-                            case Type::S8:  _CONVERT(F32, S8);  break;
-                            case Type::S16: _CONVERT(F32, S16); break;
-                            case Type::S32: _CONVERT(F32, S32); break;
-                            case Type::F64: _CONVERT(F32, F64); break;
-                            default: break;
-                            }
-                            break;
-                        case Type::F64:
-                            switch (type)
-                            {
-                            case Type::S8:  _CONVERT(F64, S8);  break;
-                            case Type::S16: _CONVERT(F64, S16); break;
-                            case Type::S32: _CONVERT(F64, S32); break;
-                            case Type::F32: _CONVERT(F64, F32); break;
-                            default: break;
-                            }
-                            break;
+                    case Type::S8:
+                        switch (outType)
+                        {
+                        case Type::S16: _CONVERT(S8, S16); break;
+                        case Type::S32: _CONVERT(S8, S32); break;
+                        case Type::F32: _CONVERT(S8, F32); break;
+                        case Type::F64: _CONVERT(S8, F64); break;
                         default: break;
-                    }
+                        }
+                        break;
+                    case Type::S16:
+                        switch (outType)
+                        {
+                        case Type::S8:  _CONVERT(S16, S8);  break;
+                        case Type::S32: _CONVERT(S16, S32); break;
+                        case Type::F32: _CONVERT(S16, F32); break;
+                        case Type::F64: _CONVERT(S16, F64); break;
+                        default: break;
+                        }
+                        break;
+                    case Type::S32:
+                        switch (outType)
+                        {
+                        case Type::S8:  _CONVERT(S32, S8);  break;
+                        case Type::S16: _CONVERT(S32, S16); break;
+                        case Type::F32: _CONVERT(S32, F32); break;
+                        case Type::F64: _CONVERT(S32, F64); break;
+                        default: break;
+                        }
+                        break;
+                    case Type::F32:
+                        switch (outType)
+                        {
+                        case Type::S8:  _CONVERT(F32, S8);  break;
+                        case Type::S16: _CONVERT(F32, S16); break;
+                        case Type::S32: _CONVERT(F32, S32); break;
+                        case Type::F64: _CONVERT(F32, F64); break;
+                        default: break;
+                        }
+                        break;
+                    case Type::F64:
+                        switch (outType)
+                        {
+                        case Type::S8:  _CONVERT(F64, S8);  break;
+                        case Type::S16: _CONVERT(F64, S16); break;
+                        case Type::S32: _CONVERT(F64, S32); break;
+                        case Type::F32: _CONVERT(F64, F32); break;
+                        default: break;
+                        }
+                        break;
+                    default: break;
                 }
-                return out;
             }
 
             namespace
             {
-                template<typename U>
-                void _planarInterleave(const U * value, U * out, size_t channelCount, size_t size)
+                template<typename T>
+                void _planarInterleave(const uint8_t* value, uint8_t* out, uint8_t channelCount, size_t sampleCount)
                 {
-                    const size_t planeSize = size / channelCount;
-                    for (size_t c = 0; c < channelCount; ++c)
+                    std::vector<const T*> planes(channelCount);
+                    for (uint8_t c = 0; c < channelCount; ++c)
                     {
-                        const U * inP = value + c * planeSize;
-                        const U * endP = inP + planeSize;
-                        U * outP = out + c;
-                        for (; inP < endP; ++inP, outP += channelCount)
-                        {
-                            *outP = *inP;
-                        }
+                        planes[c] = reinterpret_cast<const T*>(value) + c * sampleCount;
                     }
+                    Data::planarInterleave(planes.data(), reinterpret_cast<T*>(out), sampleCount, channelCount);
                 }
             }
 
             std::shared_ptr<Data> Data::planarInterleave(const std::shared_ptr<Data> & data)
             {
                 auto out = Data::create(data->getInfo());
-                const size_t channelCount = data->getChannelCount();
+                const uint8_t channelCount = data->getChannelCount();
                 const size_t sampleCount = data->getSampleCount();
                 switch (data->getType())
                 {
-                case Type::S8:
-                    _planarInterleave(reinterpret_cast<const S8_T *> (data->getData()), reinterpret_cast<S8_T *> (out->getData()), channelCount, sampleCount);
-                    break;
-                case Type::S16:
-                    _planarInterleave(reinterpret_cast<const S16_T *>(data->getData()), reinterpret_cast<S16_T *>(out->getData()), channelCount, sampleCount);
-                    break;
-                case Type::S32:
-                    _planarInterleave(reinterpret_cast<const S32_T *>(data->getData()), reinterpret_cast<S32_T *>(out->getData()), channelCount, sampleCount);
-                    break;
-                case Type::F32:
-                    _planarInterleave(reinterpret_cast<const F32_T *>(data->getData()), reinterpret_cast<F32_T *>(out->getData()), channelCount, sampleCount);
-                    break;
-                case Type::F64:
-                    _planarInterleave(reinterpret_cast<const F64_T *>(data->getData()), reinterpret_cast<F64_T *>(out->getData()), channelCount, sampleCount);
-                    break;
+                case Type::S8:  _planarInterleave<S8_T> (data->getData(), out->getData(), channelCount, sampleCount); break;
+                case Type::S16: _planarInterleave<S16_T>(data->getData(), out->getData(), channelCount, sampleCount); break;
+                case Type::S32: _planarInterleave<S32_T>(data->getData(), out->getData(), channelCount, sampleCount); break;
+                case Type::F32: _planarInterleave<F32_T>(data->getData(), out->getData(), channelCount, sampleCount); break;
+                case Type::F64: _planarInterleave<F64_T>(data->getData(), out->getData(), channelCount, sampleCount); break;
                 default: break;
                 }
                 return out;
             }
 
+            void Data::planarInterleave(const S16_T** value, S16_T* out, size_t sampleCount, uint8_t channelCount)
+            {
+#if defined(DJV_AUDIO_SSE2)
+                if (simdEnabled && 2 == channelCount)
+                {
+                    _planarInterleaveS16SSE2(value[0], value[1], out, sampleCount);
+                    return;
+                }
+#endif // DJV_AUDIO_SSE2
+                planarInterleave<S16_T>(value, out, sampleCount, channelCount);
+            }
+
+            void Data::planarInterleave(const S32_T** value, S32_T* out, size_t sampleCount, uint8_t channelCount)
+            {
+#if defined(DJV_AUDIO_SSE2)
+                if (simdEnabled && 2 == channelCount)
+                {
+                    _planarInterleave32SSE2(value[0], value[1], out, sampleCount);
+                    return;
+                }
+#endif // DJV_AUDIO_SSE2
+                planarInterleave<S32_T>(value, out, sampleCount, channelCount);
+            }
+
+            void Data::planarInterleave(const F32_T** value, F32_T* out, size_t sampleCount, uint8_t channelCount)
+            {
+#if defined(DJV_AUDIO_SSE2)
+                if (simdEnabled && 2 == channelCount)
+                {
+                    _planarInterleave32SSE2(value[0], value[1], out, sampleCount);
+                    return;
+                }
+#endif // DJV_AUDIO_SSE2
+                planarInterleave<F32_T>(value, out, sampleCount, channelCount);
+            }
+
             namespace
             {
                 template<typename T>
-                void _planarDeinterleave(const T* value, T* out, uint8_t channelCount, size_t size)
+                void _planarDeinterleave(const T* value, T* out, uint8_t channelCount, size_t sampleCount)
                 {
-                    const size_t planeSize = size / channelCount;
                     for (uint8_t c = 0; c < channelCount; ++c)
                     {
                         const T* inP = value + c;
-                        T* outP = out + c * planeSize;
-                        for (size_t i = 0; i < planeSize; ++i, inP += channelCount, ++outP)
+                        T* outP = out + c * sampleCount;
+                        for (size_t i = 0; i < sampleCount; ++i, inP += channelCount, ++outP)
                         {
                             *outP = *inP;
                         }
@@ -253,6 +569,19 @@ namespace djv
 
             void Data::volume(const uint8_t* in, uint8_t* out, float volume, size_t sampleCount, uint8_t channelCount, Type type)
             {
+#if defined(DJV_AUDIO_SSE2)
+                if (simdEnabled)
+                {
+                    const size_t size = sampleCount * static_cast<size_t>(channelCount);
+                    switch (type)
+                    {
+                    case Type::S16: _volumeS16SSE2(reinterpret_cast<const S16_T*>(in), reinterpret_cast<S16_T*>(out), volume, size); return;
+                    case Type::S32: _volumeS32SSE2(reinterpret_cast<const S32_T*>(in), reinterpret_cast<S32_T*>(out), volume, size); return;
+                    case Type::F32: _volumeF32SSE2(reinterpret_cast<const F32_T*>(in), reinterpret_cast<F32_T*>(out), volume, size); return;
+                    default: break;
+                    }
+                }
+#endif // DJV_AUDIO_SSE2
                 switch (type)
                 {
                 case Type::S8:  _VOLUME(S8);  break;
@@ -62,6 +62,18 @@ namespace djv
                 bool operator != (const Info&) const;
             };
 
+            //! Get whether SIMD versions of the audio data functions are
+            //! available.
+            bool hasSIMD();
+
+            //! Get whether the SIMD versions are enabled.
+            bool isSIMDEnabled();
+
+            //! Set whether the SIMD versions are enabled. They are enabled by
+            //! default when available, this is used for testing and
+            //! benchmarking against the scalar versions.
+            void setSIMDEnabled(bool);
+
             //! This struct provides audio data.
             class Data
             {
@@ -91,14 +103,23 @@ namespace djv
 
                 static std::shared_ptr<Data> convert(const std::shared_ptr<Data>&, Type);
 
+                //! Convert samples without allocating. The input and output may
+                //! be the same memory when the types have the same size.
+                static void convert(const uint8_t*, Type, uint8_t*, Type, size_t sampleCount, uint8_t channelCount);
+
                 template<typename T>
                 static void extract(const T*, T*, size_t sampleCount, uint8_t inChannelCount, uint8_t outChannelCount);
 
                 static std::shared_ptr<Data> planarInterleave(const std::shared_ptr<Data>&);
                 template<typename T>
                 static void planarInterleave(const T**, T*, size_t sampleCount, uint8_t channelCount);
+                static void planarInterleave(const S16_T**, S16_T*, size_t sampleCount, uint8_t channelCount);
+                static void planarInterleave(const S32_T**, S32_T*, size_t sampleCount, uint8_t channelCount);
+                static void planarInterleave(const F32_T**, F32_T*, size_t sampleCount, uint8_t channelCount);
                 static std::shared_ptr<Data> planarDeinterleave(const std::shared_ptr<Data>&);
 
+                //! Scale the samples by the volume. The input and output may be
+                //! the same memory.
                 static void volume(const uint8_t*, uint8_t*, float volume, size_t sampleCount, uint8_t channelCount, Type);
 
                 bool operator == (const Data&) const;
@@ -0,0 +1,422 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/AudioResampler.h>
+
+#include <djvCore/Math.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Audio
+        {
+            namespace
+            {
+                //! \todo Should these be configurable?
+                const size_t filterHalfWidth = 16;
+                const size_t filterTaps = filterHalfWidth * 2;
+                const size_t filterPhases = 128;
+                const size_t stretchFrameSize = 2048;
+                const size_t stretchHop = stretchFrameSize / 2;
+                const size_t stretchSearch = 512;
+                const size_t stretchCorrelationStride = 4;
+
+                double blackman(double x)
+                {
+                    return fabs(x) <= 1.0 ?
+                        (.42 + .5 * cos(Math::pi * x) + .08 * cos(2.0 * Math::pi * x)) :
+                        0.0;
+                }
+
+                float dot(const float* a, const float* b, size_t size)
+                {
+                    // Use separate sums so the compiler can vectorize the loop.
+                    float sum0 = 0.F;
+                    float sum1 = 0.F;
+                    float sum2 = 0.F;
+                    float sum3 = 0.F;
+                    size_t i = 0;
+                    for (; i + 4 <= size; i += 4)
+                    {
+                        sum0 += a[i] * b[i];
+                        sum1 += a[i + 1] * b[i + 1];
+                        sum2 += a[i + 2] * b[i + 2];
+                        sum3 += a[i + 3] * b[i + 3];
+                    }
+                    for (; i < size; ++i)
+                    {
+                        sum0 += a[i] * b[i];
+                    }
+                    return (sum0 + sum1) + (sum2 + sum3);
+                }
+
+            } // namespace
+
+            struct Resampler::Private
+            {
+                uint8_t channelCount = 0;
+                Type type = Type::None;
+                double speed = 1.0;
+                bool preservePitch = false;
+
+                // The input samples are stored de-interleaved.
+                std::vector<std::vector<float> > input;
+                std::vector<float> inputConvert;
+                std::vector<float> output;
+
+                double filterCutoff = 0.0;
+                std::vector<float> filter;
+                double filterPos = 0.0;
+
+                std::vector<float> stretchWindow;
+                std::vector<std::vector<float> > stretchOverlap;
+                double stretchPos = 0.0;
+                size_t stretchNext = 0;
+                bool stretchFirst = true;
+
+                void updateFilter();
+                void varispeed(std::vector<float>&);
+                size_t stretchSeek(size_t pos) const;
+                void stretch(std::vector<float>&);
+                void erase(size_t);
+            };
+
+            void Resampler::_init(uint8_t channelCount, Type type)
+            {
+                DJV_PRIVATE_PTR();
+                p.channelCount = channelCount;
+                p.type = type;
+                p.input.resize(channelCount);
+                p.stretchWindow.resize(stretchFrameSize);
+                for (size_t i = 0; i < stretchFrameSize; ++i)
+                {
+                    p.stretchWindow[i] = static_cast<float>(.5 - .5 * cos(2.0 * Math::pi * i / static_cast<double>(stretchFrameSize)));
+                }
+                p.stretchOverlap.resize(channelCount);
+                p.updateFilter();
+                reset();
+            }
+
+            Resampler::Resampler() :
+                _p(new Private)
+            {}
+
+            Resampler::~Resampler()
+            {}
+
+            std::shared_ptr<Resampler> Resampler::create(uint8_t channelCount, Type type)
+            {
+                auto out = std::shared_ptr<Resampler>(new Resampler);
+                out->_init(channelCount, type);
+                return out;
+            }
+
+            uint8_t Resampler::getChannelCount() const
+            {
+                return _p->channelCount;
+            }
+
+            Type Resampler::getType() const
+            {
+                return _p->type;
+            }
+
+            double Resampler::getSpeed() const
+            {
+                return _p->speed;
+            }
+
+            void Resampler::setSpeed(double value)
+            {
+                DJV_PRIVATE_PTR();
+                const double speed = Math::clamp(value, resamplerSpeedMin, resamplerSpeedMax);
+                if (speed == p.speed)
+                    return;
+                p.speed = speed;
+                p.updateFilter();
+            }
+
+            bool Resampler::hasPreservePitch() const
+            {
+                return _p->preservePitch;
+            }
+
+            void Resampler::setPreservePitch(bool value)
+            {
+                DJV_PRIVATE_PTR();
+                if (value == p.preservePitch)
+                    return;
+                p.preservePitch = value;
+                reset();
+            }
+
+            std::shared_ptr<Data> Resampler::process(const std::shared_ptr<Data>& data)
+            {
+                DJV_PRIVATE_PTR();
+                const size_t channelCount = static_cast<size_t>(p.channelCount);
+
+                // Append the input samples to the history.
+                const size_t sampleCount = data->getSampleCount();
+                p.inputConvert.resize(sampleCount * channelCount);
+                Data::convert(
+                    data->getData(),
+                    data->getType(),
+                    reinterpret_cast<uint8_t*>(p.inputConvert.data()),
+                    Type::F32,
+                    sampleCount,
+                    p.channelCount);
+                const F32_T* inP = p.inputConvert.data();
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    auto& input = p.input[c];
+                    const size_t size = input.size();
+                    input.resize(size + sampleCount);
+                    for (size_t i = 0; i < sampleCount; ++i)
+                    {
+                        input[size + i] = inP[i * channelCount + c];
+                    }
+                }
+
+                p.output.clear();
+                if (p.preservePitch)
+                {
+                    p.stretch(p.output);
+                }
+                else
+                {
+                    p.varispeed(p.output);
+                }
+
+                const size_t outputSampleCount = p.output.size() / channelCount;
+                auto out = Data::create(Info(p.channelCount, p.type, data->getSampleRate(), outputSampleCount));
+                Data::convert(
+                    reinterpret_cast<const uint8_t*>(p.output.data()),
+                    Type::F32,
+                    out->getData(),
+                    p.type,
+                    outputSampleCount,
+                    p.channelCount);
+                return out;
+            }
+
+            void Resampler::reset()
+            {
+                DJV_PRIVATE_PTR();
+
+                // Start with silence so the first samples have a full history.
+                const size_t pad = p.preservePitch ? stretchSearch : (filterHalfWidth - 1);
+                for (auto& i : p.input)
+                {
+                    i.assign(pad, 0.F);
+                }
+                p.filterPos = static_cast<double>(pad);
+                for (auto& i : p.stretchOverlap)
+                {
+                    i.assign(stretchFrameSize, 0.F);
+                }
+                p.stretchPos = static_cast<double>(pad);
+                p.stretchNext = 0;
+                p.stretchFirst = true;
+            }
+
+            void Resampler::Private::updateFilter()
+            {
+                // Lower the cutoff when speeding up to avoid aliasing.
+                const double cutoff = std::min(1.0, 1.0 / speed);
+                if (cutoff == filterCutoff)
+                    return;
+                filterCutoff = cutoff;
+
+                // Build a table of filter coefficients for each fractional
+                // sample position. An extra row allows interpolating the last
+                // phase.
+                filter.resize((filterPhases + 1) * filterTaps);
+                for (size_t phase = 0; phase <= filterPhases; ++phase)
+                {
+                    const double frac = phase / static_cast<double>(filterPhases);
+                    float* row = filter.data() + phase * filterTaps;
+                    double sum = 0.0;
+                    for (size_t i = 0; i < filterTaps; ++i)
+                    {
+                        const double x = static_cast<double>(i) - static_cast<double>(filterHalfWidth - 1) - frac;
+                        const double sinc = x != 0.0 ? (sin(Math::pi * cutoff * x) / (Math::pi * cutoff * x)) : 1.0;
+                        const double v = cutoff * sinc * blackman(x / static_cast<double>(filterHalfWidth));
+                        row[i] = static_cast<float>(v);
+                        sum += v;
+                    }
+                    // Normalize for unity gain.
+                    if (sum != 0.0)
+                    {
+                        for (size_t i = 0; i < filterTaps; ++i)
+                        {
+                            row[i] = static_cast<float>(row[i] / sum);
+                        }
+                    }
+                }
+            }
+
+            void Resampler::Private::varispeed(std::vector<float>& out)
+            {
+                const size_t size = input.size() ? input[0].size() : 0;
+                float coeffs[filterTaps];
+                while (true)
+                {
+                    const size_t i = static_cast<size_t>(filterPos);
+                    if (i + filterHalfWidth >= size)
+                        break;
+
+                    // Interpolate the coefficients between the nearest phases.
+                    const double phase = (filterPos - i) * filterPhases;
+                    const size_t phase0 = std::min(static_cast<size_t>(phase), filterPhases - 1);
+                    const float t = static_cast<float>(phase - phase0);
+                    const float* row0 = filter.data() + phase0 * filterTaps;
+                    const float* row1 = row0 + filterTaps;
+                    for (size_t j = 0; j < filterTaps; ++j)
+                    {
+                        coeffs[j] = row0[j] + (row1[j] - row0[j]) * t;
+                    }
+
+                    const size_t start = i - (filterHalfWidth - 1);
+                    for (const auto& c : input)
+                    {
+                        out.push_back(dot(c.data() + start, coeffs, filterTaps));
+                    }
+                    filterPos += speed;
+                }
+
+                // Remove the samples that are no longer needed.
+                const size_t count = std::min(static_cast<size_t>(filterPos) - (filterHalfWidth - 1), size);
+                erase(count);
+                filterPos -= count;
+            }
+
+            size_t Resampler::Private::stretchSeek(size_t pos) const
+            {
+                // Search around the position for the segment that best matches
+                // the natural continuation of the previous segment.
+                size_t out = pos;
+                double max = -1.0;
+                for (size_t i = pos - stretchSearch; i <= pos + stretchSearch; ++i)
+                {
+                    double correlation = 0.0;
+                    double energy = 0.0;
+                    for (const auto& c : input)
+                    {
+                        const float* a = c.data() + stretchNext;
+                        const float* b = c.data() + i;
+                        for (size_t j = 0; j < stretchFrameSize - stretchHop; j += stretchCorrelationStride)
+                        {
+                            correlation += a[j] * b[j];
+                            energy += b[j] * b[j];
+                        }
+                    }
+                    const double v = energy > 0.0 ? (correlation / sqrt(energy)) : 0.0;
+                    if (v > max)
+                    {
+                        max = v;
+                        out = i;
+                    }
+                }
+                return out;
+            }
+
+            void Resampler::Private::stretch(std::vector<float>& out)
+            {
+                const size_t size = input.size() ? input[0].size() : 0;
+                const size_t channelCount = input.size();
+                while (true)
+                {
+                    const size_t pos = static_cast<size_t>(stretchPos);
+                    if (pos + stretchSearch + stretchFrameSize > size)
+                        break;
+
+                    // Overlap and add the windowed segment.
+                    const size_t start = stretchFirst ? pos : stretchSeek(pos);
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        const float* inP = input[c].data() + start;
+                        float* overlapP = stretchOverlap[c].data();
+                        for (size_t i = 0; i < stretchFrameSize; ++i)
+                        {
+                            overlapP[i] += inP[i] * stretchWindow[i];
+                        }
+                    }
+
+                    // Output the finished samples.
+                    for (size_t i = 0; i < stretchHop; ++i)
+                    {
+                        for (size_t c = 0; c < channelCount; ++c)
+                        {
+                            out.push_back(stretchOverlap[c][i]);
+                        }
+                    }
+                    for (auto& c : stretchOverlap)
+                    {
+                        std::copy(c.begin() + stretchHop, c.end(), c.begin());
+                        std::fill(c.end() - stretchHop, c.end(), 0.F);
+                    }
+
+                    stretchNext = start + stretchHop;
+                    stretchFirst = false;
+                    stretchPos += stretchHop * speed;
+                }
+
+                // Remove the samples that are no longer needed.
+                size_t count = static_cast<size_t>(stretchPos) - stretchSearch;
+                if (!stretchFirst)
+                {
+                    count = std::min(count, stretchNext);
+                }
+                count = std::min(count, size);
+                erase(count);
+                stretchPos -= count;
+                stretchNext -= std::min(count, stretchNext);
+            }
+
+            void Resampler::Private::erase(size_t count)
+            {
+                if (count > 0)
+                {
+                    for (auto& i : input)
+                    {
+                        i.erase(i.begin(), i.begin() + count);
+                    }
+                }
+            }
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
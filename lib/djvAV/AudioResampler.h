@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/AudioData.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Audio
+        {
+            //! This constant provides the minimum resampler speed.
+            const double resamplerSpeedMin = .25;
+
+            //! This constant provides the maximum resampler speed.
+            const double resamplerSpeedMax = 4.0;
+
+            //! This class provides a streaming resampler for playing audio at a
+            //! different speed. By default the audio is resampled with a
+            //! windowed sinc filter (varispeed), which changes the pitch along
+            //! with the speed. When the pitch is preserved the audio is time
+            //! stretched by overlapping and adding similar segments instead.
+            class Resampler
+            {
+                DJV_NON_COPYABLE(Resampler);
+
+            protected:
+                void _init(uint8_t channelCount, Type);
+                Resampler();
+
+            public:
+                ~Resampler();
+
+                static std::shared_ptr<Resampler> create(uint8_t channelCount, Type);
+
+                uint8_t getChannelCount() const;
+                Type getType() const;
+
+                //! Get the speed, the number of input samples consumed for each
+                //! output sample.
+                double getSpeed() const;
+
+                //! Set the speed. The value is clamped to the range
+                //! resamplerSpeedMin to resamplerSpeedMax.
+                void setSpeed(double);
+
+                bool hasPreservePitch() const;
+                void setPreservePitch(bool);
+
+                //! Process the input samples and return the output samples. The
+                //! output may be shorter than expected while the filter history
+                //! is filled.
+                std::shared_ptr<Data> process(const std::shared_ptr<Data>&);
+
+                //! Clear the filter history, for example after seeking.
+                void reset();
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/AudioRingBuffer.h>
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Audio
+        {
+            void RingBuffer::_init(uint8_t channelCount, Type type, size_t sampleCount)
+            {
+                _channelCount = channelCount;
+                _type = type;
+                _sampleByteCount = channelCount * getByteCount(type);
+                _size = sampleCount;
+                _data.resize(_size * _sampleByteCount);
+            }
+
+            RingBuffer::RingBuffer() :
+                _readPos(0),
+                _writePos(0)
+            {}
+
+            std::shared_ptr<RingBuffer> RingBuffer::create(uint8_t channelCount, Type type, size_t sampleCount)
+            {
+                auto out = std::shared_ptr<RingBuffer>(new RingBuffer);
+                out->_init(channelCount, type, sampleCount);
+                return out;
+            }
+
+            size_t RingBuffer::write(const uint8_t* data, size_t sampleCount)
+            {
+                // The positions only increase, the offsets into the buffer are
+                // the positions modulo the size.
+                const size_t writePos = _writePos.load(std::memory_order_relaxed);
+                const size_t readPos = _readPos.load(std::memory_order_acquire);
+                const size_t count = std::min(sampleCount, _size - (writePos - readPos));
+                if (count > 0)
+                {
+                    const size_t offset = writePos % _size;
+                    const size_t count0 = std::min(count, _size - offset);
+                    memcpy(_data.data() + offset * _sampleByteCount, data, count0 * _sampleByteCount);
+                    memcpy(_data.data(), data + count0 * _sampleByteCount, (count - count0) * _sampleByteCount);
+                    _writePos.store(writePos + count, std::memory_order_release);
+                }
+                return count;
+            }
+
+            size_t RingBuffer::read(uint8_t* data, size_t sampleCount, float volume)
+            {
+                const size_t readPos = _readPos.load(std::memory_order_relaxed);
+                const size_t writePos = _writePos.load(std::memory_order_acquire);
+                const size_t count = std::min(sampleCount, writePos - readPos);
+                if (count > 0)
+                {
+                    const size_t offset = readPos % _size;
+                    const size_t count0 = std::min(count, _size - offset);
+                    Data::volume(_data.data() + offset * _sampleByteCount, data, volume, count0, _channelCount, _type);
+                    Data::volume(_data.data(), data + count0 * _sampleByteCount, volume, count - count0, _channelCount, _type);
+                    _readPos.store(readPos + count, std::memory_order_release);
+                }
+                return count;
+            }
+
+            void RingBuffer::clear()
+            {
+                _readPos.store(0);
+                _writePos.store(0);
+            }
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/AudioData.h>
+
+#include <atomic>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Audio
+        {
+            //! This class provides a lock-free ring buffer of audio samples for
+            //! one producer thread and one consumer thread. The storage is
+            //! allocated up front, so the consumer can be a real-time audio
+            //! callback that does not lock or allocate.
+            class RingBuffer
+            {
+                DJV_NON_COPYABLE(RingBuffer);
+
+            protected:
+                void _init(uint8_t channelCount, Type, size_t sampleCount);
+                RingBuffer();
+
+            public:
+                static std::shared_ptr<RingBuffer> create(uint8_t channelCount, Type, size_t sampleCount);
+
+                uint8_t getChannelCount() const;
+                Type getType() const;
+
+                //! Get the maximum number of samples in the buffer.
+                size_t getSize() const;
+
+                //! Get the number of samples that can be read.
+                size_t getReadAvailable() const;
+
+                //! Get the number of samples that can be written.
+                size_t getWriteAvailable() const;
+
+                //! Write samples and return the number written. This should only
+                //! be called from the producer thread.
+                size_t write(const uint8_t*, size_t sampleCount);
+
+                //! Read samples, scaled by the volume, and return the number read.
+                //! This should only be called from the consumer thread.
+                size_t read(uint8_t*, size_t sampleCount, float volume = 1.F);
+
+                //! Remove all of the samples. Neither thread may be using the
+                //! buffer.
+                void clear();
+
+            private:
+                uint8_t _channelCount = 0;
+                Type _type = Type::None;
+                size_t _sampleByteCount = 0;
+                std::vector<uint8_t> _data;
+                size_t _size = 0;
+                std::atomic<size_t> _readPos;
+                std::atomic<size_t> _writePos;
+            };
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
+
+#include <djvAV/AudioRingBufferInline.h>
@@ -0,0 +1,363 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/AudioWaveform.h>
+
+#include <djvCore/FileIO.h>
+#include <djvCore/FileSystem.h>
+#include <djvCore/Math.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Audio
+        {
+            namespace
+            {
+                const char     fileMagic[]  = "djvW";
+                const uint32_t fileVersion  = 1;
+
+                //! Merge bins that cover the same number of samples.
+                void merge(const Waveform::Bin& in, size_t index, Waveform::Bin& out, float& squares)
+                {
+                    if (0 == index)
+                    {
+                        out.min = in.min;
+                        out.max = in.max;
+                    }
+                    else
+                    {
+                        out.min = std::min(out.min, in.min);
+                        out.max = std::max(out.max, in.max);
+                    }
+                    squares += in.rms * in.rms;
+                }
+
+            } // namespace
+
+            bool Waveform::Bin::operator == (const Bin& other) const
+            {
+                return min == other.min && max == other.max && rms == other.rms;
+            }
+
+            struct Waveform::Private
+            {
+                uint8_t channelCount = 0;
+                size_t sampleRate = 0;
+                size_t binSampleCount = 0;
+                size_t sampleCount = 0;
+                std::vector<std::vector<std::vector<Bin> > > levels;
+                std::vector<Bin> bin;
+                std::vector<double> binSquares;
+                size_t binCount = 0;
+                std::vector<F32_T> convert;
+            };
+
+            void Waveform::_init(uint8_t channelCount, size_t sampleRate, size_t binSampleCount)
+            {
+                DJV_PRIVATE_PTR();
+                p.channelCount = channelCount;
+                p.sampleRate = sampleRate;
+                p.binSampleCount = std::max(binSampleCount, static_cast<size_t>(1));
+                p.levels.resize(channelCount);
+                for (auto& i : p.levels)
+                {
+                    i.resize(1);
+                }
+                p.bin.resize(channelCount);
+                p.binSquares.resize(channelCount);
+            }
+
+            Waveform::Waveform() :
+                _p(new Private)
+            {}
+
+            Waveform::~Waveform()
+            {}
+
+            std::shared_ptr<Waveform> Waveform::create(uint8_t channelCount, size_t sampleRate, size_t binSampleCount)
+            {
+                auto out = std::shared_ptr<Waveform>(new Waveform);
+                out->_init(channelCount, sampleRate, binSampleCount);
+                return out;
+            }
+
+            uint8_t Waveform::getChannelCount() const
+            {
+                return _p->channelCount;
+            }
+
+            size_t Waveform::getSampleRate() const
+            {
+                return _p->sampleRate;
+            }
+
+            size_t Waveform::getBinSampleCount() const
+            {
+                return _p->binSampleCount;
+            }
+
+            size_t Waveform::getSampleCount() const
+            {
+                return _p->sampleCount;
+            }
+
+            size_t Waveform::getLevelCount() const
+            {
+                DJV_PRIVATE_PTR();
+                return p.levels.size() ? p.levels[0].size() : 0;
+            }
+
+            size_t Waveform::getByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = 0;
+                for (const auto& channel : p.levels)
+                {
+                    for (const auto& level : channel)
+                    {
+                        out += level.size() * sizeof(Bin);
+                    }
+                }
+                return out;
+            }
+
+            const std::vector<Waveform::Bin>& Waveform::getLevel(uint8_t channel, size_t level) const
+            {
+                return _p->levels[channel][level];
+            }
+
+            void Waveform::add(const std::shared_ptr<Data>& data)
+            {
+                DJV_PRIVATE_PTR();
+                const uint8_t channelCount = data->getChannelCount();
+                const size_t sampleCount = data->getSampleCount();
+                if (!p.channelCount || !channelCount || !sampleCount)
+                    return;
+
+                p.convert.resize(sampleCount * channelCount);
+                Data::convert(
+                    data->getData(),
+                    data->getType(),
+                    reinterpret_cast<uint8_t*>(p.convert.data()),
+                    Type::F32,
+                    sampleCount,
+                    channelCount);
+
+                const uint8_t count = std::min(channelCount, p.channelCount);
+                const F32_T* in = p.convert.data();
+                for (size_t i = 0; i < sampleCount; ++i, in += channelCount)
+                {
+                    for (uint8_t c = 0; c < count; ++c)
+                    {
+                        const F32_T v = in[c];
+                        auto& bin = p.bin[c];
+                        if (0 == p.binCount)
+                        {
+                            bin.min = v;
+                            bin.max = v;
+                        }
+                        else
+                        {
+                            bin.min = std::min(bin.min, v);
+                            bin.max = std::max(bin.max, v);
+                        }
+                        p.binSquares[c] += v * v;
+                    }
+                    ++p.binCount;
+                    if (p.binCount == p.binSampleCount)
+                    {
+                        _addBin();
+                    }
+                }
+                p.sampleCount += sampleCount;
+            }
+
+            void Waveform::finish()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.binCount > 0)
+                {
+                    _addBin();
+                }
+                for (auto& channel : p.levels)
+                {
+                    channel.resize(1);
+                    while (channel.back().size() > 1)
+                    {
+                        const auto& in = channel.back();
+                        std::vector<Bin> out((in.size() + 1) / 2);
+                        for (size_t i = 0; i < out.size(); ++i)
+                        {
+                            const size_t j = i * 2;
+                            const size_t count = std::min(in.size() - j, static_cast<size_t>(2));
+                            float squares = 0.F;
+                            for (size_t k = 0; k < count; ++k)
+                            {
+                                merge(in[j + k], k, out[i], squares);
+                            }
+                            out[i].rms = sqrtf(squares / count);
+                        }
+                        channel.push_back(std::move(out));
+                    }
+                }
+            }
+
+            std::vector<Waveform::Bin> Waveform::getBins(uint8_t channel, size_t start, size_t end, size_t count) const
+            {
+                DJV_PRIVATE_PTR();
+                std::vector<Bin> out(count);
+                if (channel >= p.channelCount || end <= start || 0 == count)
+                    return out;
+
+                // Use the coarsest level whose bins are not larger than the
+                // requested bins, so each requested bin only merges a few bins.
+                const auto& levels = p.levels[channel];
+                const double samplesPerBin = (end - start) / static_cast<double>(count);
+                size_t level = 0;
+                while (level + 1 < levels.size() &&
+                    static_cast<double>(p.binSampleCount << (level + 1)) <= samplesPerBin)
+                {
+                    ++level;
+                }
+                const auto& bins = levels[level];
+                if (bins.empty())
+                    return out;
+                const double levelSampleCount = static_cast<double>(p.binSampleCount << level);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const double s0 = start + i * samplesPerBin;
+                    const double s1 = start + (i + 1) * samplesPerBin;
+                    const size_t b0 = static_cast<size_t>(s0 / levelSampleCount);
+                    if (b0 >= bins.size())
+                        break;
+                    const size_t b1 = Math::clamp(
+                        static_cast<size_t>(ceil(s1 / levelSampleCount)),
+                        b0 + 1,
+                        bins.size());
+                    float squares = 0.F;
+                    for (size_t j = b0; j < b1; ++j)
+                    {
+                        merge(bins[j], j - b0, out[i], squares);
+                    }
+                    out[i].rms = sqrtf(squares / (b1 - b0));
+                }
+                return out;
+            }
+
+            void Waveform::write(FileSystem::FileIO& io) const
+            {
+                DJV_PRIVATE_PTR();
+                io.write(fileMagic, 4);
+                io.writeU32(fileVersion);
+                io.writeU8(p.channelCount);
+                io.writeU32(static_cast<uint32_t>(p.sampleRate));
+                io.writeU32(static_cast<uint32_t>(p.binSampleCount));
+                const uint64_t sampleCount = p.sampleCount;
+                io.writeU32(static_cast<uint32_t>(sampleCount & 0xffffffff));
+                io.writeU32(static_cast<uint32_t>(sampleCount >> 32));
+                for (const auto& channel : p.levels)
+                {
+                    // Only the first level is stored, the others are rebuilt
+                    // when the file is read.
+                    const auto& bins = channel[0];
+                    io.writeU32(static_cast<uint32_t>(bins.size()));
+                    for (const auto& bin : bins)
+                    {
+                        io.writeF32(bin.min);
+                        io.writeF32(bin.max);
+                        io.writeF32(bin.rms);
+                    }
+                }
+            }
+
+            std::shared_ptr<Waveform> Waveform::read(FileSystem::FileIO& io)
+            {
+                char magic[4] = { 0, 0, 0, 0 };
+                io.read(magic, 4);
+                uint32_t version = 0;
+                io.readU32(&version);
+                if (memcmp(magic, fileMagic, 4) != 0 || version != fileVersion)
+                {
+                    std::stringstream ss;
+                    ss << DJV_TEXT("error_the_file") << " '" << io.getFileName() << "' " <<
+                        DJV_TEXT("error_cannot_be_read") << ".";
+                    throw FileSystem::Error(ss.str());
+                }
+                uint8_t channelCount = 0;
+                io.readU8(&channelCount);
+                uint32_t sampleRate = 0;
+                io.readU32(&sampleRate);
+                uint32_t binSampleCount = 0;
+                io.readU32(&binSampleCount);
+                uint32_t sampleCount[2] = { 0, 0 };
+                io.readU32(sampleCount, 2);
+                auto out = Waveform::create(channelCount, sampleRate, binSampleCount);
+                out->_p->sampleCount = static_cast<size_t>(sampleCount[0] | (static_cast<uint64_t>(sampleCount[1]) << 32));
+                for (auto& channel : out->_p->levels)
+                {
+                    uint32_t binCount = 0;
+                    io.readU32(&binCount);
+                    auto& bins = channel[0];
+                    bins.resize(binCount);
+                    for (auto& bin : bins)
+                    {
+                        io.readF32(&bin.min);
+                        io.readF32(&bin.max);
+                        io.readF32(&bin.rms);
+                    }
+                }
+                out->finish();
+                return out;
+            }
+
+            void Waveform::_addBin()
+            {
+                DJV_PRIVATE_PTR();
+                for (uint8_t c = 0; c < p.channelCount; ++c)
+                {
+                    auto bin = p.bin[c];
+                    bin.rms = static_cast<float>(sqrt(p.binSquares[c] / p.binCount));
+                    p.levels[c][0].push_back(bin);
+                    p.bin[c] = Bin();
+                    p.binSquares[c] = 0.0;
+                }
+                p.binCount = 0;
+            }
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,127 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/AudioData.h>
+
+namespace djv
+{
+    namespace Core
+    {
+        namespace FileSystem
+        {
+            class FileIO;
+
+        } // namespace FileSystem
+    } // namespace Core
+
+    namespace AV
+    {
+        namespace Audio
+        {
+            //! This constant provides the default number of samples in each bin
+            //! of the first waveform level.
+            const size_t waveformBinSampleCount = 512;
+
+            //! This class provides a waveform overview. The samples of each
+            //! channel are summarized as a pyramid of levels, where each bin
+            //! stores the minimum, maximum, and RMS of the samples it covers and
+            //! each level has half the bins of the previous one. A summary of any
+            //! range of samples can then be retrieved in time proportional to
+            //! the number of bins requested.
+            class Waveform
+            {
+                DJV_NON_COPYABLE(Waveform);
+
+            protected:
+                void _init(uint8_t channelCount, size_t sampleRate, size_t binSampleCount);
+                Waveform();
+
+            public:
+                ~Waveform();
+
+                static std::shared_ptr<Waveform> create(
+                    uint8_t channelCount,
+                    size_t  sampleRate,
+                    size_t  binSampleCount = waveformBinSampleCount);
+
+                //! This struct provides a waveform bin.
+                struct Bin
+                {
+                    float min = 0.F;
+                    float max = 0.F;
+                    float rms = 0.F;
+
+                    bool operator == (const Bin&) const;
+                };
+
+                uint8_t getChannelCount() const;
+                size_t getSampleRate() const;
+                size_t getBinSampleCount() const;
+
+                //! Get the number of samples that have been added.
+                size_t getSampleCount() const;
+
+                size_t getLevelCount() const;
+                const std::vector<Bin>& getLevel(uint8_t channel, size_t level) const;
+
+                //! Get the number of bytes used by the bins of all the levels.
+                size_t getByteCount() const;
+
+                //! Add samples. The samples are converted to floating point and
+                //! accumulated into the first level.
+                void add(const std::shared_ptr<Data>&);
+
+                //! Build the remaining levels after all of the samples have been
+                //! added.
+                void finish();
+
+                //! Get a summary of the samples in the range [start, end) divided
+                //! into the given number of bins.
+                std::vector<Bin> getBins(uint8_t channel, size_t start, size_t end, size_t count) const;
+
+                //! Write the waveform to a file.
+                void write(Core::FileSystem::FileIO&) const;
+
+                //! Read a waveform from a file.
+                //! Throws:
+                //! - Core::FileSystem::Error
+                static std::shared_ptr<Waveform> read(Core::FileSystem::FileIO&);
+
+            private:
+                void _addBin();
+
+                DJV_PRIVATE();
+            };
+
+        } // namespace Audio
+    } // namespace AV
+} // namespace djv
@@ -58,7 +58,7 @@ namespace djv
                 static const std::string pluginName = "FFmpeg";
                 static const std::set<std::string> fileExtensions =
                 {
-                    ".avi", ".dv", ".gif", ".flv", ".mkv", ".mov", ".mpg", ".mpeg", ".mp3", ".mp4", ".m4v", ".mxf", ".wav", ".webp"
+                    ".avi", ".dv", ".gif", ".flv", ".mkv", ".mov", ".mpg", ".mpeg", ".mp3", ".mp4", ".m4v", ".mxf", ".webp"
                 };
 
                 Audio::Type toAudioType(AVSampleFormat);
@@ -99,10 +99,14 @@ namespace djv
                     bool isRunning() const override;
 
                     std::future<Info> getInfo() override;
+                    std::shared_ptr<Image::Image> readImage() override;
 
                     void seek(int64_t, Direction) override;
 
                 private:
+                    Info _open();
+                    void _close();
+
                     struct DecodeVideo
                     {
                         AVPacket*           packet       = nullptr;
@@ -60,6 +60,7 @@ namespace djv
                     AudioInfo audioInfo;
                     Time::Speed speed;
                     std::promise<Info> infoPromise;
+                    std::shared_future<Info> infoFuture;
                     std::condition_variable queueCV;
                     int64_t seek = Frame::invalid;
                     Direction direction = Direction::Forward;
@@ -86,257 +87,22 @@ namespace djv
                     IRead::_init(fileInfo, readOptions, resourceSystem, logSystem);
                     DJV_PRIVATE_PTR();
                     p.options = options;
-                    p.running = true;
+
+                    // Without a thread the file is opened on demand by getInfo()
+                    // and readImage().
+                    p.running = readOptions.thread;
+                    if (!readOptions.thread)
+                    {
+                        return;
+                    }
+
                     p.thread = std::thread(
                         [this]
                     {
                         DJV_PRIVATE_PTR();
                         try
                         {
-                            // Open the file.
-                            /*{
-                                std::stringstream ss;
-                                ss << "Reading file: " << _fileInfo;
-                                _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
-                            }*/
-                            int r = avformat_open_input(
-                                &p.avFormatContext,
-                                _fileInfo.getFileName().c_str(),
-                                nullptr,
-                                nullptr);
-                            if (r < 0)
-                            {
-                                std::stringstream ss;
-                                ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                    DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                throw FileSystem::Error(ss.str());
-                            }
-                            r = avformat_find_stream_info(p.avFormatContext, 0);
-                            if (r < 0)
-                            {
-                                std::stringstream ss;
-                                ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                    DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                throw FileSystem::Error(ss.str());
-                            }
-                            av_dump_format(p.avFormatContext, 0, _fileInfo.getFileName().c_str(), 0);
-
-                            // Find the first video and audio stream.
-                            for (unsigned int i = 0; i < p.avFormatContext->nb_streams; ++i)
-                            {
-                                if (-1 == p.avVideoStream && p.avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
-                                {
-                                    p.avVideoStream = i;
-                                }
-                                if (-1 == p.avAudioStream && p.avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO)
-                                {
-                                    p.avAudioStream = i;
-                                }
-                            }
-                            if (-1 == p.avVideoStream && -1 == p.avAudioStream)
-                            {
-                                std::stringstream ss;
-                                ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                    DJV_TEXT("error_no_streams") << ".";
-                                throw FileSystem::Error(ss.str());
-                            }
-
-                            Info info;
-                            info.fileName = std::string(_fileInfo);
-
-                            if (p.avVideoStream != -1 || p.avAudioStream != -1)
-                            {
-                                // Initialize the buffers.
-                                p.avFrame = av_frame_alloc();
-                            }
-
-                            size_t sequenceSize = 0;
-                            if (p.avVideoStream != -1)
-                            {
-                                // Find the codec for the video stream.
-                                auto avVideoStream = p.avFormatContext->streams[p.avVideoStream];
-                                auto avVideoCodecParameters = avVideoStream->codecpar;
-                                auto avVideoCodec = avcodec_find_decoder(avVideoCodecParameters->codec_id);
-                                if (!avVideoCodec)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_codec_match") << ".";
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                p.avCodecParameters[p.avVideoStream] = avcodec_parameters_alloc();
-                                r = avcodec_parameters_copy(p.avCodecParameters[p.avVideoStream], avVideoCodecParameters);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                p.avCodecContext[p.avVideoStream] = avcodec_alloc_context3(avVideoCodec);
-                                r = avcodec_parameters_to_context(p.avCodecContext[p.avVideoStream], p.avCodecParameters[p.avVideoStream]);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                p.avCodecContext[p.avVideoStream]->thread_count = p.options.threadCount;
-                                p.avCodecContext[p.avVideoStream]->thread_type = FF_THREAD_SLICE;
-                                r = avcodec_open2(p.avCodecContext[p.avVideoStream], avVideoCodec, 0);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-
-                                // Initialize the buffers.
-                                p.avFrameRgb = av_frame_alloc();
-
-                                // Initialize the software scaler.
-                                p.swsContext = sws_getContext(
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format),
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    AV_PIX_FMT_RGBA,
-                                    SWS_BILINEAR,
-                                    0,
-                                    0,
-                                    0);
-
-                                // Get information.
-                                const auto pixelDataInfo = Image::Info(
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    Image::Type::RGBA_U8);
-                                if (avVideoStream->duration != AV_NOPTS_VALUE)
-                                {
-                                    AVRational r;
-                                    r.num = avVideoStream->r_frame_rate.den;
-                                    r.den = avVideoStream->r_frame_rate.num;
-                                    sequenceSize = av_rescale_q(
-                                        avVideoStream->duration,
-                                        avVideoStream->time_base,
-                                        r);
-                                }
-                                else if (p.avFormatContext->duration != AV_NOPTS_VALUE)
-                                {
-                                    AVRational r;
-                                    r.num = avVideoStream->r_frame_rate.den;
-                                    r.den = avVideoStream->r_frame_rate.num;
-                                    sequenceSize = av_rescale_q(
-                                        p.avFormatContext->duration,
-                                        av_get_time_base_q(),
-                                        r);
-                                }
-                                p.speed = Time::Speed(avVideoStream->r_frame_rate.num, avVideoStream->r_frame_rate.den);
-                                p.videoInfo = VideoInfo(pixelDataInfo, p.speed, Frame::Sequence(Frame::Range(1, sequenceSize)));
-                                p.videoInfo.codec = std::string(avVideoCodec->long_name);
-                                info.video.push_back(p.videoInfo);
-                                /*{
-                                    std::stringstream ss;
-                                    ss << _fileInfo << ": image size " << pixelDataInfo.size << "\n";
-                                    ss << _fileInfo << ": pixel type " << pixelDataInfo.type << "\n";
-                                    ss << _fileInfo << ": duration " << duration << "\n";
-                                    ss << _fileInfo << ": speed " << p.speed << "\n";
-                                    _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
-                                }*/
-                            }
-
-                            if (p.avAudioStream != -1)
-                            {
-                                // Find the codec for the audio stream.
-                                auto avAudioStream = p.avFormatContext->streams[p.avAudioStream];
-                                auto avAudioCodecParameters = avAudioStream->codecpar;
-                                Audio::Type audioType = FFmpeg::toAudioType(static_cast<AVSampleFormat>(avAudioCodecParameters->format));
-                                if (Audio::Type::None == audioType)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_audio_format") <<
-                                        " '" << FFmpeg::toString(static_cast<AVSampleFormat>(avAudioCodecParameters->format)) << "' " <<
-                                        DJV_TEXT("error_unsupported") << ".";
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                auto avAudioCodec = avcodec_find_decoder(avAudioCodecParameters->codec_id);
-                                if (!avAudioCodec)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_no_audio_codecs") << ".";
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                p.avCodecParameters[p.avAudioStream] = avcodec_parameters_alloc();
-                                r = avcodec_parameters_copy(p.avCodecParameters[p.avAudioStream], avAudioCodecParameters);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                p.avCodecContext[p.avAudioStream] = avcodec_alloc_context3(avAudioCodec);
-                                r = avcodec_parameters_to_context(p.avCodecContext[p.avAudioStream], p.avCodecParameters[p.avAudioStream]);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-                                r = avcodec_open2(p.avCodecContext[p.avAudioStream], avAudioCodec, 0);
-                                if (r < 0)
-                                {
-                                    std::stringstream ss;
-                                    ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
-                                        DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
-                                    throw FileSystem::Error(ss.str());
-                                }
-
-                                // Get information.
-                                size_t sampleCount = 0;
-                                if (avAudioStream->duration != AV_NOPTS_VALUE)
-                                {
-                                    sampleCount = avAudioStream->duration;
-                                }
-                                else if (p.avFormatContext->duration != AV_NOPTS_VALUE)
-                                {
-                                    sampleCount = av_rescale_q(
-                                        p.avFormatContext->duration,
-                                        av_get_time_base_q(),
-                                        avAudioStream->time_base);
-                                }
-                                uint8_t channelCount = p.avCodecParameters[p.avAudioStream]->channels;
-                                switch (channelCount)
-                                {
-                                case 1:
-                                case 2:
-                                case 6:
-                                case 7:
-                                case 8: break;
-                                default: channelCount = 2; break;
-                                }
-                                p.audioInfo = AudioInfo(
-                                    Audio::Info(
-                                        channelCount,
-                                        audioType,
-                                        p.avCodecParameters[p.avAudioStream]->sample_rate,
-                                        sampleCount));
-                                p.videoInfo.codec = std::string(avAudioCodec->long_name);
-                                info.audio.push_back(p.audioInfo);
-                            }
-
-                            AVDictionaryEntry* tag = nullptr;
-                            while ((tag = av_dict_get(p.avFormatContext->metadata, "", tag, AV_DICT_IGNORE_SUFFIX)))
-                            {
-                                info.tags.setTag(tag->key, tag->value);
-                            }
-
-                            p.infoPromise.set_value(info);
+                            p.infoPromise.set_value(_open());
 
                             while (p.running)
                             {
@@ -371,8 +137,8 @@ namespace djv
                                     if (p.queueCV.wait_for(
                                         lock,
                                         Time::getTime(Time::TimerValue::Fast),
-                                        [this, sequenceSize]
-                                        //[this, sequenceSize, cacheEnabled, &cachedFrames]
+                                        [this]
+                                        //[this, cacheEnabled, &cachedFrames]
                                     {
                                         DJV_PRIVATE_PTR();
                                         const bool video = p.avVideoStream != -1 && (_videoQueue.isFinished() ? false : (_videoQueue.getCount() < _videoQueue.getMax()));
@@ -574,31 +340,7 @@ namespace djv
                             p.infoPromise.set_value(Info());
                             _logSystem->log("djvAV::IO::FFmpeg::Read", e.what(), LogLevel::Error);
                         }
-                        if (p.swsContext)
-                        {
-                            sws_freeContext(p.swsContext);
-                        }
-                        if (p.avFrameRgb)
-                        {
-                            av_frame_free(&p.avFrameRgb);
-                        }
-                        if (p.avFrame)
-                        {
-                            av_frame_free(&p.avFrame);
-                        }
-                        for (auto i : p.avCodecContext)
-                        {
-                            avcodec_close(i.second);
-                            avcodec_free_context(&i.second);
-                        }
-                        for (auto i : p.avCodecParameters)
-                        {
-                            avcodec_parameters_free(&i.second);
-                        }
-                        if (p.avFormatContext)
-                        {
-                            avformat_close_input(&p.avFormatContext);
-                        }
+                        _close();
                     });
                 }
 
@@ -615,6 +357,10 @@ namespace djv
 						//! \todo How do we safely detach the thread here so we don't block?
                         p.thread.join();
                     }
+                    if (!_options.thread)
+                    {
+                        _close();
+                    }
                 }
 
                 std::shared_ptr<Read> Read::create(
@@ -636,7 +382,79 @@ namespace djv
 
                 std::future<Info> Read::getInfo()
                 {
-                    return _p->infoPromise.get_future();
+                    DJV_PRIVATE_PTR();
+                    if (!_options.thread)
+                    {
+                        // The file is only opened once, the result is shared
+                        // with subsequent calls.
+                        if (!p.infoFuture.valid())
+                        {
+                            try
+                            {
+                                p.infoPromise.set_value(_open());
+                            }
+                            catch (const std::exception&)
+                            {
+                                p.infoPromise.set_exception(std::current_exception());
+                            }
+                            p.infoFuture = p.infoPromise.get_future().share();
+                        }
+                        std::promise<Info> promise;
+                        auto future = promise.get_future();
+                        try
+                        {
+                            promise.set_value(p.infoFuture.get());
+                        }
+                        catch (const std::exception&)
+                        {
+                            promise.set_exception(std::current_exception());
+                        }
+                        return future;
+                    }
+                    return p.infoPromise.get_future();
+                }
+
+                std::shared_ptr<Image::Image> Read::readImage()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (_options.thread)
+                    {
+                        return IRead::readImage();
+                    }
+
+                    // Decode video packets until the first image is available.
+                    // Audio packets are skipped.
+                    std::shared_ptr<Image::Image> out;
+                    if (getInfo().get().video.size())
+                    {
+                        Frame::Number videoFrame = Frame::invalid;
+                        bool finished = false;
+                        while (!out && !finished)
+                        {
+                            AVPacket packet;
+                            DecodeVideo dv;
+                            if (av_read_frame(p.avFormatContext, &packet) < 0)
+                            {
+                                _decodeVideo(dv, videoFrame);
+                                finished = true;
+                            }
+                            else
+                            {
+                                if (p.avVideoStream == packet.stream_index)
+                                {
+                                    dv.packet = &packet;
+                                    finished = _decodeVideo(dv, videoFrame) < 0;
+                                }
+                                av_packet_unref(&packet);
+                            }
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            if (!_videoQueue.isEmpty())
+                            {
+                                out = _videoQueue.popFrame().image;
+                            }
+                        }
+                    }
+                    return out;
                 }
 
                 void Read::seek(Frame::Number value, Direction)
@@ -651,6 +469,288 @@ namespace djv
                     p.queueCV.notify_one();
                 }
 
+                Info Read::_open()
+                {
+                    DJV_PRIVATE_PTR();
+                    // Open the file.
+                    /*{
+                        std::stringstream ss;
+                        ss << "Reading file: " << _fileInfo;
+                        _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
+                    }*/
+                    int r = avformat_open_input(
+                        &p.avFormatContext,
+                        _fileInfo.getFileName().c_str(),
+                        nullptr,
+                        nullptr);
+                    if (r < 0)
+                    {
+                        std::stringstream ss;
+                        ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                            DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                        throw FileSystem::Error(ss.str());
+                    }
+                    r = avformat_find_stream_info(p.avFormatContext, 0);
+                    if (r < 0)
+                    {
+                        std::stringstream ss;
+                        ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                            DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                        throw FileSystem::Error(ss.str());
+                    }
+                    av_dump_format(p.avFormatContext, 0, _fileInfo.getFileName().c_str(), 0);
+
+                    // Find the first video and audio stream.
+                    for (unsigned int i = 0; i < p.avFormatContext->nb_streams; ++i)
+                    {
+                        if (_options.video &&
+                            -1 == p.avVideoStream &&
+                            p.avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+                        {
+                            p.avVideoStream = i;
+                        }
+                        if (-1 == p.avAudioStream && p.avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO)
+                        {
+                            p.avAudioStream = i;
+                        }
+                    }
+                    if (-1 == p.avVideoStream && -1 == p.avAudioStream)
+                    {
+                        std::stringstream ss;
+                        ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                            DJV_TEXT("error_no_streams") << ".";
+                        throw FileSystem::Error(ss.str());
+                    }
+
+                    Info info;
+                    info.fileName = std::string(_fileInfo);
+
+                    if (p.avVideoStream != -1 || p.avAudioStream != -1)
+                    {
+                        // Initialize the buffers.
+                        p.avFrame = av_frame_alloc();
+                    }
+
+                    size_t sequenceSize = 0;
+                    if (p.avVideoStream != -1)
+                    {
+                        // Find the codec for the video stream.
+                        auto avVideoStream = p.avFormatContext->streams[p.avVideoStream];
+                        auto avVideoCodecParameters = avVideoStream->codecpar;
+                        auto avVideoCodec = avcodec_find_decoder(avVideoCodecParameters->codec_id);
+                        if (!avVideoCodec)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_codec_match") << ".";
+                            throw FileSystem::Error(ss.str());
+                        }
+                        p.avCodecParameters[p.avVideoStream] = avcodec_parameters_alloc();
+                        r = avcodec_parameters_copy(p.avCodecParameters[p.avVideoStream], avVideoCodecParameters);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+                        p.avCodecContext[p.avVideoStream] = avcodec_alloc_context3(avVideoCodec);
+                        r = avcodec_parameters_to_context(p.avCodecContext[p.avVideoStream], p.avCodecParameters[p.avVideoStream]);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+                        // Without a reader thread the caller provides the
+                    // parallelism, so the codec uses a single thread.
+                    p.avCodecContext[p.avVideoStream]->thread_count = _options.thread ? p.options.threadCount : 1;
+                        p.avCodecContext[p.avVideoStream]->thread_type = FF_THREAD_SLICE;
+                        r = avcodec_open2(p.avCodecContext[p.avVideoStream], avVideoCodec, 0);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+
+                        // Initialize the buffers.
+                        p.avFrameRgb = av_frame_alloc();
+
+                        // Initialize the software scaler.
+                        p.swsContext = sws_getContext(
+                            p.avCodecParameters[p.avVideoStream]->width,
+                            p.avCodecParameters[p.avVideoStream]->height,
+                            static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format),
+                            p.avCodecParameters[p.avVideoStream]->width,
+                            p.avCodecParameters[p.avVideoStream]->height,
+                            AV_PIX_FMT_RGBA,
+                            SWS_BILINEAR,
+                            0,
+                            0,
+                            0);
+
+                        // Get information.
+                        const auto pixelDataInfo = Image::Info(
+                            p.avCodecParameters[p.avVideoStream]->width,
+                            p.avCodecParameters[p.avVideoStream]->height,
+                            Image::Type::RGBA_U8);
+                        if (avVideoStream->duration != AV_NOPTS_VALUE)
+                        {
+                            AVRational r;
+                            r.num = avVideoStream->r_frame_rate.den;
+                            r.den = avVideoStream->r_frame_rate.num;
+                            sequenceSize = av_rescale_q(
+                                avVideoStream->duration,
+                                avVideoStream->time_base,
+                                r);
+                        }
+                        else if (p.avFormatContext->duration != AV_NOPTS_VALUE)
+                        {
+                            AVRational r;
+                            r.num = avVideoStream->r_frame_rate.den;
+                            r.den = avVideoStream->r_frame_rate.num;
+                            sequenceSize = av_rescale_q(
+                                p.avFormatContext->duration,
+                                av_get_time_base_q(),
+                                r);
+                        }
+                        p.speed = Time::Speed(avVideoStream->r_frame_rate.num, avVideoStream->r_frame_rate.den);
+                        p.videoInfo = VideoInfo(pixelDataInfo, p.speed, Frame::Sequence(Frame::Range(1, sequenceSize)));
+                        p.videoInfo.codec = std::string(avVideoCodec->long_name);
+                        info.video.push_back(p.videoInfo);
+                        /*{
+                            std::stringstream ss;
+                            ss << _fileInfo << ": image size " << pixelDataInfo.size << "\n";
+                            ss << _fileInfo << ": pixel type " << pixelDataInfo.type << "\n";
+                            ss << _fileInfo << ": duration " << duration << "\n";
+                            ss << _fileInfo << ": speed " << p.speed << "\n";
+                            _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
+                        }*/
+                    }
+
+                    if (p.avAudioStream != -1)
+                    {
+                        // Find the codec for the audio stream.
+                        auto avAudioStream = p.avFormatContext->streams[p.avAudioStream];
+                        auto avAudioCodecParameters = avAudioStream->codecpar;
+                        Audio::Type audioType = FFmpeg::toAudioType(static_cast<AVSampleFormat>(avAudioCodecParameters->format));
+                        if (Audio::Type::None == audioType)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_audio_format") <<
+                                " '" << FFmpeg::toString(static_cast<AVSampleFormat>(avAudioCodecParameters->format)) << "' " <<
+                                DJV_TEXT("error_unsupported") << ".";
+                            throw FileSystem::Error(ss.str());
+                        }
+                        auto avAudioCodec = avcodec_find_decoder(avAudioCodecParameters->codec_id);
+                        if (!avAudioCodec)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_no_audio_codecs") << ".";
+                            throw FileSystem::Error(ss.str());
+                        }
+                        p.avCodecParameters[p.avAudioStream] = avcodec_parameters_alloc();
+                        r = avcodec_parameters_copy(p.avCodecParameters[p.avAudioStream], avAudioCodecParameters);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+                        p.avCodecContext[p.avAudioStream] = avcodec_alloc_context3(avAudioCodec);
+                        r = avcodec_parameters_to_context(p.avCodecContext[p.avAudioStream], p.avCodecParameters[p.avAudioStream]);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+                        r = avcodec_open2(p.avCodecContext[p.avAudioStream], avAudioCodec, 0);
+                        if (r < 0)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ". " << FFmpeg::getErrorString(r);
+                            throw FileSystem::Error(ss.str());
+                        }
+
+                        // Get information.
+                        size_t sampleCount = 0;
+                        if (avAudioStream->duration != AV_NOPTS_VALUE)
+                        {
+                            sampleCount = avAudioStream->duration;
+                        }
+                        else if (p.avFormatContext->duration != AV_NOPTS_VALUE)
+                        {
+                            sampleCount = av_rescale_q(
+                                p.avFormatContext->duration,
+                                av_get_time_base_q(),
+                                avAudioStream->time_base);
+                        }
+                        uint8_t channelCount = p.avCodecParameters[p.avAudioStream]->channels;
+                        switch (channelCount)
+                        {
+                        case 1:
+                        case 2:
+                        case 6:
+                        case 7:
+                        case 8: break;
+                        default: channelCount = 2; break;
+                        }
+                        p.audioInfo = AudioInfo(
+                            Audio::Info(
+                                channelCount,
+                                audioType,
+                                p.avCodecParameters[p.avAudioStream]->sample_rate,
+                                sampleCount));
+                        p.videoInfo.codec = std::string(avAudioCodec->long_name);
+                        info.audio.push_back(p.audioInfo);
+                    }
+
+                    AVDictionaryEntry* tag = nullptr;
+                    while ((tag = av_dict_get(p.avFormatContext->metadata, "", tag, AV_DICT_IGNORE_SUFFIX)))
+                    {
+                        info.tags.setTag(tag->key, tag->value);
+                    }
+                    return info;
+                }
+
+                void Read::_close()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (p.swsContext)
+                    {
+                        sws_freeContext(p.swsContext);
+                    }
+                    if (p.avFrameRgb)
+                    {
+                        av_frame_free(&p.avFrameRgb);
+                    }
+                    if (p.avFrame)
+                    {
+                        av_frame_free(&p.avFrame);
+                    }
+                    for (auto i : p.avCodecContext)
+                    {
+                        avcodec_close(i.second);
+                        avcodec_free_context(&i.second);
+                    }
+                    for (auto i : p.avCodecParameters)
+                    {
+                        avcodec_parameters_free(&i.second);
+                    }
+                    if (p.avFormatContext)
+                    {
+                        avformat_close_input(&p.avFormatContext);
+                    }
+                }
+
                 int Read::_decodeVideo(const DecodeVideo& dv, Frame::Number& frame)
                 {
                     DJV_PRIVATE_PTR();
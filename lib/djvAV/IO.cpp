@@ -37,6 +37,7 @@
 #include <djvAV/RLA.h>
 #include <djvAV/SGI.h>
 #include <djvAV/Targa.h>
+#include <djvAV/WAV.h>
 
 #if defined(FFmpeg_FOUND)
 #include <djvAV/FFmpeg.h>
@@ -57,9 +58,15 @@
 #include <djvCore/Context.h>
 #include <djvCore/FileSystem.h>
 #include <djvCore/LogSystem.h>
+#include <djvCore/Math.h>
 #include <djvCore/Path.h>
 #include <djvCore/ResourceSystem.h>
 #include <djvCore/String.h>
+#include <djvCore/Timer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 using namespace djv::Core;
 
@@ -76,7 +83,7 @@ namespace djv
 
             void VideoQueue::addFrame(const VideoFrame& value)
             {
-                _queue.push(value);
+                _queue.push_back(value);
             }
 
             VideoFrame VideoQueue::popFrame()
@@ -85,17 +92,14 @@ namespace djv
                 if (_queue.size())
                 {
                     out = _queue.front();
-                    _queue.pop();
+                    _queue.pop_front();
                 }
                 return out;
             }
 
             void VideoQueue::clearFrames()
             {
-                while (_queue.size())
-                {
-                    _queue.pop();
-                }
+                _queue.clear();
             }
 
             void VideoQueue::setFinished(bool value)
@@ -161,37 +165,23 @@ namespace djv
 
             Frame::Sequence Cache::getFrames() const
             {
-                Frame::Sequence out;
+                // The caches are ordered by frame index.
                 std::vector<Frame::Index> frames;
+                frames.reserve(_cache.size() + _compressedCache.size());
                 for (const auto& i : _cache)
                 {
                     frames.push_back(i.first);
                 }
-                const size_t size = frames.size();
-                if (size)
+                if (_compressedCache.size())
                 {
-                    std::sort(frames.begin(), frames.end());
-                    Frame::Number rangeStart = frames[0];
-                    Frame::Number prevFrame = frames[0];
-                    size_t i = 1;
-                    for (; i < size; prevFrame = frames[i], ++i)
+                    const size_t size = frames.size();
+                    for (const auto& i : _compressedCache)
                     {
-                        if (frames[i] != prevFrame + 1)
-                        {
-                            out.ranges.push_back(Frame::Range(rangeStart, prevFrame));
-                            rangeStart = frames[i];
-                        }
-                    }
-                    if (size > 1)
-                    {
-                        out.ranges.push_back(Frame::Range(rangeStart, prevFrame));
-                    }
-                    else
-                    {
-                        out.ranges.push_back(Frame::Range(rangeStart));
+                        frames.push_back(i.first);
                     }
+                    std::inplace_merge(frames.begin(), frames.begin() + size, frames.end());
                 }
-                return out;
+                return Frame::fromFrames(frames);
             }
 
             void Cache::setMax(size_t value)
@@ -237,6 +227,14 @@ namespace djv
             void Cache::add(Frame::Index index, const std::shared_ptr<AV::Image::Image>& image)
             {
                 _cache[index] = image;
+                _compressedCache.erase(index);
+                _cacheUpdate();
+            }
+
+            void Cache::add(Frame::Index index, const std::shared_ptr<AV::Image::CompressedImage>& image)
+            {
+                _compressedCache[index] = image;
+                _cache.erase(index);
                 _cacheUpdate();
             }
 
@@ -244,7 +242,7 @@ namespace djv
             {
                 const auto range = _inOutPoints.getRange(_sequenceSize);
                 Frame::Index frame = _currentFrame;
-                _sequence = Frame::Sequence();
+                std::vector<Frame::Range> ranges;
                 switch (_direction)
                 {
                 case Direction::Forward:
@@ -257,7 +255,7 @@ namespace djv
                             frame = range.max;
                         }
                     }
-                    _sequence.ranges.push_back(Frame::Range(frame));
+                    ranges.push_back(Frame::Range(frame));
                     const Frame::Index first = frame;
                     for (size_t i = 0; i < _max; ++i)
                     {
@@ -269,14 +267,14 @@ namespace djv
                         if (frame > range.max)
                         {
                             frame = range.min;
-                            if (frame != _sequence.ranges.back().max)
+                            if (frame != ranges.back().max)
                             {
-                                _sequence.ranges.push_back(Frame::Range(frame));
+                                ranges.push_back(Frame::Range(frame));
                             }
                         }
                         else
                         {
-                            _sequence.ranges.back().max = frame;
+                            ranges.back().max = frame;
                         }
                     }
                     break;
@@ -291,7 +289,7 @@ namespace djv
                             frame = range.min;
                         }
                     }
-                    _sequence.ranges.push_back(Frame::Range(frame));
+                    ranges.push_back(Frame::Range(frame));
                     const Frame::Index first = frame;
                     for (size_t i = 0; i < _max; ++i)
                     {
@@ -303,20 +301,21 @@ namespace djv
                         if (frame < range.min)
                         {
                             frame = range.max;
-                            if (frame != _sequence.ranges.back().max)
+                            if (frame != ranges.back().max)
                             {
-                                _sequence.ranges.push_back(Frame::Range(frame));
+                                ranges.push_back(Frame::Range(frame));
                             }
                         }
                         else
                         {
-                            _sequence.ranges.back().min = frame;
+                            ranges.back().min = frame;
                         }
                     }
                     break;
                 }
                 default: break;
                 }
+                _sequence = Frame::Sequence(ranges);
                 auto i = _cache.begin();
                 while (i != _cache.end())
                 {
@@ -327,6 +326,108 @@ namespace djv
                         _cache.erase(j);
                     }
                 }
+                auto k = _compressedCache.begin();
+                while (k != _compressedCache.end())
+                {
+                    auto j = k;
+                    ++k;
+                    if (!_sequence.contains(j->first))
+                    {
+                        _compressedCache.erase(j);
+                    }
+                }
+            }
+
+            namespace
+            {
+                //! \todo Should these be configurable?
+                const double threadControllerInterval   = .5;
+                const float  threadControllerHeadroom   = 1.25F;
+                const size_t threadControllerQueueScale = 4;
+                const size_t threadControllerCalm       = 4;
+
+            } // namespace
+
+            void ThreadController::setThreadMax(size_t value)
+            {
+                _threadMax = std::max(value, static_cast<size_t>(1));
+                _state.threadMax = _threadMax;
+                if (0.F == _state.decodeTime)
+                {
+                    // Use the maximum until there are measurements.
+                    _state.threadCount = _threadMax;
+                }
+                _state.threadCount = std::min(_state.threadCount, _threadMax);
+            }
+
+            void ThreadController::setQueueSize(size_t value)
+            {
+                _queueSizeMin = std::max(value, static_cast<size_t>(1));
+                _state.queueSize = Math::clamp(_state.queueSize, _queueSizeMin, _queueSizeMin * threadControllerQueueScale);
+            }
+
+            bool ThreadController::update(const std::chrono::steady_clock::time_point& value)
+            {
+                if (!_init)
+                {
+                    _init = true;
+                    _time = value;
+                    return false;
+                }
+                const double elapsed = std::chrono::duration<double>(value - _time).count();
+                if (elapsed < threadControllerInterval)
+                    return false;
+                _time = value;
+
+                const ThreadControllerState prev = _state;
+                if (_decodeCount)
+                {
+                    const float decodeTime = static_cast<float>(_decodeSum / _decodeCount);
+                    _state.decodeTime = _state.decodeTime > 0.F ? ((_state.decodeTime + decodeTime) / 2.F) : decodeTime;
+                }
+                _state.waitTime = static_cast<float>(std::min(_waitSum / elapsed, 1.0));
+                _state.starvedCount += _starved;
+
+                // Get the number of decodes needed to keep up with the speed.
+                size_t threadCount = _state.threadCount;
+                if (_speed > 0.F && _state.decodeTime > 0.F)
+                {
+                    threadCount = static_cast<size_t>(std::ceil(_speed * _state.decodeTime * threadControllerHeadroom));
+                }
+                if (_starved)
+                {
+                    // The queue ran empty, add a thread and grow the queue.
+                    threadCount = std::max(threadCount, _state.threadCount + 1);
+                    _state.queueSize = std::min(_state.queueSize * 2, _queueSizeMin * threadControllerQueueScale);
+                    _calm = 0;
+                }
+                else if (++_calm >= threadControllerCalm)
+                {
+                    // Release the threads and queue one step at a time so the
+                    // controller doesn't oscillate.
+                    if (threadCount < _state.threadCount)
+                    {
+                        threadCount = _state.threadCount - 1;
+                    }
+                    if (_state.queueSize > _queueSizeMin)
+                    {
+                        --_state.queueSize;
+                    }
+                    _calm = 0;
+                }
+                else
+                {
+                    threadCount = std::max(threadCount, _state.threadCount);
+                }
+                _state.threadCount = Math::clamp(threadCount, static_cast<size_t>(1), _threadMax);
+
+                _decodeSum = 0.0;
+                _decodeCount = 0;
+                _waitSum = 0.0;
+                _starved = 0;
+                return
+                    _state.threadCount != prev.threadCount ||
+                    _state.queueSize != prev.queueSize;
             }
 
             void IRead::_init(
@@ -342,6 +443,34 @@ namespace djv
             IRead::~IRead()
             {}
 
+            std::shared_ptr<Image::Image> IRead::readImage()
+            {
+                const auto timeout = Time::getValue(Time::TimerValue::VeryFast);
+                while (true)
+                {
+                    const bool running = isRunning();
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (!_videoQueue.isEmpty())
+                        {
+                            return _videoQueue.getFrame().image;
+                        }
+                        if (_videoQueue.isFinished() || !running)
+                        {
+                            break;
+                        }
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+                }
+                return nullptr;
+            }
+
+            void IRead::setProxy(size_t value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _options.proxy = value;
+            }
+
             void IRead::setPlayback(bool value)
             {
                 std::lock_guard<std::mutex> lock(_mutex);
@@ -382,6 +511,12 @@ namespace djv
                 return _cachedFrames;
             }
 
+            ThreadControllerState IRead::getThreadControllerState()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _threadControllerState;
+            }
+
             void IRead::setCacheEnabled(bool value)
             {
                 std::lock_guard<std::mutex> lock(_mutex);
@@ -394,6 +529,23 @@ namespace djv
                 _cacheMaxByteCount = value;
             }
 
+            bool IRead::isCacheCompressionEnabled() const
+            {
+                return _cacheCompression;
+            }
+
+            void IRead::setCacheCompression(bool value)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _cacheCompression = value;
+            }
+
+            CacheCompressionStats IRead::getCacheCompressionStats()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _cacheCompressionStats;
+            }
+
             void IWrite::_init(
                 const FileSystem::FileInfo& fileInfo,
                 const Info & info,
@@ -466,6 +618,11 @@ namespace djv
                 return nullptr;
             }
 
+            std::shared_ptr<Image::TiledImage> IPlugin::readTiled(const FileSystem::FileInfo&, const ReadOptions&) const
+            {
+                return nullptr;
+            }
+
             std::shared_ptr<IWrite> IPlugin::write(const FileSystem::FileInfo&, const Info&, const WriteOptions&) const
             {
                 return nullptr;
@@ -495,6 +652,7 @@ namespace djv
                 p.plugins[RLA::pluginName] = RLA::Plugin::create(context);
                 p.plugins[SGI::pluginName] = SGI::Plugin::create(context);
                 p.plugins[Targa::pluginName] = Targa::Plugin::create(context);
+                p.plugins[WAV::pluginName] = WAV::Plugin::create(context);
 #if defined(FFmpeg_FOUND)
                 p.plugins[FFmpeg::pluginName] = FFmpeg::Plugin::create(context);
 #endif // FFmpeg_FOUND
@@ -652,6 +810,27 @@ namespace djv
                 return out;
             }
 
+            std::shared_ptr<Image::TiledImage> System::readTiled(const FileSystem::FileInfo& fileInfo, const ReadOptions& options)
+            {
+                DJV_PRIVATE_PTR();
+                std::shared_ptr<Image::TiledImage> out;
+                for (const auto & i : p.plugins)
+                {
+                    if (i.second->canRead(fileInfo))
+                    {
+                        out = i.second->readTiled(fileInfo, options);
+                        break;
+                    }
+                }
+                if (!out)
+                {
+                    std::stringstream ss;
+                    ss << DJV_TEXT("error_the_file") << " '" << fileInfo << "' " << DJV_TEXT("error_cannot_be_read") << ".";
+                    throw FileSystem::Error(ss.str());
+                }
+                return out;
+            }
+
             std::shared_ptr<IWrite> System::write(const FileSystem::FileInfo& fileInfo, const Info & info, const WriteOptions& options)
             {
                 DJV_PRIVATE_PTR();
@@ -31,7 +31,10 @@
 
 #include <djvAV/AudioData.h>
 #include <djvAV/Image.h>
+#include <djvAV/ImageCompress.h>
+#include <djvAV/OCIO.h>
 #include <djvAV/Tags.h>
+#include <djvAV/TiledImage.h>
 
 #include <djvCore/Error.h>
 #include <djvCore/FileInfo.h>
@@ -41,6 +44,7 @@
 #include <djvCore/Time.h>
 #include <djvCore/ValueObserver.h>
 
+#include <deque>
 #include <future>
 #include <queue>
 #include <mutex>
@@ -137,6 +141,10 @@ namespace djv
                 bool isEmpty() const;
                 size_t getCount() const;
                 VideoFrame getFrame() const;
+
+                //! Get up to the given number of frames from the front of the queue.
+                std::vector<VideoFrame> getFrames(size_t) const;
+
                 void addFrame(const VideoFrame&);
                 VideoFrame popFrame();
                 void clearFrames();
@@ -146,7 +154,7 @@ namespace djv
 
             private:
                 size_t _max = 0;
-                std::queue<VideoFrame> _queue;
+                std::deque<VideoFrame> _queue;
                 bool _finished = false;
             };
 
@@ -235,6 +243,19 @@ namespace djv
             {
                 size_t layer = 0;
                 std::string colorSpace;
+
+                //! Decode at a reduced resolution when supported by the file
+                //! format. Each proxy level halves the resolution.
+                size_t proxy = 0;
+
+                //! Use a reader thread. When this is disabled, plugins that
+                //! support it read the file information and images on the
+                //! calling thread with IRead::getInfo() and IRead::readImage().
+                bool thread = true;
+
+                //! Read the video. When this is disabled, plugins that support
+                //! it only read the audio, for example to build a waveform.
+                bool video = true;
             };
 
             //! This class provides playback in/out points.
@@ -274,6 +295,16 @@ namespace djv
                 size_t getMax() const;
                 size_t getCount() const;
                 size_t getTotalByteCount() const;
+
+                //! Get the number of compressed frames.
+                size_t getCompressedCount() const;
+
+                //! Get the uncompressed size of the compressed frames.
+                size_t getCompressedDataByteCount() const;
+
+                //! Get the size of the compressed frames.
+                size_t getCompressedByteCount() const;
+
                 Core::Frame::Sequence getFrames() const;
                 size_t getReadBehind() const;
                 const Core::Frame::Sequence& getSequence() const;
@@ -285,7 +316,9 @@ namespace djv
 
                 bool contains(Core::Frame::Index) const;
                 bool get(Core::Frame::Index, std::shared_ptr<AV::Image::Image>&) const;
+                bool get(Core::Frame::Index, std::shared_ptr<AV::Image::CompressedImage>&) const;
                 void add(Core::Frame::Index, const std::shared_ptr<AV::Image::Image>&);
+                void add(Core::Frame::Index, const std::shared_ptr<AV::Image::CompressedImage>&);
                 void clear();
 
             private:
@@ -300,6 +333,116 @@ namespace djv
                 size_t _readBehind = 10;
                 Core::Frame::Sequence _sequence;
                 std::map<Core::Frame::Index, std::shared_ptr<AV::Image::Image> > _cache;
+                std::map<Core::Frame::Index, std::shared_ptr<AV::Image::CompressedImage> > _compressedCache;
+            };
+
+            //! This class provides statistics for a compressed cache.
+            class CacheCompressionStats
+            {
+            public:
+                CacheCompressionStats();
+
+                //! The number of compressed frames in the cache.
+                size_t frameCount = 0;
+
+                //! The uncompressed size of the frames.
+                size_t dataByteCount = 0;
+
+                //! The compressed size of the frames.
+                size_t compressedByteCount = 0;
+
+                //! The average time to compress a frame in seconds.
+                float compressTime = 0.F;
+
+                //! The average time to decompress a frame in seconds.
+                float decompressTime = 0.F;
+
+                //! Get the compression ratio (uncompressed / compressed).
+                float getRatio() const;
+
+                bool operator == (const CacheCompressionStats&) const;
+                bool operator != (const CacheCompressionStats&) const;
+            };
+
+            //! This class provides the state of a thread controller.
+            class ThreadControllerState
+            {
+            public:
+                ThreadControllerState();
+
+                //! The number of decodes in flight during playback.
+                size_t threadCount = 0;
+
+                //! The maximum number of decodes in flight during playback.
+                size_t threadMax = 0;
+
+                //! The video queue size.
+                size_t queueSize = 0;
+
+                //! The average decode time of a frame in seconds.
+                float decodeTime = 0.F;
+
+                //! The fraction of time the reader thread spends waiting for
+                //! decodes to finish.
+                float waitTime = 0.F;
+
+                //! The number of times the video queue has run empty during
+                //! playback.
+                size_t starvedCount = 0;
+
+                bool operator == (const ThreadControllerState&) const;
+                bool operator != (const ThreadControllerState&) const;
+            };
+
+            //! This class adjusts the number of decodes a reader keeps in
+            //! flight during playback, and the size of the video queue.
+            //!
+            //! The thread count is the smallest that keeps up with the target
+            //! speed given the measured decode time, up to the maximum thread
+            //! count. When the video queue runs empty a thread is added and the
+            //! queue grows, shrinking back once playback keeps up.
+            class ThreadController
+            {
+            public:
+                ThreadController();
+
+                size_t getThreadMax() const;
+                size_t getThreadCount() const;
+                size_t getQueueSize() const;
+                size_t getQueueSizeMin() const;
+                const ThreadControllerState& getState() const;
+
+                void setThreadMax(size_t);
+                void setQueueSize(size_t);
+
+                //! Set the target speed in frames per second.
+                void setSpeed(float);
+
+                //! Add the time in seconds it took to decode a frame.
+                void addDecode(double);
+
+                //! Add the time in seconds the reader thread waited for decodes.
+                void addWait(double);
+
+                //! Add an occurrence of the video queue running empty.
+                void addStarved();
+
+                //! Update the thread count and queue size. Returns true if
+                //! either has changed.
+                bool update(const std::chrono::steady_clock::time_point&);
+
+            private:
+                size_t _threadMax = 4;
+                size_t _queueSizeMin = 1;
+                float _speed = 0.F;
+                double _decodeSum = 0.0;
+                size_t _decodeCount = 0;
+                double _waitSum = 0.0;
+                size_t _starved = 0;
+                size_t _calm = 0;
+                bool _init = false;
+                std::chrono::steady_clock::time_point _time;
+                ThreadControllerState _state;
             };
 
             //! This class provides an interface for reading.
@@ -317,6 +460,17 @@ namespace djv
 
                 virtual std::future<Info> getInfo() = 0;
 
+                //! Read the first image. The default implementation waits for
+                //! the reader thread to queue a frame.
+                //! Throws:
+                //! - Core::FileSystem::Error
+                virtual std::shared_ptr<Image::Image> readImage();
+
+                //! Set the proxy level used by readImage(). This allows the
+                //! proxy to be chosen from the information without opening a
+                //! second reader. It only applies to readers without a thread.
+                void setProxy(size_t);
+
                 void setPlayback(bool);
                 void setInOutPoints(const InOutPoints&);
 
@@ -333,6 +487,17 @@ namespace djv
                 void setCacheEnabled(bool);
                 void setCacheMaxByteCount(size_t);
 
+                //! Set whether frames are compressed in the cache. Frames are
+                //! compressed on the decode threads as they are added and
+                //! decompressed on the decode threads as they are read.
+                bool isCacheCompressionEnabled() const;
+                void setCacheCompression(bool);
+                CacheCompressionStats getCacheCompressionStats();
+
+                //! Get the state of the thread controller for readers that
+                //! adjust their thread count automatically.
+                ThreadControllerState getThreadControllerState();
+
             protected:
                 ReadOptions _options;
                 InOutPoints _inOutPoints;
@@ -340,16 +505,31 @@ namespace djv
                 bool _playback = false;
                 bool _cacheEnabled = false;
                 size_t _cacheMaxByteCount = 0;
+                bool _cacheCompression = false;
                 size_t _cacheByteCount = 0;
                 Core::Frame::Sequence _cacheSequence;
                 Core::Frame::Sequence _cachedFrames;
                 Cache _cache;
+                CacheCompressionStats _cacheCompressionStats;
+                ThreadControllerState _threadControllerState;
             };
 
             //! This class provides options for writing.
             struct WriteOptions : IOOptions
             {
+                //! The color space of the file. This does not convert the
+                //! images, the Cineon and DPX writers use it to set the color
+                //! profile in the file header.
                 std::string colorSpace;
+
+                //! Convert the images on the CPU before they are written. The
+                //! images are only converted when both the input and output
+                //! color spaces are set.
+                OCIO::Convert colorSpaceConvert;
+
+                //! The 3D LUT edge length used for the conversion, or zero to
+                //! convert every pixel with the OCIO processor.
+                size_t lut3DEdgeLen = 0;
             };
 
             //! This class provides an interface for writing.
@@ -402,6 +582,13 @@ namespace djv
                 //! - Core::FileSystem::Error
                 virtual std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions&) const;
 
+                //! Read a file as a tiled image. The default implementation
+                //! returns null for plugins that do not support tiled reads.
+                //!
+                //! Throws:
+                //! - Core::FileSystem::Error
+                virtual std::shared_ptr<Image::TiledImage> readTiled(const Core::FileSystem::FileInfo&, const ReadOptions&) const;
+
                 //! Throws:
                 //! - Core::FileSystem::Error
                 virtual std::shared_ptr<IWrite> write(const Core::FileSystem::FileInfo&, const Info&, const WriteOptions&) const;
@@ -449,6 +636,13 @@ namespace djv
                 //! - Core::FileSystem::Error
                 std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions& = ReadOptions());
 
+                //! Read a file as a tiled image. Only the file information is
+                //! read up front, the tiles are read when they are needed.
+                //!
+                //! Throws:
+                //! - Core::FileSystem::Error
+                std::shared_ptr<Image::TiledImage> readTiled(const Core::FileSystem::FileInfo&, const ReadOptions& = ReadOptions());
+
                 //! Throws:
                 //! - Core::FileSystem::Error
                 std::shared_ptr<IWrite> write(const Core::FileSystem::FileInfo&, const Info &, const WriteOptions& = WriteOptions());
@@ -133,6 +133,12 @@ namespace djv
                 return _queue.size() ? _queue.front() : VideoFrame();
             }
 
+            inline std::vector<VideoFrame> VideoQueue::getFrames(size_t value) const
+            {
+                const size_t size = std::min(value, _queue.size());
+                return std::vector<VideoFrame>(_queue.begin(), _queue.begin() + size);
+            }
+
             inline bool VideoQueue::isFinished() const
             {
                 return _finished;
@@ -258,7 +264,7 @@ namespace djv
             
             inline size_t Cache::getCount() const
             {
-                return _cache.size();
+                return _cache.size() + _compressedCache.size();
             }
 
             inline size_t Cache::getTotalByteCount() const
@@ -268,6 +274,31 @@ namespace djv
                 {
                     out += i.second->getDataByteCount();
                 }
+                return out + getCompressedByteCount();
+            }
+
+            inline size_t Cache::getCompressedCount() const
+            {
+                return _compressedCache.size();
+            }
+
+            inline size_t Cache::getCompressedDataByteCount() const
+            {
+                size_t out = 0;
+                for (const auto& i : _compressedCache)
+                {
+                    out += i.second->getDataByteCount();
+                }
+                return out;
+            }
+
+            inline size_t Cache::getCompressedByteCount() const
+            {
+                size_t out = 0;
+                for (const auto& i : _compressedCache)
+                {
+                    out += i.second->getCompressedByteCount();
+                }
                 return out;
             }
 
@@ -298,7 +329,8 @@ namespace djv
 
             inline bool Cache::contains(Core::Frame::Index value) const
             {
-                return _cache.find(value) != _cache.end();
+                return _cache.find(value) != _cache.end() ||
+                    _compressedCache.find(value) != _compressedCache.end();
             }
 
             inline bool Cache::get(Core::Frame::Index index, std::shared_ptr<AV::Image::Image>& out) const
@@ -312,9 +344,115 @@ namespace djv
                 return found;
             }
 
+            inline bool Cache::get(Core::Frame::Index index, std::shared_ptr<AV::Image::CompressedImage>& out) const
+            {
+                const auto i = _compressedCache.find(index);
+                const bool found = i != _compressedCache.end();
+                if (found)
+                {
+                    out = i->second;
+                }
+                return found;
+            }
+
             inline void Cache::clear()
             {
                 _cache.clear();
+                _compressedCache.clear();
+            }
+
+            inline CacheCompressionStats::CacheCompressionStats()
+            {}
+
+            inline float CacheCompressionStats::getRatio() const
+            {
+                return compressedByteCount > 0 ? (dataByteCount / static_cast<float>(compressedByteCount)) : 0.F;
+            }
+
+            inline bool CacheCompressionStats::operator == (const CacheCompressionStats& other) const
+            {
+                return
+                    frameCount == other.frameCount &&
+                    dataByteCount == other.dataByteCount &&
+                    compressedByteCount == other.compressedByteCount &&
+                    compressTime == other.compressTime &&
+                    decompressTime == other.decompressTime;
+            }
+
+            inline bool CacheCompressionStats::operator != (const CacheCompressionStats& other) const
+            {
+                return !(*this == other);
+            }
+
+            inline ThreadControllerState::ThreadControllerState()
+            {}
+
+            inline bool ThreadControllerState::operator == (const ThreadControllerState& other) const
+            {
+                return
+                    threadCount == other.threadCount &&
+                    threadMax == other.threadMax &&
+                    queueSize == other.queueSize &&
+                    decodeTime == other.decodeTime &&
+                    waitTime == other.waitTime &&
+                    starvedCount == other.starvedCount;
+            }
+
+            inline bool ThreadControllerState::operator != (const ThreadControllerState& other) const
+            {
+                return !(*this == other);
+            }
+
+            inline ThreadController::ThreadController()
+            {
+                _state.threadCount = _threadMax;
+                _state.queueSize = _queueSizeMin;
+            }
+
+            inline size_t ThreadController::getThreadMax() const
+            {
+                return _threadMax;
+            }
+
+            inline size_t ThreadController::getThreadCount() const
+            {
+                return _state.threadCount;
+            }
+
+            inline size_t ThreadController::getQueueSize() const
+            {
+                return _state.queueSize;
+            }
+
+            inline size_t ThreadController::getQueueSizeMin() const
+            {
+                return _queueSizeMin;
+            }
+
+            inline const ThreadControllerState& ThreadController::getState() const
+            {
+                return _state;
+            }
+
+            inline void ThreadController::setSpeed(float value)
+            {
+                _speed = value;
+            }
+
+            inline void ThreadController::addDecode(double value)
+            {
+                _decodeSum += value;
+                ++_decodeCount;
+            }
+
+            inline void ThreadController::addWait(double value)
+            {
+                _waitSum += value;
+            }
+
+            inline void ThreadController::addStarved()
+            {
+                ++_starved;
             }
 
         } // namespace IO
@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAV/ImageCompress.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            namespace
+            {
+                const size_t matchMin      = 4;
+                const size_t offsetMax     = 65535;
+                const size_t hashBits      = 16;
+                const size_t shuffleBlock  = 4096;
+                const size_t literalsMax   = 15;
+                const size_t matchCodeMax  = 15;
+
+                //! The LZ4 block format requires the last bytes of a block to
+                //! be literals, and the last match to start this many bytes
+                //! before the end.
+                const size_t lastLiterals  = 5;
+                const size_t matchStartEnd = 12;
+
+                inline uint32_t read32(const uint8_t* p)
+                {
+                    uint32_t out = 0;
+                    memcpy(&out, p, 4);
+                    return out;
+                }
+
+                inline size_t hash(uint32_t value)
+                {
+                    return (value * 2654435761U) >> (32 - hashBits);
+                }
+
+                inline uint8_t* writeLength(size_t value, uint8_t* out)
+                {
+                    for (; value >= 255; value -= 255)
+                    {
+                        *out++ = 255;
+                    }
+                    *out++ = static_cast<uint8_t>(value);
+                    return out;
+                }
+
+                inline bool readLength(const uint8_t*& p, const uint8_t* end, size_t& value)
+                {
+                    uint8_t b = 255;
+                    while (255 == b)
+                    {
+                        if (p >= end)
+                            return false;
+                        b = *p++;
+                        value += b;
+                    }
+                    return true;
+                }
+
+                uint8_t* writeSequence(
+                    const uint8_t* literals,
+                    size_t         literalCount,
+                    size_t         offset,
+                    size_t         matchCount,
+                    uint8_t*       out)
+                {
+                    uint8_t* token = out++;
+                    *token = static_cast<uint8_t>(std::min(literalCount, literalsMax) << 4);
+                    if (literalCount >= literalsMax)
+                    {
+                        out = writeLength(literalCount - literalsMax, out);
+                    }
+                    memcpy(out, literals, literalCount);
+                    out += literalCount;
+                    if (matchCount)
+                    {
+                        *out++ = static_cast<uint8_t>(offset & 0xff);
+                        *out++ = static_cast<uint8_t>(offset >> 8);
+                        const size_t matchCode = matchCount - matchMin;
+                        *token |= static_cast<uint8_t>(std::min(matchCode, matchCodeMax));
+                        if (matchCode >= matchCodeMax)
+                        {
+                            out = writeLength(matchCode - matchCodeMax, out);
+                        }
+                    }
+                    return out;
+                }
+
+            } // namespace
+
+            size_t compress(const uint8_t* in, size_t size, uint8_t* out)
+            {
+                std::vector<uint32_t> table(static_cast<size_t>(1) << hashBits, 0);
+                uint8_t* const outStart = out;
+                size_t anchor = 0;
+                size_t i = 0;
+                const size_t matchStartMax = size > matchStartEnd ? (size - matchStartEnd) : 0;
+                const size_t matchEnd = size > lastLiterals ? (size - lastLiterals) : 0;
+                while (size > matchStartEnd && i <= matchStartMax)
+                {
+                    const uint32_t value = read32(in + i);
+                    const size_t h = hash(value);
+                    const size_t ref = table[h];
+                    table[h] = static_cast<uint32_t>(i);
+                    if (ref < i && i - ref <= offsetMax && read32(in + ref) == value)
+                    {
+                        size_t matchCount = matchMin;
+                        while (i + matchCount < matchEnd && in[ref + matchCount] == in[i + matchCount])
+                        {
+                            ++matchCount;
+                        }
+                        out = writeSequence(in + anchor, i - anchor, i - ref, matchCount, out);
+                        i += matchCount;
+                        anchor = i;
+                    }
+                    else
+                    {
+                        // Skip ahead faster through data that does not
+                        // compress.
+                        i += 1 + ((i - anchor) >> 6);
+                    }
+                }
+                out = writeSequence(in + anchor, size - anchor, 0, 0, out);
+                return out - outStart;
+            }
+
+            bool decompress(const uint8_t* in, size_t size, uint8_t* out, size_t outSize)
+            {
+                const uint8_t* p = in;
+                const uint8_t* const end = in + size;
+                uint8_t* o = out;
+                uint8_t* const outEnd = out + outSize;
+                while (p < end)
+                {
+                    const uint8_t token = *p++;
+                    size_t literalCount = token >> 4;
+                    if (literalCount == literalsMax && !readLength(p, end, literalCount))
+                        return false;
+                    if (literalCount > static_cast<size_t>(end - p) ||
+                        literalCount > static_cast<size_t>(outEnd - o))
+                        return false;
+                    memcpy(o, p, literalCount);
+                    p += literalCount;
+                    o += literalCount;
+                    if (p == end)
+                        break;
+
+                    if (end - p < 2)
+                        return false;
+                    const size_t offset = p[0] | (p[1] << 8);
+                    p += 2;
+                    size_t matchCount = token & 0x0f;
+                    if (matchCount == matchCodeMax && !readLength(p, end, matchCount))
+                        return false;
+                    matchCount += matchMin;
+                    if (0 == offset ||
+                        offset > static_cast<size_t>(o - out) ||
+                        matchCount > static_cast<size_t>(outEnd - o))
+                        return false;
+                    const uint8_t* ref = o - offset;
+                    if (offset >= matchCount)
+                    {
+                        memcpy(o, ref, matchCount);
+                        o += matchCount;
+                    }
+                    else
+                    {
+                        // Overlapping matches repeat the last bytes, copy
+                        // them in blocks that double in size.
+                        while (matchCount > 0)
+                        {
+                            const size_t count = std::min(static_cast<size_t>(o - ref), matchCount);
+                            memcpy(o, ref, count);
+                            o += count;
+                            matchCount -= count;
+                        }
+                    }
+                }
+                return o == outEnd;
+            }
+
+            void shuffle(const uint8_t* in, size_t size, size_t stride, uint8_t* out)
+            {
+                // Work in blocks of pixels so the reads stay in the cache while
+                // each plane is written.
+                const size_t count = stride > 0 ? size / stride : 0;
+                for (size_t i = 0; i < count; i += shuffleBlock)
+                {
+                    const size_t end = std::min(i + shuffleBlock, count);
+                    for (size_t j = 0; j < stride; ++j)
+                    {
+                        const uint8_t* inP = in + j;
+                        uint8_t* outP = out + j * count;
+                        uint8_t prev = i > 0 ? inP[(i - 1) * stride] : 0;
+                        for (size_t k = i; k < end; ++k)
+                        {
+                            const uint8_t value = inP[k * stride];
+                            outP[k] = value - prev;
+                            prev = value;
+                        }
+                    }
+                }
+                memcpy(out + count * stride, in + count * stride, size - count * stride);
+            }
+
+            void unshuffle(const uint8_t* in, size_t size, size_t stride, uint8_t* out)
+            {
+                const size_t count = stride > 0 ? size / stride : 0;
+                std::vector<uint8_t> prev(stride, 0);
+                for (size_t i = 0; i < count; i += shuffleBlock)
+                {
+                    const size_t end = std::min(i + shuffleBlock, count);
+                    for (size_t j = 0; j < stride; ++j)
+                    {
+                        const uint8_t* inP = in + j * count;
+                        uint8_t* outP = out + j;
+                        uint8_t value = prev[j];
+                        for (size_t k = i; k < end; ++k)
+                        {
+                            value += inP[k];
+                            outP[k * stride] = value;
+                        }
+                        prev[j] = value;
+                    }
+                }
+                memcpy(out + count * stride, in + count * stride, size - count * stride);
+            }
+
+            void CompressedImage::_init(const std::shared_ptr<Image>& image)
+            {
+                _info = image->getInfo();
+                _pluginName = image->getPluginName();
+                _tags = image->getTags();
+
+                const size_t size = image->getDataByteCount();
+                const size_t stride = image->getPixelByteCount();
+                const size_t planeSize = stride > 0 ? size / stride : 0;
+                std::unique_ptr<uint8_t[]> tmp(new uint8_t[size]);
+                shuffle(image->getData(), size, stride, tmp.get());
+                std::vector<uint8_t> buf(getCompressBound(planeSize));
+                for (size_t i = 0; i < stride; ++i)
+                {
+                    const uint8_t* p = tmp.get() + i * planeSize;
+                    const size_t compressedSize = AV::Image::compress(p, planeSize, buf.data());
+                    Plane plane;
+                    if (compressedSize < planeSize)
+                    {
+                        plane.compressed = true;
+                        plane.data = std::vector<uint8_t>(buf.data(), buf.data() + compressedSize);
+                    }
+                    else
+                    {
+                        plane.data = std::vector<uint8_t>(p, p + planeSize);
+                    }
+                    _compressedByteCount += plane.data.size();
+                    _planes.push_back(std::move(plane));
+                }
+
+                // Store any remaining bytes as is.
+                Plane plane;
+                plane.data = std::vector<uint8_t>(tmp.get() + stride * planeSize, tmp.get() + size);
+                _compressedByteCount += plane.data.size();
+                _planes.push_back(std::move(plane));
+            }
+
+            std::shared_ptr<CompressedImage> CompressedImage::create(const std::shared_ptr<Image>& image)
+            {
+                auto out = std::shared_ptr<CompressedImage>(new CompressedImage);
+                out->_init(image);
+                return out;
+            }
+
+            std::shared_ptr<Image> CompressedImage::decompress() const
+            {
+                auto out = Image::create(_info);
+                out->setPluginName(_pluginName);
+                out->setTags(_tags);
+                const size_t size = out->getDataByteCount();
+                const size_t stride = out->getPixelByteCount();
+                const size_t planeSize = stride > 0 ? size / stride : 0;
+                if (_planes.size() != stride + 1)
+                {
+                    return nullptr;
+                }
+                std::unique_ptr<uint8_t[]> tmp(new uint8_t[size]);
+                for (size_t i = 0; i <= stride; ++i)
+                {
+                    const auto& plane = _planes[i];
+                    uint8_t* p = tmp.get() + i * planeSize;
+                    const size_t outSize = i < stride ? planeSize : (size - stride * planeSize);
+                    if (plane.compressed)
+                    {
+                        if (!AV::Image::decompress(plane.data.data(), plane.data.size(), p, outSize))
+                        {
+                            return nullptr;
+                        }
+                    }
+                    else
+                    {
+                        if (plane.data.size() != outSize)
+                        {
+                            return nullptr;
+                        }
+                        memcpy(p, plane.data.data(), outSize);
+                    }
+                }
+                unshuffle(tmp.get(), size, stride, out->getData());
+                return out;
+            }
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvAV/Image.h>
+
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            //! Get the maximum size of compressed data.
+            size_t getCompressBound(size_t);
+
+            //! Compress data with a fast LZ77 encoder using the LZ4 block
+            //! format, including the end of block rules (the last five bytes
+            //! are literals and the last match starts at least twelve bytes
+            //! before the end). The output must be at least
+            //! getCompressBound() bytes. Returns the size of the compressed
+            //! data.
+            size_t compress(const uint8_t* in, size_t size, uint8_t* out);
+
+            //! Decompress data. Returns false if the data is corrupt or does
+            //! not decompress to exactly the given output size.
+            bool decompress(const uint8_t* in, size_t size, uint8_t* out, size_t outSize);
+
+            //! Split data into byte planes, one for each byte of the given
+            //! stride, and delta encode each plane. Neighboring pixels are
+            //! often similar so this makes the data much easier to compress,
+            //! including floating point data.
+            void shuffle(const uint8_t* in, size_t size, size_t stride, uint8_t* out);
+
+            //! Reverse shuffle().
+            void unshuffle(const uint8_t* in, size_t size, size_t stride, uint8_t* out);
+
+            //! This class provides a losslessly compressed image for caching.
+            //! The image data is shuffle()'d and each byte plane is compressed
+            //! separately, so planes that do not compress (like the low bytes
+            //! of noisy floating point data) are stored as is.
+            class CompressedImage
+            {
+                DJV_NON_COPYABLE(CompressedImage);
+
+            protected:
+                void _init(const std::shared_ptr<Image>&);
+                CompressedImage();
+
+            public:
+                ~CompressedImage();
+
+                static std::shared_ptr<CompressedImage> create(const std::shared_ptr<Image>&);
+
+                const Info& getInfo() const;
+
+                //! Get the size of the uncompressed data.
+                size_t getDataByteCount() const;
+
+                //! Get the size of the compressed data.
+                size_t getCompressedByteCount() const;
+
+                //! Get the compression ratio (uncompressed / compressed).
+                float getRatio() const;
+
+                //! Decompress the image. Returns nullptr if the data is
+                //! corrupt.
+                std::shared_ptr<Image> decompress() const;
+
+            private:
+                struct Plane
+                {
+                    bool compressed = false;
+                    std::vector<uint8_t> data;
+                };
+
+                Info _info;
+                std::string _pluginName;
+                Tags _tags;
+                std::vector<Plane> _planes;
+                size_t _compressedByteCount = 0;
+            };
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
+
+#include <djvAV/ImageCompressInline.h>
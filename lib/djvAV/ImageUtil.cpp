@@ -32,6 +32,10 @@
 #include <djvAV/Color.h>
 #include <djvAV/ImageData.h>
 
+#include <djvCore/Math.h>
+
+#include <cmath>
+
 using namespace djv::Core;
 
 namespace djv
@@ -84,6 +88,202 @@ namespace djv
                     outP->b = average[2] / static_cast<float>(width * height);
                 }
 
+                //! This struct provides the filter contributions for one axis.
+                struct Weights
+                {
+                    size_t max = 0;
+                    std::vector<size_t> start;
+                    std::vector<size_t> count;
+                    std::vector<float> values;
+                };
+
+                Weights getWeights(uint16_t inSize, uint16_t outSize)
+                {
+                    Weights out;
+                    const float scale = inSize / static_cast<float>(outSize);
+                    const float filterScale = std::max(scale, 1.F);
+                    const float support = filterScale;
+                    out.max = static_cast<size_t>(std::ceil(support)) * 2 + 1;
+                    out.start.resize(outSize);
+                    out.count.resize(outSize);
+                    out.values.resize(outSize * out.max);
+                    for (uint16_t i = 0; i < outSize; ++i)
+                    {
+                        const float center = (i + .5F) * scale;
+                        const int min = std::max(static_cast<int>(center - support + .5F), 0);
+                        const int max = std::min(static_cast<int>(center + support + .5F), static_cast<int>(inSize));
+                        float* values = &out.values[i * out.max];
+                        float sum = 0.F;
+                        size_t count = 0;
+                        for (int j = min; j < max && count < out.max; ++j, ++count)
+                        {
+                            const float v = std::max(1.F - std::fabs((j - center + .5F) / filterScale), 0.F);
+                            values[count] = v;
+                            sum += v;
+                        }
+                        if (sum > 0.F)
+                        {
+                            for (size_t j = 0; j < count; ++j)
+                            {
+                                values[j] /= sum;
+                            }
+                        }
+                        out.start[i] = min;
+                        out.count[i] = count;
+                    }
+                    return out;
+                }
+
+                void swapEndian(uint8_t* data, size_t width, Type type)
+                {
+                    if (DataType::U10 == getDataType(type))
+                    {
+                        Memory::endian(data, width, 4);
+                    }
+                    else
+                    {
+                        const size_t byteCount = getByteCount(getDataType(type));
+                        if (byteCount > 1)
+                        {
+                            Memory::endian(data, width * getChannelCount(type), byteCount);
+                        }
+                    }
+                }
+
+                void mirrorX(float* data, size_t width, size_t channels)
+                {
+                    for (size_t i = 0; i < width / 2; ++i)
+                    {
+                        float* a = data + i * channels;
+                        float* b = data + (width - 1 - i) * channels;
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            std::swap(a[c], b[c]);
+                        }
+                    }
+                }
+
+                //! Average the blocks of pixels with a box filter. The blocks are
+                //! accumulated a scanline at a time so the inner loops can be
+                //! vectorized by the compiler.
+                template<typename T, typename T2>
+                void mipmap(const Data& in, Data& out, uint16_t factor)
+                {
+                    const uint16_t inW = in.getWidth();
+                    const uint16_t inH = in.getHeight();
+                    const uint16_t outW = out.getWidth();
+                    const uint16_t outH = out.getHeight();
+                    const size_t channels = getChannelCount(in.getType());
+                    std::vector<T2> sum(outW * channels);
+                    std::vector<T2> count(outW);
+                    for (uint16_t x = 0; x < outW; ++x)
+                    {
+                        count[x] = static_cast<T2>(std::min(factor, static_cast<uint16_t>(inW - x * factor)));
+                    }
+                    for (uint16_t y = 0; y < outH; ++y)
+                    {
+                        std::fill(sum.begin(), sum.end(), T2(0));
+                        const uint16_t y0 = y * factor;
+                        const uint16_t y1 = std::min(static_cast<uint16_t>(y0 + factor), inH);
+                        for (uint16_t inY = y0; inY < y1; ++inY)
+                        {
+                            const T* inP = reinterpret_cast<const T*>(in.getData(inY));
+                            T2* sumP = sum.data();
+                            for (uint16_t x = 0; x < outW; ++x, sumP += channels)
+                            {
+                                const size_t w = static_cast<size_t>(count[x]) * channels;
+                                for (size_t i = 0; i < w; i += channels)
+                                {
+                                    for (size_t c = 0; c < channels; ++c)
+                                    {
+                                        sumP[c] += static_cast<T2>(inP[i + c]);
+                                    }
+                                }
+                                inP += w;
+                            }
+                        }
+                        const T2 rows = static_cast<T2>(y1 - y0);
+                        T* outP = reinterpret_cast<T*>(out.getData(y));
+                        const T2* sumP = sum.data();
+                        for (uint16_t x = 0; x < outW; ++x, sumP += channels, outP += channels)
+                        {
+                            const T2 n = count[x] * rows;
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                outP[c] = static_cast<T>((sumP[c] + n / 2) / n);
+                            }
+                        }
+                    }
+                }
+
+                template<typename T>
+                void mipmapFloat(const Data& in, Data& out, uint16_t factor)
+                {
+                    const uint16_t inW = in.getWidth();
+                    const uint16_t inH = in.getHeight();
+                    const uint16_t outW = out.getWidth();
+                    const uint16_t outH = out.getHeight();
+                    const size_t channels = getChannelCount(in.getType());
+                    std::vector<float> sum(outW * channels);
+                    std::vector<float> count(outW);
+                    for (uint16_t x = 0; x < outW; ++x)
+                    {
+                        count[x] = static_cast<float>(std::min(factor, static_cast<uint16_t>(inW - x * factor)));
+                    }
+                    for (uint16_t y = 0; y < outH; ++y)
+                    {
+                        std::fill(sum.begin(), sum.end(), 0.F);
+                        const uint16_t y0 = y * factor;
+                        const uint16_t y1 = std::min(static_cast<uint16_t>(y0 + factor), inH);
+                        for (uint16_t inY = y0; inY < y1; ++inY)
+                        {
+                            const T* inP = reinterpret_cast<const T*>(in.getData(inY));
+                            float* sumP = sum.data();
+                            for (uint16_t x = 0; x < outW; ++x, sumP += channels)
+                            {
+                                const size_t w = static_cast<size_t>(count[x]) * channels;
+                                for (size_t i = 0; i < w; i += channels)
+                                {
+                                    for (size_t c = 0; c < channels; ++c)
+                                    {
+                                        sumP[c] += static_cast<float>(inP[i + c]);
+                                    }
+                                }
+                                inP += w;
+                            }
+                        }
+                        const float rows = static_cast<float>(y1 - y0);
+                        T* outP = reinterpret_cast<T*>(out.getData(y));
+                        const float* sumP = sum.data();
+                        for (uint16_t x = 0; x < outW; ++x, sumP += channels, outP += channels)
+                        {
+                            const float n = 1.F / (count[x] * rows);
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                outP[c] = static_cast<T>(sumP[c] * n);
+                            }
+                        }
+                    }
+                }
+
+                void mipmapPointSample(const Data& in, Data& out, uint16_t factor)
+                {
+                    const size_t pixelByteCount = in.getPixelByteCount();
+                    const uint16_t outW = out.getWidth();
+                    const uint16_t outH = out.getHeight();
+                    for (uint16_t y = 0; y < outH; ++y)
+                    {
+                        const uint8_t* inP = in.getData(y * factor);
+                        uint8_t* outP = out.getData(y);
+                        for (uint16_t x = 0; x < outW; ++x)
+                        {
+                            memcpy(outP, inP, pixelByteCount);
+                            inP += pixelByteCount * factor;
+                            outP += pixelByteCount;
+                        }
+                    }
+                }
+
             } // namespace
 
             Color getAverageColor(const std::shared_ptr<Data>& data)
@@ -111,6 +311,134 @@ namespace djv
                 return out;
             }
 
+            void resize(const Data& in, Data& out)
+            {
+                const Info& inInfo = in.getInfo();
+                const Info& outInfo = out.getInfo();
+                if (!inInfo.isValid() || !outInfo.isValid())
+                    return;
+                const uint16_t inW = inInfo.size.w;
+                const uint16_t inH = inInfo.size.h;
+                const uint16_t outW = outInfo.size.w;
+                const uint16_t outH = outInfo.size.h;
+                const size_t channels = getChannelCount(inInfo.type);
+                const Type floatType = getFloatType(channels, 32);
+                const bool inEndian = inInfo.layout.endian != Memory::getEndian();
+                const bool outEndian = outInfo.layout.endian != Memory::getEndian();
+                const Weights xWeights = getWeights(inW, outW);
+                const Weights yWeights = getWeights(inH, outH);
+
+                // Filter the scanlines horizontally.
+                std::vector<uint8_t> scanline(inEndian ? in.getScanlineByteCount() : 0);
+                std::vector<float> inRow(inW * channels);
+                std::vector<float> tmp(static_cast<size_t>(inH) * outW * channels);
+                for (uint16_t y = 0; y < inH; ++y)
+                {
+                    const uint16_t inY = inInfo.layout.mirror.y ? (inH - 1 - y) : y;
+                    const uint8_t* p = in.getData(inY);
+                    if (inEndian)
+                    {
+                        memcpy(scanline.data(), p, scanline.size());
+                        swapEndian(scanline.data(), inW, inInfo.type);
+                        p = scanline.data();
+                    }
+                    convert(p, inInfo.type, inRow.data(), floatType, inW);
+                    if (inInfo.layout.mirror.x)
+                    {
+                        mirrorX(inRow.data(), inW, channels);
+                    }
+                    float* tmpP = &tmp[static_cast<size_t>(y) * outW * channels];
+                    for (uint16_t x = 0; x < outW; ++x, tmpP += channels)
+                    {
+                        const float* w = &xWeights.values[x * xWeights.max];
+                        const float* inP = &inRow[xWeights.start[x] * channels];
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            tmpP[c] = 0.F;
+                        }
+                        for (size_t i = 0; i < xWeights.count[x]; ++i, inP += channels)
+                        {
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                tmpP[c] += inP[c] * w[i];
+                            }
+                        }
+                    }
+                }
+
+                // Filter the columns vertically and convert to the output type.
+                std::vector<float> outRow(outW * channels);
+                for (uint16_t y = 0; y < outH; ++y)
+                {
+                    const float* w = &yWeights.values[y * yWeights.max];
+                    std::fill(outRow.begin(), outRow.end(), 0.F);
+                    for (size_t i = 0; i < yWeights.count[y]; ++i)
+                    {
+                        const float* tmpP = &tmp[(yWeights.start[y] + i) * outW * channels];
+                        const float v = w[i];
+                        for (size_t j = 0; j < outRow.size(); ++j)
+                        {
+                            outRow[j] += tmpP[j] * v;
+                        }
+                    }
+                    if (outInfo.layout.mirror.x)
+                    {
+                        mirrorX(outRow.data(), outW, channels);
+                    }
+                    if (isIntType(outInfo.type))
+                    {
+                        for (auto& j : outRow)
+                        {
+                            j = Math::clamp(j, 0.F, 1.F);
+                        }
+                    }
+                    uint8_t* outP = out.getData(outInfo.layout.mirror.y ? (outH - 1 - y) : y);
+                    convert(outRow.data(), floatType, outP, outInfo.type, outW);
+                    if (outEndian)
+                    {
+                        swapEndian(outP, outW, outInfo.type);
+                    }
+                }
+            }
+
+            Size getMipmapSize(const Size& value, uint8_t level)
+            {
+                return Size(
+                    std::max(value.w >> level, 1),
+                    std::max(value.h >> level, 1));
+            }
+
+            void mipmap(const Data& in, Data& out, uint8_t level)
+            {
+                const Info& inInfo = in.getInfo();
+                const Info& outInfo = out.getInfo();
+                if (!inInfo.isValid() ||
+                    outInfo.type != inInfo.type ||
+                    outInfo.layout != inInfo.layout ||
+                    outInfo.size != getMipmapSize(inInfo.size, level))
+                    return;
+                if (0 == level)
+                {
+                    memcpy(out.getData(), in.getData(), std::min(in.getDataByteCount(), out.getDataByteCount()));
+                    return;
+                }
+                const uint16_t factor = 1 << level;
+                if (inInfo.layout.endian != Memory::getEndian())
+                {
+                    mipmapPointSample(in, out, factor);
+                    return;
+                }
+                switch (getDataType(inInfo.type))
+                {
+                case DataType::U8:  mipmap<U8_T,  uint32_t>(in, out, factor); break;
+                case DataType::U16: mipmap<U16_T, uint64_t>(in, out, factor); break;
+                case DataType::U32: mipmap<U32_T, uint64_t>(in, out, factor); break;
+                case DataType::F16: mipmapFloat<F16_T>(in, out, factor); break;
+                case DataType::F32: mipmapFloat<F32_T>(in, out, factor); break;
+                default: mipmapPointSample(in, out, factor); break;
+                }
+            }
+
         } // namespace Image
     } // namespace AV
 } // namespace djv
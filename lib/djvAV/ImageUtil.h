@@ -41,9 +41,26 @@ namespace djv
         {
             class Color;
             class Data;
+            class Size;
 
             Color getAverageColor(const std::shared_ptr<Data>&);
 
+            //! Resize image data on the CPU. The input is filtered with a
+            //! triangle filter that is widened when downsizing, which gives
+            //! good quality results for thumbnails and doesn't require an
+            //! OpenGL context. The output size, type, and layout are taken
+            //! from the output data.
+            void resize(const Data& in, Data& out);
+
+            //! Get the size of a mipmap level.
+            Size getMipmapSize(const Size&, uint8_t level);
+
+            //! Reduce image data to a mipmap level with a box filter. The
+            //! output must have the same type and layout as the input and the
+            //! size given by getMipmapSize(). Packed and byte swapped data is
+            //! point sampled.
+            void mipmap(const Data& in, Data& out, uint8_t level);
+
         } // namespace Image
     } // namespace AV
 } // namespace djv
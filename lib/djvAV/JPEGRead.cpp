@@ -169,6 +169,7 @@ namespace djv
                     bool jpegOpen(
                         FILE *                   f,
                         jpeg_decompress_struct * jpeg,
+                        unsigned int             scaleDenom,
                         JPEGErrorStruct *        error)
                     {
                         if (::setjmp(error->jump))
@@ -181,6 +182,8 @@ namespace djv
                         {
                             return false;
                         }
+                        jpeg->scale_num = 1;
+                        jpeg->scale_denom = scaleDenom;
                         if (!jpeg_start_decompress(jpeg))
                         {
                             return false;
@@ -207,7 +210,9 @@ namespace djv
                     {
                         throw FileSystem::Error(DJV_TEXT("error_file_open"));
                     }
-                    if (!jpegOpen(f.f, &f.jpeg, &f.jpegError))
+                    // Use the libjpeg DCT scaling for proxies (1/2, 1/4, or 1/8).
+                    const unsigned int scaleDenom = 1 << std::min(_options.proxy, static_cast<size_t>(3));
+                    if (!jpegOpen(f.f, &f.jpeg, scaleDenom, &f.jpegError))
                     {
                         throw FileSystem::Error(f.jpegError.msg);
                     }
@@ -0,0 +1,297 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAV/OCIOProcessor.h>
+
+#include <djvAV/ImageData.h>
+
+#include <djvCore/Math.h>
+#include <djvCore/Memory.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+using namespace djv::Core;
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace OCIO
+        {
+            namespace
+            {
+                void swapEndian(uint8_t* data, size_t width, Image::Type type)
+                {
+                    if (Image::DataType::U10 == Image::getDataType(type))
+                    {
+                        Memory::endian(data, width, 4);
+                    }
+                    else
+                    {
+                        const size_t byteCount = Image::getByteCount(Image::getDataType(type));
+                        if (byteCount > 1)
+                        {
+                            Memory::endian(data, width * Image::getChannelCount(type), byteCount);
+                        }
+                    }
+                }
+
+                //! Expand pixels with the given number of channels to RGBA.
+                void toRGBA(const float* in, size_t channels, size_t width, float* out)
+                {
+                    for (size_t i = 0; i < width; ++i, in += channels, out += 4)
+                    {
+                        switch (channels)
+                        {
+                        case 1: out[0] = out[1] = out[2] = in[0]; out[3] = 1.F; break;
+                        case 2: out[0] = out[1] = out[2] = in[0]; out[3] = in[1]; break;
+                        case 3: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = 1.F; break;
+                        case 4: out[0] = in[0]; out[1] = in[1]; out[2] = in[2]; out[3] = in[3]; break;
+                        default: break;
+                        }
+                    }
+                }
+
+                //! Reduce RGBA pixels to the given number of channels. Luminance
+                //! images use the red channel.
+                void fromRGBA(const float* in, size_t channels, size_t width, float* out)
+                {
+                    for (size_t i = 0; i < width; ++i, in += 4, out += channels)
+                    {
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            out[c] = in[2 == channels && 1 == c ? 3 : c];
+                        }
+                    }
+                }
+
+            } // namespace
+
+            struct Processor::Private
+            {
+                Convert convert;
+                size_t lut3DEdgeLen = 0;
+                size_t threadCount = 1;
+                _OCIO::ConstProcessorRcPtr processor;
+                std::vector<float> lut3D;
+
+                void applyLUT3D(float*, size_t pixelCount) const;
+            };
+
+            void Processor::_init(const Convert& convert, size_t lut3DEdgeLen)
+            {
+                DJV_PRIVATE_PTR();
+                p.convert = convert;
+                p.lut3DEdgeLen = lut3DEdgeLen;
+                p.threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+
+                auto config = _OCIO::GetCurrentConfig();
+                p.processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+
+                if (lut3DEdgeLen > 1)
+                {
+                    // Bake the conversion by running the lattice points through
+                    // the processor, red varies fastest.
+                    const size_t size = lut3DEdgeLen * lut3DEdgeLen * lut3DEdgeLen;
+                    p.lut3D.resize(size * 3);
+                    float* lutP = p.lut3D.data();
+                    const float s = 1.F / static_cast<float>(lut3DEdgeLen - 1);
+                    for (size_t b = 0; b < lut3DEdgeLen; ++b)
+                    {
+                        for (size_t g = 0; g < lut3DEdgeLen; ++g)
+                        {
+                            for (size_t r = 0; r < lut3DEdgeLen; ++r, lutP += 3)
+                            {
+                                lutP[0] = r * s;
+                                lutP[1] = g * s;
+                                lutP[2] = b * s;
+                            }
+                        }
+                    }
+                    _OCIO::PackedImageDesc desc(p.lut3D.data(), static_cast<long>(size), 1, 3);
+                    p.processor->apply(desc);
+                }
+            }
+
+            Processor::Processor() :
+                _p(new Private)
+            {}
+
+            Processor::~Processor()
+            {}
+
+            std::shared_ptr<Processor> Processor::create(const Convert& convert, size_t lut3DEdgeLen)
+            {
+                auto out = std::shared_ptr<Processor>(new Processor);
+                out->_init(convert, lut3DEdgeLen);
+                return out;
+            }
+
+            const Convert& Processor::getConvert() const
+            {
+                return _p->convert;
+            }
+
+            size_t Processor::getLUT3DEdgeLen() const
+            {
+                return _p->lut3DEdgeLen;
+            }
+
+            size_t Processor::getThreadCount() const
+            {
+                return _p->threadCount;
+            }
+
+            void Processor::setThreadCount(size_t value)
+            {
+                _p->threadCount = std::max(value, size_t(1));
+            }
+
+            void Processor::apply(Image::Data& data) const
+            {
+                DJV_PRIVATE_PTR();
+                const Image::Info& info = data.getInfo();
+                if (!info.isValid())
+                    return;
+                const uint16_t w = info.size.w;
+                const uint16_t h = info.size.h;
+                const size_t channels = Image::getChannelCount(info.type);
+                const Image::Type floatType = Image::getFloatType(channels, 32);
+                const bool endian = info.layout.endian != Memory::getEndian();
+                const bool intType = Image::isIntType(info.type);
+
+                // Split the scanlines into bands that are converted in parallel.
+                const size_t bandCount = std::min(p.threadCount, static_cast<size_t>(h));
+                const size_t bandSize = (h + bandCount - 1) / bandCount;
+                std::vector<std::future<void> > futures;
+                for (size_t band = 0; band < bandCount; ++band)
+                {
+                    const uint16_t y0 = static_cast<uint16_t>(band * bandSize);
+                    const uint16_t y1 = static_cast<uint16_t>(std::min(y0 + bandSize, static_cast<size_t>(h)));
+                    futures.push_back(std::async(
+                        std::launch::async,
+                        [this, &data, w, y0, y1, channels, floatType, endian, intType]
+                        {
+                            const Image::Type type = data.getType();
+                            std::vector<float> row(w * channels);
+                            std::vector<float> rgba(w * 4);
+                            for (uint16_t y = y0; y < y1; ++y)
+                            {
+                                uint8_t* p = data.getData(y);
+                                if (endian)
+                                {
+                                    swapEndian(p, w, type);
+                                }
+                                Image::convert(p, type, row.data(), floatType, w);
+                                toRGBA(row.data(), channels, w, rgba.data());
+                                apply(rgba.data(), w);
+                                fromRGBA(rgba.data(), channels, w, row.data());
+                                if (intType)
+                                {
+                                    for (auto& i : row)
+                                    {
+                                        i = Math::clamp(i, 0.F, 1.F);
+                                    }
+                                }
+                                Image::convert(row.data(), floatType, p, type, w);
+                                if (endian)
+                                {
+                                    swapEndian(p, w, type);
+                                }
+                            }
+                        }));
+                }
+                for (auto& i : futures)
+                {
+                    i.get();
+                }
+            }
+
+            void Processor::apply(float* data, size_t pixelCount) const
+            {
+                DJV_PRIVATE_PTR();
+                if (p.lut3D.size())
+                {
+                    p.applyLUT3D(data, pixelCount);
+                }
+                else
+                {
+                    _OCIO::PackedImageDesc desc(data, static_cast<long>(pixelCount), 1, 4);
+                    p.processor->apply(desc);
+                }
+            }
+
+            void Processor::Private::applyLUT3D(float* data, size_t pixelCount) const
+            {
+                const size_t edgeLen = lut3DEdgeLen;
+                const float max = static_cast<float>(edgeLen - 1);
+                const size_t strideG = edgeLen * 3;
+                const size_t strideB = edgeLen * edgeLen * 3;
+                const float* lutP = lut3D.data();
+                for (size_t i = 0; i < pixelCount; ++i, data += 4)
+                {
+                    // Trilinear interpolation between the surrounding lattice points.
+                    const float r = Math::clamp(data[0], 0.F, 1.F) * max;
+                    const float g = Math::clamp(data[1], 0.F, 1.F) * max;
+                    const float b = Math::clamp(data[2], 0.F, 1.F) * max;
+                    const size_t r0 = std::min(static_cast<size_t>(r), edgeLen - 2);
+                    const size_t g0 = std::min(static_cast<size_t>(g), edgeLen - 2);
+                    const size_t b0 = std::min(static_cast<size_t>(b), edgeLen - 2);
+                    const float fr = r - r0;
+                    const float fg = g - g0;
+                    const float fb = b - b0;
+                    const float* p000 = lutP + b0 * strideB + g0 * strideG + r0 * 3;
+                    const float* p100 = p000 + 3;
+                    const float* p010 = p000 + strideG;
+                    const float* p110 = p010 + 3;
+                    const float* p001 = p000 + strideB;
+                    const float* p101 = p001 + 3;
+                    const float* p011 = p001 + strideG;
+                    const float* p111 = p011 + 3;
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        const float c00 = p000[c] + (p100[c] - p000[c]) * fr;
+                        const float c10 = p010[c] + (p110[c] - p010[c]) * fr;
+                        const float c01 = p001[c] + (p101[c] - p001[c]) * fr;
+                        const float c11 = p011[c] + (p111[c] - p011[c]) * fr;
+                        const float c0 = c00 + (c10 - c00) * fg;
+                        const float c1 = c01 + (c11 - c01) * fg;
+                        data[c] = c0 + (c1 - c0) * fb;
+                    }
+                }
+            }
+
+        } // namespace OCIO
+    } // namespace AV
+} // namespace djv
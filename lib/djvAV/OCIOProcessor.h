@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <djvAV/OCIO.h>
+
+#include <djvCore/Core.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            class Data;
+
+        } // namespace Image
+
+        namespace OCIO
+        {
+            //! This class provides color space conversion on the CPU. The image
+            //! data is split into bands of scanlines that are converted in
+            //! parallel.
+            class Processor
+            {
+                DJV_NON_COPYABLE(Processor);
+
+            protected:
+                void _init(const Convert&, size_t lut3DEdgeLen);
+                Processor();
+
+            public:
+                ~Processor();
+
+                //! Create a new processor. When the 3D LUT edge length is
+                //! non-zero the conversion is baked into a 3D LUT, which is
+                //! faster but only accurate for values between zero and one.
+                //! Throws:
+                //! - std::exception
+                static std::shared_ptr<Processor> create(const Convert&, size_t lut3DEdgeLen = 0);
+
+                const Convert& getConvert() const;
+                size_t getLUT3DEdgeLen() const;
+
+                size_t getThreadCount() const;
+                void setThreadCount(size_t);
+
+                //! Convert the image data in place.
+                void apply(Image::Data&) const;
+
+                //! Convert RGBA floating point pixels in place on the calling thread.
+                void apply(float*, size_t pixelCount) const;
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace OCIO
+    } // namespace AV
+} // namespace djv
@@ -601,6 +601,26 @@ namespace djv
                         glm::ivec2(channel.xSampling, channel.ySampling));
                 }
 
+                Image::Type getImageType(const Layer& layer)
+                {
+                    Image::Type out = Image::Type::None;
+                    if (layer.channels.size())
+                    {
+                        switch (layer.channels[0].type)
+                        {
+                        case Image::DataType::F16:
+                        case Image::DataType::F32:
+                            out = Image::getFloatType(layer.channels.size(), Image::getBitDepth(layer.channels[0].type));
+                            break;
+                        case Image::DataType::U32:
+                            out = Image::getIntType(layer.channels.size(), Image::getBitDepth(layer.channels[0].type));
+                            break;
+                        default: break;
+                        }
+                    }
+                    return out;
+                }
+
                 struct Plugin::Private
                 {
                     Options options;
@@ -639,6 +659,11 @@ namespace djv
                     return Read::create(fileInfo, options, _p->options, _resourceSystem, _logSystem);
                 }
 
+                std::shared_ptr<Image::TiledImage> Plugin::readTiled(const FileSystem::FileInfo& fileInfo, const ReadOptions& options) const
+                {
+                    return OpenEXR::readTiled(fileInfo.getFileName(), options, _p->options);
+                }
+
                 std::shared_ptr<IWrite> Plugin::write(const FileSystem::FileInfo& fileInfo, const Info & info, const WriteOptions& options) const
                 {
                     return Write::create(fileInfo, info, options, _p->options, _resourceSystem, _logSystem);
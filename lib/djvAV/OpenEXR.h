@@ -30,6 +30,7 @@
 #pragma once
 
 #include <djvAV/SequenceIO.h>
+#include <djvAV/TiledImage.h>
 
 #include <djvCore/BBox.h>
 
@@ -51,7 +52,6 @@ namespace djv
             //! - http://www.openexr.com
             //!
             //! \todo Add support for writing luminance/chroma images.
-            //! \todo Add better support for tiled images.
             namespace OpenEXR
             {
                 static const std::string pluginName = "OpenEXR";
@@ -144,6 +144,9 @@ namespace djv
                 //! Convert from an Imf channel.
                 Channel fromImf(const std::string& name, const Imf::Channel&);
 
+                //! Get the image type for a layer.
+                Image::Type getImageType(const Layer&);
+
                 //! This struct provides the OpenEXR file I/O optioms.
                 struct Options
                 {
@@ -201,6 +204,16 @@ namespace djv
                     DJV_PRIVATE();
                 };
                 
+                //! Read a file as a tiled image. Tiled files are read with the
+                //! file tiles, and scanline files are read a tile row at a time.
+                //!
+                //! Throws:
+                //! - Core::FileSystem::Error
+                std::shared_ptr<Image::TiledImage> readTiled(
+                    const std::string& fileName,
+                    const ReadOptions&,
+                    const Options&);
+
                 //! This class provides the OpenEXR file writer.
                 class Write : public ISequenceWrite
                 {
@@ -244,6 +257,7 @@ namespace djv
                     void setOptions(const picojson::value &) override;
 
                     std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
+                    std::shared_ptr<Image::TiledImage> readTiled(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
                     std::shared_ptr<IWrite> write(const Core::FileSystem::FileInfo&, const Info &, const WriteOptions&) const override;
 
                 private:
@@ -36,6 +36,10 @@
 #include <ImfHeader.h>
 #include <ImfInputFile.h>
 #include <ImfRgbaYca.h>
+#include <ImfTiledInputFile.h>
+
+#include <limits>
+#include <mutex>
 
 using namespace djv::Core;
 
@@ -233,6 +237,203 @@ namespace djv
                     return out;
                 }
 
+                namespace
+                {
+                    //! This struct provides a file that tiles are read from.
+                    //! The file is kept open for the lifetime of the tiled
+                    //! image.
+                    struct TiledFile
+                    {
+                        std::mutex                              mutex;
+                        std::unique_ptr<MemoryMappedIStream>    s;
+                        std::unique_ptr<Imf::InputFile>         f;
+                        std::unique_ptr<Imf::TiledInputFile>    tiled;
+                        glm::ivec2                              fileTileSize;
+                        BBox2i                                  displayWindow;
+                        BBox2i                                  dataWindow;
+                        OpenEXR::Layer                          layer;
+                    };
+
+                    std::shared_ptr<Image::Image> readTile(
+                        TiledFile& f,
+                        const Image::TiledInfo& info,
+                        uint32_t column,
+                        uint32_t row)
+                    {
+                        auto out = Image::Image::create(info.getTileInfo(column, row));
+                        out->setPluginName(pluginName);
+                        out->zero();
+                        const auto& tileInfo = out->getInfo();
+                        const size_t channels = Image::getChannelCount(tileInfo.type);
+                        const size_t channelByteCount = Image::getByteCount(Image::getDataType(tileInfo.type));
+                        const size_t cb = channels * channelByteCount;
+
+                        // Find the part of the tile that has data.
+                        const BBox2i tile(
+                            f.displayWindow.min.x + static_cast<int>(column * info.tileSize.w),
+                            f.displayWindow.min.y + static_cast<int>(row * info.tileSize.h),
+                            tileInfo.size.w,
+                            tileInfo.size.h);
+                        const BBox2i r = tile.intersect(f.dataWindow);
+                        if (r.min.x > r.max.x || r.min.y > r.max.y)
+                            return out;
+
+                        std::lock_guard<std::mutex> lock(f.mutex);
+                        if (f.tiled)
+                        {
+                            // Read the file tiles that cover the tile.
+                            const int dx0 = (r.min.x - f.dataWindow.min.x) / f.fileTileSize.x;
+                            const int dx1 = (r.max.x - f.dataWindow.min.x) / f.fileTileSize.x;
+                            const int dy0 = (r.min.y - f.dataWindow.min.y) / f.fileTileSize.y;
+                            const int dy1 = (r.max.y - f.dataWindow.min.y) / f.fileTileSize.y;
+                            const BBox2i b(
+                                glm::ivec2(
+                                    f.dataWindow.min.x + dx0 * f.fileTileSize.x,
+                                    f.dataWindow.min.y + dy0 * f.fileTileSize.y),
+                                glm::ivec2(
+                                    std::min(f.dataWindow.min.x + (dx1 + 1) * f.fileTileSize.x - 1, f.dataWindow.max.x),
+                                    std::min(f.dataWindow.min.y + (dy1 + 1) * f.fileTileSize.y - 1, f.dataWindow.max.y)));
+                            const size_t scb = b.w() * cb;
+                            std::vector<char> buf(b.h() * scb);
+                            Imf::FrameBuffer frameBuffer;
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                frameBuffer.insert(
+                                    f.layer.channels[c].name.c_str(),
+                                    Imf::Slice(
+                                        toImf(Image::getDataType(tileInfo.type)),
+                                        buf.data() - (b.min.x * cb) - (b.min.y * scb) + (c * channelByteCount),
+                                        cb,
+                                        scb,
+                                        1,
+                                        1,
+                                        0.F));
+                            }
+                            f.tiled->setFrameBuffer(frameBuffer);
+                            f.tiled->readTiles(dx0, dx1, dy0, dy1);
+                            for (int y = r.min.y; y <= r.max.y; ++y)
+                            {
+                                memcpy(
+                                    out->getData(r.min.x - tile.min.x, y - tile.min.y),
+                                    buf.data() + (y - b.min.y) * scb + (r.min.x - b.min.x) * cb,
+                                    r.w() * cb);
+                            }
+                        }
+                        else
+                        {
+                            // Read the scanlines that cover the tile.
+                            std::vector<char> buf(f.dataWindow.w() * cb);
+                            Imf::FrameBuffer frameBuffer;
+                            for (size_t c = 0; c < channels; ++c)
+                            {
+                                frameBuffer.insert(
+                                    f.layer.channels[c].name.c_str(),
+                                    Imf::Slice(
+                                        toImf(Image::getDataType(tileInfo.type)),
+                                        buf.data() - (f.dataWindow.min.x * cb) + (c * channelByteCount),
+                                        cb,
+                                        0,
+                                        1,
+                                        1,
+                                        0.F));
+                            }
+                            f.f->setFrameBuffer(frameBuffer);
+                            for (int y = r.min.y; y <= r.max.y; ++y)
+                            {
+                                f.f->readPixels(y, y);
+                                memcpy(
+                                    out->getData(r.min.x - tile.min.x, y - tile.min.y),
+                                    buf.data() + (r.min.x - f.dataWindow.min.x) * cb,
+                                    r.w() * cb);
+                            }
+                        }
+                        return out;
+                    }
+
+                } // namespace
+
+                std::shared_ptr<Image::TiledImage> readTiled(
+                    const std::string& fileName,
+                    const ReadOptions& readOptions,
+                    const Options& options)
+                {
+                    auto f = std::make_shared<TiledFile>();
+
+                    // Open the file, and re-open it for reading tiles if it
+                    // is tiled.
+#if defined(DJV_MMAP)
+                    f->s.reset(new MemoryMappedIStream(fileName.c_str()));
+                    f->f.reset(new Imf::InputFile(*f->s.get()));
+#else // DJV_MMAP
+                    f->f.reset(new Imf::InputFile(fileName.c_str()));
+#endif // DJV_MMAP
+                    const Imf::Header header = f->f->header();
+                    if (header.hasTileDescription())
+                    {
+                        f->f.reset();
+#if defined(DJV_MMAP)
+                        f->s.reset(new MemoryMappedIStream(fileName.c_str()));
+                        f->tiled.reset(new Imf::TiledInputFile(*f->s.get()));
+#else // DJV_MMAP
+                        f->tiled.reset(new Imf::TiledInputFile(fileName.c_str()));
+#endif // DJV_MMAP
+                        f->fileTileSize.x = header.tileDescription().xSize;
+                        f->fileTileSize.y = header.tileDescription().ySize;
+                    }
+                    f->displayWindow = fromImath(header.displayWindow());
+                    f->dataWindow = fromImath(header.dataWindow());
+
+                    // Get the layer.
+                    const auto layers = getLayers(header.channels(), options.channels);
+                    if (!layers.size())
+                    {
+                        throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
+                    }
+                    f->layer = layers[std::min(readOptions.layer, layers.size() - 1)];
+                    for (const auto& i : f->layer.channels)
+                    {
+                        if (i.sampling.x != 1 || i.sampling.y != 1)
+                        {
+                            throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
+                        }
+                    }
+
+                    Image::TiledInfo info;
+                    info.name = f->layer.name;
+                    info.width = static_cast<uint32_t>(f->displayWindow.w());
+                    info.height = static_cast<uint32_t>(f->displayWindow.h());
+                    if (f->tiled)
+                    {
+                        // Use a multiple of the file tile size so that each
+                        // file tile is only read once.
+                        info.tileSize.w = static_cast<uint16_t>(std::min(
+                            std::max(Image::tileSizeDefault / f->fileTileSize.x, 1) * f->fileTileSize.x,
+                            static_cast<int>(std::numeric_limits<uint16_t>::max())));
+                        info.tileSize.h = static_cast<uint16_t>(std::min(
+                            std::max(Image::tileSizeDefault / f->fileTileSize.y, 1) * f->fileTileSize.y,
+                            static_cast<int>(std::numeric_limits<uint16_t>::max())));
+                    }
+                    info.pixelAspectRatio = header.pixelAspectRatio();
+                    info.type = getImageType(f->layer);
+                    if (Image::Type::None == info.type)
+                    {
+                        throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
+                    }
+
+                    auto out = Image::TiledImage::create(
+                        info,
+                        [f, info](uint32_t column, uint32_t row)
+                        {
+                            return readTile(*f, info, column, row);
+                        });
+                    out->setPluginName(pluginName);
+                    Tags tags;
+                    Time::Speed speed;
+                    readTags(header, tags, speed);
+                    out->setTags(tags);
+                    return out;
+                }
+
                 Info Read::_open(const std::string & fileName, File & f)
                 {
                     DJV_PRIVATE_PTR();
@@ -271,17 +472,7 @@ namespace djv
                         info.size.w = f.displayWindow.w();
                         info.size.h = f.displayWindow.h();
                         info.pixelAspectRatio = f.f->header().pixelAspectRatio();
-                        switch (layer.channels[0].type)
-                        {
-                        case Image::DataType::F16:
-                        case Image::DataType::F32:
-                            info.type = Image::getFloatType(layer.channels.size(), Image::getBitDepth(layer.channels[0].type));
-                            break;
-                        case Image::DataType::U32:
-                            info.type = Image::getIntType(layer.channels.size(), Image::getBitDepth(layer.channels[0].type));
-                            break;
-                        default: break;
-                        }
+                        info.type = getImageType(layer);
                         if (Image::Type::None == info.type)
                         {
                             throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
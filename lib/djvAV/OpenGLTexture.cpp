@@ -102,8 +102,13 @@ namespace djv
             {
                 if (info == _info)
                     return;
+                // Only re-allocate the texture when the storage changes.
+                const bool storage =
+                    info.size != _info.size ||
+                    info.type != _info.type ||
+                    info.getDataByteCount() != _info.getDataByteCount();
                 _info = info;
-                if (_info.isValid())
+                if (storage && _info.isValid())
                 {
                     if (_id)
                     {
@@ -245,6 +250,35 @@ namespace djv
 #endif // DJV_OPENGL_ES2
             }
 
+#if !defined(DJV_OPENGL_ES2)
+            void Texture::copy(GLuint pbo, const Image::Info& info)
+            {
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+                glBindTexture(GL_TEXTURE_2D, _id);
+                glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+                glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+                glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+                glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+                glTexSubImage2D(
+                    GL_TEXTURE_2D,
+                    0,
+                    0,
+                    0,
+                    info.size.w,
+                    info.size.h,
+                    info.getGLFormat(),
+                    info.getGLType(),
+                    0);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+#endif // DJV_OPENGL_ES2
+
+            void Texture::generateMipmaps()
+            {
+                glBindTexture(GL_TEXTURE_2D, _id);
+                glGenerateMipmap(GL_TEXTURE_2D);
+            }
+
             void Texture::bind()
             {
                 glBindTexture(GL_TEXTURE_2D, _id);
@@ -62,6 +62,15 @@ namespace djv
                 void set(const Image::Info&);
                 void copy(const Image::Data&);
                 void copy(const Image::Data&, uint16_t x, uint16_t y);
+#if !defined(DJV_OPENGL_ES2)
+                //! Copy from a pixel buffer object that contains data with the
+                //! given information.
+                void copy(GLuint pbo, const Image::Info&);
+#endif // DJV_OPENGL_ES2
+
+                //! Generate the mipmap levels from the first level. This should
+                //! be called after copying when a mipmap minify filter is used.
+                void generateMipmaps();
 
                 void bind();
 
@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/PlaybackClock.h>
+
+#include <djvCore/Math.h>
+
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const double driftTimeMin = .5;
+            const double driftMin     = .95;
+            const double driftMax     = 1.05;
+
+        } // namespace
+
+        PresentationStats::PresentationStats() :
+            histogram(presentationHistogramSize, 0)
+        {}
+
+        bool PresentationStats::operator == (const PresentationStats& other) const
+        {
+            return
+                early == other.early &&
+                onTime == other.onTime &&
+                late == other.late &&
+                dropped == other.dropped &&
+                histogram == other.histogram;
+        }
+
+        bool PresentationStats::operator != (const PresentationStats& other) const
+        {
+            return !(*this == other);
+        }
+
+        struct PlaybackClock::Private
+        {
+            std::chrono::steady_clock::time_point startTime;
+            size_t sampleRate = 0;
+            size_t latency = 0;
+            bool audioValid = false;
+            size_t audioSamples = 0;
+            std::chrono::steady_clock::time_point audioTime;
+            size_t audioSamplesStart = 0;
+            std::chrono::steady_clock::time_point audioTimeStart;
+            double drift = 1.0;
+            double time = 0.0;
+            PresentationStats presentationStats;
+        };
+
+        void PlaybackClock::_init()
+        {}
+
+        PlaybackClock::PlaybackClock() :
+            _p(new Private)
+        {}
+
+        PlaybackClock::~PlaybackClock()
+        {}
+
+        std::shared_ptr<PlaybackClock> PlaybackClock::create()
+        {
+            auto out = std::shared_ptr<PlaybackClock>(new PlaybackClock);
+            out->_init();
+            return out;
+        }
+
+        void PlaybackClock::start(const std::chrono::steady_clock::time_point& value)
+        {
+            DJV_PRIVATE_PTR();
+            p.startTime = value;
+            p.audioValid = false;
+            p.time = 0.0;
+        }
+
+        void PlaybackClock::setAudio(size_t sampleRate, size_t latency)
+        {
+            DJV_PRIVATE_PTR();
+            if (sampleRate == p.sampleRate && latency == p.latency)
+                return;
+            p.sampleRate = sampleRate;
+            p.latency = latency;
+            p.audioValid = false;
+            p.drift = 1.0;
+        }
+
+        void PlaybackClock::setAudioSamples(size_t value, const std::chrono::steady_clock::time_point& time)
+        {
+            DJV_PRIVATE_PTR();
+            if (!p.sampleRate)
+                return;
+            if (!p.audioValid)
+            {
+                p.audioValid = true;
+                p.audioSamplesStart = value;
+                p.audioTimeStart = time;
+            }
+            else if (value > p.audioSamples)
+            {
+                // Measure the drift over the whole time the audio has been
+                // running so the callback jitter averages out.
+                const double systemTime = std::chrono::duration<double>(time - p.audioTimeStart).count();
+                if (systemTime >= driftTimeMin)
+                {
+                    const double audioTime = (value - p.audioSamplesStart) / static_cast<double>(p.sampleRate);
+                    p.drift = Math::clamp(audioTime / systemTime, driftMin, driftMax);
+                }
+            }
+            p.audioSamples = value;
+            p.audioTime = time;
+        }
+
+        double PlaybackClock::getTime(const std::chrono::steady_clock::time_point& value)
+        {
+            DJV_PRIVATE_PTR();
+            double out = 0.0;
+            if (p.sampleRate)
+            {
+                if (p.audioValid)
+                {
+                    out =
+                        (static_cast<double>(p.audioSamples) - static_cast<double>(p.latency)) / p.sampleRate +
+                        std::chrono::duration<double>(value - p.audioTime).count() * p.drift;
+                }
+            }
+            else
+            {
+                out = std::chrono::duration<double>(value - p.startTime).count();
+            }
+            out = std::max(out, p.time);
+            p.time = out;
+            return out;
+        }
+
+        double PlaybackClock::getDrift() const
+        {
+            return _p->drift;
+        }
+
+        void PlaybackClock::addPresentation(double offset, double frameDuration)
+        {
+            DJV_PRIVATE_PTR();
+            auto& stats = p.presentationStats;
+            if (offset < 0.0)
+            {
+                ++stats.early;
+            }
+            else if (offset < frameDuration)
+            {
+                ++stats.onTime;
+            }
+            else
+            {
+                ++stats.late;
+            }
+            const int bin = static_cast<int>(std::floor(offset / presentationHistogramBinTime)) +
+                static_cast<int>(presentationHistogramSize / 2);
+            ++stats.histogram[Math::clamp(bin, 0, static_cast<int>(presentationHistogramSize) - 1)];
+        }
+
+        void PlaybackClock::addDropped(size_t value)
+        {
+            _p->presentationStats.dropped += value;
+        }
+
+        const PresentationStats& PlaybackClock::getPresentationStats() const
+        {
+            return _p->presentationStats;
+        }
+
+        void PlaybackClock::resetPresentationStats()
+        {
+            _p->presentationStats = PresentationStats();
+        }
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,129 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/AV.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        //! This constant provides the number of presentation histogram bins.
+        const size_t presentationHistogramSize = 32;
+
+        //! This constant provides the presentation histogram bin size in seconds.
+        const double presentationHistogramBinTime = .002;
+
+        //! This struct provides frame presentation statistics. A frame is
+        //! early if it is presented before it is due, late if it is presented
+        //! after the next frame is due, and dropped if it is never presented.
+        class PresentationStats
+        {
+        public:
+            PresentationStats();
+
+            size_t early   = 0;
+            size_t onTime  = 0;
+            size_t late    = 0;
+            size_t dropped = 0;
+
+            //! The histogram of presentation offsets from when the frames were
+            //! due. The center bin starts at zero, the first and last bins
+            //! include the offsets outside of the range.
+            std::vector<size_t> histogram;
+
+            bool operator == (const PresentationStats&) const;
+            bool operator != (const PresentationStats&) const;
+        };
+
+        //! This class provides the playback master clock.
+        //!
+        //! When there is audio the clock is slaved to the number of samples
+        //! consumed by the audio device, minus the device latency. Between
+        //! audio updates the clock is advanced with the monotonic system clock
+        //! scaled by the measured drift between the two clocks. Without audio
+        //! the clock is the elapsed system time.
+        class PlaybackClock
+        {
+            DJV_NON_COPYABLE(PlaybackClock);
+
+        protected:
+            void _init();
+            PlaybackClock();
+
+        public:
+            ~PlaybackClock();
+
+            static std::shared_ptr<PlaybackClock> create();
+
+            //! Restart the clock from zero.
+            void start(const std::chrono::steady_clock::time_point&);
+
+            //! Set the audio sample rate and the output latency in samples. A
+            //! sample rate of zero disables the audio clock.
+            void setAudio(size_t sampleRate, size_t latency);
+
+            //! Update the clock with the number of samples consumed by the
+            //! audio device and the time they were consumed.
+            void setAudioSamples(size_t, const std::chrono::steady_clock::time_point&);
+
+            //! Get the clock time in seconds. The time does not decrease until
+            //! the clock is restarted.
+            double getTime(const std::chrono::steady_clock::time_point&);
+
+            //! Get the ratio of the audio clock rate to the system clock rate.
+            double getDrift() const;
+
+            //! \name Presentation
+            ///@{
+
+            //! Add a presented frame. The offset is the time in seconds from
+            //! when the frame was due.
+            void addPresentation(double offset, double frameDuration);
+
+            void addDropped(size_t = 1);
+
+            const PresentationStats& getPresentationStats() const;
+
+            void resetPresentationStats();
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
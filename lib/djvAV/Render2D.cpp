@@ -31,6 +31,7 @@
 
 #include <djvAV/Color.h>
 #include <djvAV/GLFWSystem.h>
+#include <djvAV/ImageUtil.h>
 #include <djvAV/OpenGLMesh.h>
 #include <djvAV/OpenGLShader.h>
 #include <djvAV/OpenGLTexture.h>
@@ -42,7 +43,10 @@
 #include <djvCore/Cache.h>
 #include <djvCore/Context.h>
 #include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
 #include <djvCore/LogSystem.h>
+#include <djvCore/Math.h>
+#include <djvCore/OS.h>
 #include <djvCore/Range.h>
 #include <djvCore/ResourceSystem.h>
 #include <djvCore/Timer.h>
@@ -53,6 +57,13 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/perpendicular.hpp>
 
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <typeinfo>
+
 using namespace djv::Core;
 namespace _OCIO = OCIO_NAMESPACE;
 
@@ -67,13 +78,23 @@ namespace djv
                 //! \todo Should this be configurable?
                 const uint8_t  textureAtlasCount      = 4;
                 const uint16_t textureAtlasSize       = 8192;
-                const size_t   dynamicTextureCount    = 16;
-                const size_t   dynamicTextureCacheMax = 16;
+                const size_t   dynamicTextureCacheMax = 512 * Memory::megabyte;
+                const size_t   dynamicTexturePoolMax  = 4;
+                const uint8_t  mipmapLevelMax         = 4;
 #if !defined(DJV_OPENGL_ES2)
                 const size_t   lut3DSize              = 32;
                 const size_t   colorSpaceCacheMax     = 32;
+                const size_t   textureStreamCount     = 4;
 #endif // DJV_OPENGL_ES2
 
+                //! The maximum number of tiles requested each time a tiled
+                //! image is drawn.
+                const size_t tiledImageRequestsPerFrame = 4;
+
+                //! The maximum number of times a text run is laid out when
+                //! adding its glyphs evicts other items from the texture atlas.
+                const size_t textRunLayoutMax = 2;
+
                 // This enumeration provides how the color is used to draw the render primitive.
                 enum class ColorMode
                 {
@@ -140,6 +161,61 @@ namespace djv
                         shader->setUniform(data.colorModeLoc, static_cast<int>(ColorMode::SolidColor));
                         shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
                     }
+
+                    //! Get whether the given primitive binds the same shader state,
+                    //! so it can be drawn without binding it again.
+                    virtual bool hasSameState(const Primitive& other) const
+                    {
+                        return typeid(*this) == typeid(other) &&
+                            lcdText == other.lcdText &&
+                            color[0] == other.color[0] &&
+                            color[1] == other.color[1] &&
+                            color[2] == other.color[2] &&
+                            color[3] == other.color[3];
+                    }
+                };
+
+                //! This struct provides a draw command batched from one or more
+                //! primitives, along with the state that needs to be changed
+                //! before it is drawn.
+                struct DrawCommand
+                {
+                    Primitive*  primitive   = nullptr;
+                    size_t      vaoSize     = 0;
+                    bool        scissor     = false;
+                    bool        alphaBlend  = false;
+                    bool        colorMask   = false;
+                    bool        bind        = false;
+                };
+
+                //! This class provides a per-frame arena for render primitives. The
+                //! primitives are re-used between frames instead of being allocated
+                //! for each draw.
+                template<typename T>
+                class PrimitivePool
+                {
+                public:
+                    T* create()
+                    {
+                        if (_count < _items.size())
+                        {
+                            *_items[_count] = T();
+                        }
+                        else
+                        {
+                            _items.emplace_back(new T);
+                        }
+                        return _items[_count++].get();
+                    }
+
+                    void clear()
+                    {
+                        _count = 0;
+                    }
+
+                private:
+                    std::vector<std::unique_ptr<T> > _items;
+                    size_t _count = 0;
                 };
 
                 //! This class provides a text render primitive.
@@ -157,6 +233,12 @@ namespace djv
                         shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
                         shader->setUniform(data.textureSamplerLoc, static_cast<int>(atlasIndex));
                     }
+
+                    bool hasSameState(const Primitive& other) const override
+                    {
+                        return Primitive::hasSameState(other) &&
+                            atlasIndex == static_cast<const TextPrimitive&>(other).atlasIndex;
+                    }
                 };
 
                 //! This class provides an image render primitive.
@@ -166,7 +248,7 @@ namespace djv
                     ColorMode       colorMode           = ColorMode::ColorAndTexture;
                     Image::Channels imageChannels       = Image::Channels::RGBA;
 #if !defined(DJV_OPENGL_ES2)
-                    uint8_t         colorSpace          = 0;
+                    int             colorSpace          = 0;
                     GLuint          colorSpaceTextureID = 0;
 #endif // DJV_OPENGL_ES2
                     glm::mat4x4     colorMatrix;
@@ -237,6 +319,11 @@ namespace djv
                         default: break;
                         }
                     }
+
+                    bool hasSameState(const Primitive&) const override
+                    {
+                        return false;
+                    }
                 };
 
                 //! This class provides a shadow render primitive.
@@ -349,11 +436,169 @@ namespace djv
                 //! This struct provides data for color space conversions.
                 struct ColorSpaceData
                 {
-                    size_t                  id;
+                    int                     id      = 0;
                     std::string             shaderSource;
                     std::shared_ptr<LUT3D>  lut3D;
+                    size_t                  frame   = 0;
                 };
 
+                //! This struct provides a color space conversion built by a worker
+                //! thread. The shader function uses a placeholder name that is
+                //! replaced when the conversion is added to the cache.
+                struct ColorSpaceBuild
+                {
+                    std::string         shaderSource;
+                    std::vector<float>  lut3D;
+                    bool                diskCacheHit = false;
+                    std::string         error;
+                };
+
+                const std::string colorSpaceFunctionName = "djvColorSpaceFunction";
+
+                //! The color space disk cache file header.
+                const char     colorSpaceCacheMagic[]  = "DJVL";
+                const uint32_t colorSpaceCacheVersion  = 1;
+
+                std::string getColorSpaceCacheKey(
+                    const std::string& configCacheID,
+                    const OCIO::Convert& convert,
+                    size_t edgeLen)
+                {
+                    std::stringstream ss;
+                    ss << configCacheID << "_" << convert.input << "_" << convert.output << "_" << edgeLen;
+                    return ss.str();
+                }
+
+                std::string getColorSpaceCacheFileName(const std::string& path, const std::string& key)
+                {
+                    std::stringstream ss;
+                    ss << std::hex << std::setw(16) << std::setfill('0') << Memory::getStableHash(key);
+                    return std::string(FileSystem::Path(path, ss.str() + ".lut"));
+                }
+
+                bool readColorSpaceCache(const std::string& fileName, const std::string& key, size_t edgeLen, ColorSpaceBuild& out)
+                {
+                    bool result = false;
+                    try
+                    {
+                        FileSystem::FileIO io;
+                        io.open(fileName, FileSystem::FileIO::Mode::Read);
+                        char magic[4] = { 0, 0, 0, 0 };
+                        io.read(magic, 4);
+                        uint32_t version = 0;
+                        io.readU32(&version);
+                        uint32_t size = 0;
+                        io.readU32(&size);
+                        std::string fileKey;
+                        if (0 == memcmp(magic, colorSpaceCacheMagic, 4) &&
+                            colorSpaceCacheVersion == version &&
+                            size == key.size())
+                        {
+                            fileKey.resize(size);
+                            io.read(&fileKey[0], size);
+                        }
+                        if (fileKey == key)
+                        {
+                            io.readU32(&size);
+                            out.shaderSource.resize(size);
+                            io.read(&out.shaderSource[0], size);
+                            uint32_t fileEdgeLen = 0;
+                            io.readU32(&fileEdgeLen);
+                            if (fileEdgeLen == edgeLen)
+                            {
+                                out.lut3D.resize(3 * edgeLen * edgeLen * edgeLen);
+                                io.readF32(out.lut3D.data(), out.lut3D.size());
+                                result = true;
+                            }
+                        }
+                    }
+                    catch (const std::exception&)
+                    {}
+                    return result;
+                }
+
+                void writeColorSpaceCache(const std::string& fileName, const std::string& key, size_t edgeLen, const ColorSpaceBuild& value)
+                {
+                    // Write to a temporary file and rename it so that other
+                    // processes never read a partial file.
+                    std::stringstream ss;
+                    ss << fileName << "." << createUID() << ".tmp";
+                    const std::string tmpFileName = ss.str();
+                    try
+                    {
+                        {
+                            FileSystem::FileIO io;
+                            io.open(tmpFileName, FileSystem::FileIO::Mode::Write);
+                            io.write(colorSpaceCacheMagic, 4);
+                            io.writeU32(colorSpaceCacheVersion);
+                            io.writeU32(static_cast<uint32_t>(key.size()));
+                            io.write(key);
+                            io.writeU32(static_cast<uint32_t>(value.shaderSource.size()));
+                            io.write(value.shaderSource);
+                            io.writeU32(static_cast<uint32_t>(edgeLen));
+                            io.writeF32(value.lut3D.data(), value.lut3D.size());
+                        }
+                        if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+                        {
+                            // Windows does not replace existing files.
+                            std::remove(fileName.c_str());
+                            if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+                            {
+                                std::remove(tmpFileName.c_str());
+                            }
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        std::remove(tmpFileName.c_str());
+                    }
+                }
+
+                //! Build a color space conversion. This function is run on a
+                //! worker thread so it must not use OpenGL.
+                ColorSpaceBuild buildColorSpace(const OCIO::Convert& convert, size_t edgeLen, const std::string& diskCachePath)
+                {
+                    ColorSpaceBuild out;
+                    try
+                    {
+                        auto config = _OCIO::GetCurrentConfig();
+                        std::string diskCacheKey;
+                        std::string diskCacheFileName;
+                        if (!diskCachePath.empty())
+                        {
+                            diskCacheKey = getColorSpaceCacheKey(config->getCacheID(), convert, edgeLen);
+                            diskCacheFileName = getColorSpaceCacheFileName(diskCachePath, diskCacheKey);
+                            if (readColorSpaceCache(diskCacheFileName, diskCacheKey, edgeLen, out))
+                            {
+                                out.diskCacheHit = true;
+                                return out;
+                            }
+                        }
+                        auto processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+                        _OCIO::GpuShaderDesc shaderDesc;
+                        shaderDesc.setLanguage(_OCIO::GPU_LANGUAGE_GLSL_1_3);
+                        shaderDesc.setFunctionName(colorSpaceFunctionName.c_str());
+                        shaderDesc.setLut3DEdgeLen(edgeLen);
+                        out.shaderSource = processor->getGpuShaderText(shaderDesc);
+                        size_t index = out.shaderSource.find("texture3D");
+                        if (index != std::string::npos)
+                        {
+                            out.shaderSource.replace(index, std::string("texture3D").size(), "texture");
+                        }
+                        out.lut3D.resize(3 * edgeLen * edgeLen * edgeLen);
+                        processor->getGpuLut3D(out.lut3D.data(), shaderDesc);
+                        if (!diskCacheFileName.empty())
+                        {
+                            writeColorSpaceCache(diskCacheFileName, diskCacheKey, edgeLen, out);
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        out.error = e.what();
+                    }
+                    return out;
+                }
+
 #endif // DJV_OPENGL_ES2
 
                 // Utility function to flip the y-coordinate.
@@ -465,6 +710,7 @@ namespace djv
             struct Render2D::Private
             {
                 Render2D* system = nullptr;
+                Backend backend = Backend::OpenGL;
 
                 Font::Info                              currentFont;
                 ImageFilterOptions                      imageFilterOptions  = ImageFilterOptions(ImageFilter::Linear, ImageFilter::Nearest);
@@ -472,17 +718,71 @@ namespace djv
 
                 BBox2f                                              viewport;
                 std::vector<Primitive*>                             primitives;
+                PrimitivePool<Primitive>                            primitivePool;
+                PrimitivePool<TextPrimitive>                        textPrimitivePool;
+                PrimitivePool<ImagePrimitive>                       imagePrimitivePool;
+                PrimitivePool<ShadowPrimitive>                      shadowPrimitivePool;
+                size_t                                              primitiveCount      = 0;
+                size_t                                              drawCallCount       = 0;
+                size_t                                              stateChangeCount    = 0;
+                size_t                                              textRunLayoutCount  = 0;
                 PrimitiveData                                       primitiveData;
                 std::shared_ptr<TextureAtlas>                       textureAtlas;
                 std::map<UID, uint64_t>                             textureIDs;
                 std::map<UID, uint64_t>                             glyphTextureIDs;
-                std::vector<std::shared_ptr<OpenGL::Texture> >      dynamicTextures;
-                std::map<UID, std::shared_ptr<OpenGL::Texture> >    dynamicTextureCache;
+
+                //! This struct provides a cached dynamic texture. The textures are
+                //! kept in least recently used order.
+                struct DynamicTexture
+                {
+                    std::shared_ptr<OpenGL::Texture>    texture;
+                    size_t                              byteCount   = 0;
+                    size_t                              frame       = 0;
+                    uint8_t                             mipLevel    = 0;
+                    std::list<UID>::iterator            lru;
+                };
+                std::map<UID, DynamicTexture>                       dynamicTextureCache;
+                std::list<UID>                                      dynamicTextureLRU;
+                size_t                                              dynamicTextureCacheByteCount = 0;
+                size_t                                              dynamicTextureByteCountMax   = dynamicTextureCacheMax;
+
+                //! Unused textures that can be re-used for images with the same
+                //! size class.
+                std::map<uint64_t, std::list<std::shared_ptr<OpenGL::Texture> > > dynamicTexturePool;
+                size_t                                              dynamicTexturePoolCount      = 0;
+                size_t                                              dynamicTexturePoolByteCount  = 0;
+                size_t                                              frame                        = 0;
+                uint8_t                                             streamMipLevel               = 0;
 #if !defined(DJV_OPENGL_ES2)
                 std::map<OCIO::Convert, ColorSpaceData>             colorSpaceCache;
+                std::map<OCIO::Convert, std::future<ColorSpaceBuild> > colorSpaceBuilds;
+                std::string                                         colorSpaceDiskCachePath;
+                size_t                                              colorSpaceDiskCacheHits = 0;
+
+                //! This struct provides a pixel buffer object used to upload an
+                //! image in the background. The buffer is mapped and filled by a
+                //! worker thread, then unmapped and copied to a texture in a later
+                //! frame. The image may be reduced to a mipmap level first.
+                struct TextureStream
+                {
+                    GLuint                          pbo         = 0;
+                    size_t                          byteCount   = 0;
+                    std::shared_ptr<Image::Image>   image;
+                    Image::Info                     info;
+                    uint8_t                         mipLevel    = 0;
+                    std::future<void>               copy;
+                };
+                std::vector<TextureStream>                          textureStreams;
 #endif // DJV_OPENGL_ES2
+                std::vector<std::shared_ptr<Image::Image> >         streamImages;
+                size_t                                              textureUploadByteCount  = 0;
+                size_t                                              textureUploadBandwidth  = 0;
+                size_t                                              textureUploadStallCount = 0;
+                std::chrono::steady_clock::time_point               textureUploadTime;
                 std::vector<uint8_t>                                vboData;
                 size_t                                              vboDataSize         = 0;
+                size_t                                              vboDataByteCount    = 0;
+                std::vector<DrawCommand>                            drawCommands;
                 std::shared_ptr<OpenGL::VBO>                        vbo;
                 std::shared_ptr<OpenGL::VAO>                        vao;
                 std::string                                         vertexFileName;
@@ -492,10 +792,34 @@ namespace djv
                 std::shared_ptr<OpenGL::Shader>                     shader;
                 GLint                                               mvpLoc              = 0;
 
+                std::shared_ptr<ValueSubject<size_t> >              colorSpacesReady;
                 std::shared_ptr<Time::Timer>                        statsTimer;
 
                 void updateVBODataSize(size_t);
 
+                void recordDrawCommands();
+                void drawOpenGL(const Image::Size&);
+
+                std::shared_ptr<OpenGL::Texture> getDynamicTexture(const Image::Info&);
+                void addDynamicTexture(UID, const std::shared_ptr<OpenGL::Texture>&, uint8_t mipLevel);
+                void touchDynamicTexture(DynamicTexture&);
+                void removeDynamicTexture(std::map<UID, DynamicTexture>::iterator);
+                void updateDynamicTextureCache();
+                void clearDynamicTextureCache();
+                void uploadDynamicTexture(const std::shared_ptr<Image::Image>&, uint8_t mipLevel);
+                void updateTextureStreams();
+                void updateTextureUploadBandwidth();
+#if !defined(DJV_OPENGL_ES2)
+                void finishTextureStream(TextureStream&);
+                ColorSpaceData getColorSpace(const OCIO::Convert&);
+                void addColorSpace(const OCIO::Convert&, ColorSpaceBuild&);
+                void updateColorSpaceCache();
+#endif // DJV_OPENGL_ES2
+
+                void getGlyphItem(const std::shared_ptr<Font::Glyph>&, TextureAtlasItem&);
+                TextPrimitive* createTextPrimitive(const BBox2f& clipRect, const float color[4], uint8_t atlasIndex);
+                void addTextVertices(const BBox2f&, const uint16_t u[2], const uint16_t v[2]);
+
                 void drawImage(
                     const std::shared_ptr<Image::Image>&,
                     const glm::vec2& pos,
@@ -508,20 +832,23 @@ namespace djv
                 std::string getFragmentSource() const;
             };
 
-            void Render2D::_init(const std::shared_ptr<Core::Context>& context)
+            void Render2D::_init(const std::shared_ptr<Core::Context>& context, Backend backend)
             {
                 ISystem::_init("djv::AV::Render::Render2D", context);
 
                 DJV_PRIVATE_PTR();
                 p.system = this;
+                p.backend = backend;
+                p.textureUploadTime = std::chrono::steady_clock::now();
 
-                addDependency(context->getSystemT<AV::GLFW::System>());
-
-                GLint maxTextureUnits = 0;
-                GLint maxTextureSize = 0;
-                glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
-                glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+                GLint maxTextureUnits = textureAtlasCount;
+                GLint maxTextureSize = textureAtlasSize;
+                if (Backend::OpenGL == backend)
                 {
+                    addDependency(context->getSystemT<AV::GLFW::System>());
+
+                    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+                    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
                     auto logSystem = context->getSystemT<LogSystem>();
                     std::stringstream ss;
                     ss << "Maximum OpenGL texture units: " << maxTextureUnits << "\n";
@@ -542,7 +869,8 @@ namespace djv
                     _textureAtlasSize,
                     Image::Type::RGBA_U8,
                     GL_NEAREST,
-                    0));
+                    0,
+                    Backend::OpenGL == backend));
                 p.primitiveData.textureAtlasCount = _textureAtlasCount;
 
                 _updateImageFilter();
@@ -565,6 +893,26 @@ namespace djv
                     logSystem->log("djv::AV::Render::Render2D", e.what(), LogLevel::Error);
                 }
 
+#if !defined(DJV_OPENGL_ES2)
+                if (OS::getIntEnv("DJV_OCIO_LUT_CACHE") > 0)
+                {
+                    const FileSystem::Path path(resourceSystem->getPath(FileSystem::ResourcePath::Documents), "LUTCache");
+                    try
+                    {
+                        if (!FileSystem::FileInfo(path).doesExist())
+                        {
+                            FileSystem::Path::mkdir(path);
+                        }
+                        p.colorSpaceDiskCachePath = std::string(path);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _log(e.what(), LogLevel::Error);
+                    }
+                }
+#endif // DJV_OPENGL_ES2
+                p.colorSpacesReady = ValueSubject<size_t>::create(0);
+
                 p.statsTimer = Time::Timer::create(context);
                 p.statsTimer->setRepeating(true);
                 p.statsTimer->start(
@@ -574,13 +922,24 @@ namespace djv
                         DJV_PRIVATE_PTR();
                         std::stringstream ss;
                         ss << "Texture atlas: " << p.textureAtlas->getPercentageUsed() << "%\n";
+                        ss << "Texture atlas evictions: " << p.textureAtlas->getEvictionCount() << "\n";
+                        ss << "Texture atlas compactions: " << p.textureAtlas->getCompactionCount() << "\n";
                         ss << "Texture IDs: " << p.textureIDs.size() << "%\n";
                         ss << "Glyph texture IDs: " << p.glyphTextureIDs.size() << "\n";
-                        ss << "Dynamic textures: " << p.dynamicTextures.size() << "\n";
-                        ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << "\n";
+                        ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << ", " <<
+                            p.dynamicTextureCacheByteCount / Memory::megabyte << "/" <<
+                            p.dynamicTextureByteCountMax / Memory::megabyte << "MB\n";
+                        ss << "Dynamic texture pool: " << p.dynamicTexturePoolCount << "\n";
+                        ss << "Texture upload bandwidth: " << p.textureUploadBandwidth / Memory::megabyte << "MB/s\n";
+                        ss << "Texture upload stalls: " << p.textureUploadStallCount << "\n";
 #if !defined(DJV_OPENGL_ES2)
                         ss << "Color space cache: " << p.colorSpaceCache.size() << "\n";
+                        ss << "Color space builds: " << p.colorSpaceBuilds.size() << "\n";
+                        ss << "Color space disk cache hits: " << p.colorSpaceDiskCacheHits << "\n";
 #endif // DJV_OPENGL_ES2
+                        ss << "Primitives: " << p.primitiveCount << "\n";
+                        ss << "Draw calls: " << p.drawCallCount << "\n";
+                        ss << "State changes: " << p.stateChangeCount << "\n";
                         ss << "VBO size: " << (p.vbo ? p.vbo->getSize() : 0);
                         _log(ss.str());
                     });
@@ -591,186 +950,116 @@ namespace djv
             {}
 
             Render2D::~Render2D()
-            {}
+            {
+#if !defined(DJV_OPENGL_ES2)
+                DJV_PRIVATE_PTR();
+                for (auto& i : p.textureStreams)
+                {
+                    if (i.copy.valid())
+                    {
+                        i.copy.get();
+                        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, i.pbo);
+                        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    }
+                    glDeleteBuffers(1, &i.pbo);
+                }
+#endif // DJV_OPENGL_ES2
+            }
 
-            std::shared_ptr<Render2D> Render2D::create(const std::shared_ptr<Core::Context>& context)
+            std::shared_ptr<Render2D> Render2D::create(const std::shared_ptr<Core::Context>& context, Backend backend)
             {
                 auto out = std::shared_ptr<Render2D>(new Render2D);
-                out->_init(context);
+                out->_init(context, backend);
                 return out;
             }
 
+            Backend Render2D::getBackend() const
+            {
+                return _p->backend;
+            }
+
+            void Render2D::tick(const std::chrono::steady_clock::time_point& t, const Time::Unit& dt)
+            {
+                ISystem::tick(t, dt);
+#if !defined(DJV_OPENGL_ES2)
+                DJV_PRIVATE_PTR();
+                // Add the finished conversions to the cache, so they are used
+                // the next time the images are drawn.
+                size_t ready = 0;
+                auto i = p.colorSpaceBuilds.begin();
+                while (i != p.colorSpaceBuilds.end())
+                {
+                    if (i->second.valid() &&
+                        i->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        auto build = i->second.get();
+                        p.addColorSpace(i->first, build);
+                        i = p.colorSpaceBuilds.erase(i);
+                        ++ready;
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+                if (ready)
+                {
+                    p.colorSpacesReady->setIfChanged(p.colorSpacesReady->get() + ready);
+                }
+#endif // DJV_OPENGL_ES2
+            }
+
+            std::shared_ptr<IValueSubject<size_t> > Render2D::observeColorSpacesReady() const
+            {
+                return _p->colorSpacesReady;
+            }
+
             void Render2D::beginFrame(const Image::Size& size)
             {
                 DJV_PRIVATE_PTR();
                 _size = size;
                 _currentClipRect = BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
                 p.viewport = BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+                ++p.frame;
             }
 
             void Render2D::endFrame()
             {
                 DJV_PRIVATE_PTR();
 
-                if (!p.shader)
-                {
-                    auto shader = Shader::create(p.vertexSource, p.getFragmentSource());
-                    shader->setVertexName(p.vertexFileName);
-                    shader->setFragmentName(p.fragmentFileName);
-                    p.shader = OpenGL::Shader::create(shader);
-                    const auto program = p.shader->getProgram();
-                    p.mvpLoc = glGetUniformLocation(program, "transform.mvp");
-                    p.primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
-#if !defined(DJV_OPENGL_ES2)
-                    p.primitiveData.colorSpaceLoc = glGetUniformLocation(program, "colorSpace");
-                    p.primitiveData.colorSpaceSamplerLoc = glGetUniformLocation(program, "colorSpaceSampler");
-#endif // DJV_OPENGL_ES2
-                    p.primitiveData.imageChannelLoc = glGetUniformLocation(program, "imageChannel");
-                    p.primitiveData.colorMatrixLoc = glGetUniformLocation(program, "colorMatrix");
-                    p.primitiveData.colorMatrixEnabledLoc = glGetUniformLocation(program, "colorMatrixEnabled");
-                    p.primitiveData.colorInvertLoc = glGetUniformLocation(program, "colorInvert");
-                    p.primitiveData.levelsInLowLoc = glGetUniformLocation(program, "levels.inLow");
-                    p.primitiveData.levelsInHighLoc = glGetUniformLocation(program, "levels.inHigh");
-                    p.primitiveData.levelsGammaLoc = glGetUniformLocation(program, "levels.gamma");
-                    p.primitiveData.levelsOutLowLoc = glGetUniformLocation(program, "levels.outLow");
-                    p.primitiveData.levelsOutHighLoc = glGetUniformLocation(program, "levels.outHigh");
-                    p.primitiveData.levelsEnabledLoc = glGetUniformLocation(program, "levelsEnabled");
-                    p.primitiveData.exposureVLoc = glGetUniformLocation(program, "exposure.v");
-                    p.primitiveData.exposureDLoc = glGetUniformLocation(program, "exposure.d");
-                    p.primitiveData.exposureKLoc = glGetUniformLocation(program, "exposure.k");
-                    p.primitiveData.exposureFLoc = glGetUniformLocation(program, "exposure.f");
-                    p.primitiveData.exposureEnabledLoc = glGetUniformLocation(program, "exposureEnabled");
-                    p.primitiveData.softClipLoc = glGetUniformLocation(program, "softClip");
-                    p.primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
-                    p.primitiveData.colorLoc = glGetUniformLocation(program, "color");
-                    p.primitiveData.textureSamplerLoc = glGetUniformLocation(program, "textureSampler");
-                }
-                p.shader->bind();
-
-#if !defined(DJV_OPENGL_ES2)
-                glEnable(GL_MULTISAMPLE);
-#endif // DJV_OPENGL_ES2
-                glEnable(GL_SCISSOR_TEST);
-                glEnable(GL_BLEND);
-
-                glViewport(
-                    static_cast<GLint>(p.viewport.min.x),
-                    static_cast<GLint>(p.viewport.min.y),
-                    static_cast<GLsizei>(p.viewport.w()),
-                    static_cast<GLsizei>(p.viewport.h()));
-                glScissor(
-                    static_cast<GLint>(p.viewport.min.x),
-                    static_cast<GLint>(p.viewport.min.y),
-                    static_cast<GLsizei>(p.viewport.w()),
-                    static_cast<GLsizei>(p.viewport.h()));
-                glClearColor(0.F, 0.F, 0.F, 0.F);
-                glClear(GL_COLOR_BUFFER_BIT);
-
-                const auto viewMatrix = glm::ortho(
-                    p.viewport.min.x,
-                    p.viewport.max.x,
-                    p.viewport.max.y,
-                    p.viewport.min.y,
-                    -1.F, 1.F);
-                p.shader->setUniform(p.mvpLoc, viewMatrix);
-
-                const auto& atlasTextures = p.textureAtlas->getTextures();
-                for (GLuint i = 0; i < static_cast<GLuint>(atlasTextures.size()); ++i)
-                {
-                    glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + i));
-                    glBindTexture(GL_TEXTURE_2D, atlasTextures[i]);
-                }
-
-                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
-                if (!p.vbo || p.vboDataSize / vertexByteCount > p.vbo->getSize())
+                // Batch the primitives into draw commands, then submit them with
+                // the back end.
+                p.recordDrawCommands();
+                if (Backend::OpenGL == p.backend)
                 {
-                    p.vbo = OpenGL::VBO::create(p.vboDataSize / vertexByteCount, OpenGL::VBOType::Pos2_F32_UV_U16);
-                    p.vao = OpenGL::VAO::create(p.vbo->getType(), p.vbo->getID());
-                }
-                p.vbo->copy(p.vboData, 0, p.vboDataSize);
-                p.vao->bind();
-
-                AlphaBlend currentAlphaBlend = AlphaBlend::Straight;
-                bool currentLCDText = false;
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-                for (size_t i = 0; i < p.primitives.size(); ++i)
-                {
-                    const auto& primitive = p.primitives[i];
-                    const BBox2f clipRect = flip(primitive->clipRect, _size);
-                    glScissor(
-                        static_cast<GLint>(clipRect.min.x),
-                        static_cast<GLint>(clipRect.min.y),
-                        static_cast<GLsizei>(clipRect.w()),
-                        static_cast<GLsizei>(clipRect.h()));
-                    if (primitive->alphaBlend != currentAlphaBlend)
-                    {
-                        currentAlphaBlend = primitive->alphaBlend;
-                        switch (currentAlphaBlend)
-                        {
-                        case AlphaBlend::None:
-                            glBlendFunc(GL_ONE, GL_ZERO);
-                            break;
-                        case AlphaBlend::Straight:
-                            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                            break;
-                        case AlphaBlend::Premultiplied:
-                            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-                            break;
-                        default: break;
-                        }
-                    }
-                    if (primitive->lcdText != currentLCDText)
-                    {
-                        currentLCDText = primitive->lcdText;
-                        if (!currentLCDText)
-                        {
-                            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-                        }
-                    }
-                    primitive->bind(p.primitiveData, p.shader);
-                    if (currentLCDText)
-                    {
-                        p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaR));
-                        glColorMask(GL_TRUE, GL_FALSE, GL_FALSE, GL_TRUE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
-                        p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaG));
-                        glColorMask(GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
-                        p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaB));
-                        glColorMask(GL_FALSE, GL_FALSE, GL_TRUE, GL_FALSE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
-                    }
-                    else
-                    {
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
-                    }
+                    p.drawOpenGL(_size);
                 }
+                p.primitiveCount = p.primitives.size();
+                p.vboDataByteCount = p.vboDataSize;
 
                 _clipRects.clear();
-                for (size_t i = 0; i < p.primitives.size(); ++i)
-                {
-                    delete p.primitives[i];
-                }
+                p.drawCommands.clear();
                 p.primitives.clear();
+                p.primitivePool.clear();
+                p.textPrimitivePool.clear();
+                p.imagePrimitivePool.clear();
+                p.shadowPrimitivePool.clear();
                 p.vboDataSize = 0;
-                while (p.dynamicTextureCache.size() > dynamicTextureCacheMax)
+                if (Backend::OpenGL == p.backend)
                 {
-                    auto texture = p.dynamicTextureCache.begin();
-                    p.dynamicTextures.emplace_back(texture->second);
-                    p.dynamicTextureCache.erase(texture);
-                }
-                while (p.dynamicTextures.size() > dynamicTextureCount)
-                {
-                    p.dynamicTextures.pop_back();
-                }
+                    p.updateTextureStreams();
+                    p.updateTextureUploadBandwidth();
+                    p.updateDynamicTextureCache();
 #if !defined(DJV_OPENGL_ES2)
-                while (p.colorSpaceCache.size() > colorSpaceCacheMax)
+                    p.updateColorSpaceCache();
+#endif // DJV_OPENGL_ES2
+                }
+                else
                 {
-                    p.colorSpaceCache.erase(p.colorSpaceCache.begin());
-                    p.shader.reset();
+                    p.streamImages.clear();
                 }
-#endif // DJV_OPENGL_ES2
+                p.textureAtlas->compact();
             }
             
             void Render2D::drawPolyline(const std::vector<glm::vec2>& value)
@@ -805,7 +1094,7 @@ namespace djv
                     }
                     if (bbox.intersects(_currentClipRect))
                     {
-                        auto primitive = new Primitive;
+                        auto primitive = p.primitivePool.create();
                         primitive->clipRect = _currentClipRect;
                         primitive->color[0] = _finalColor[0];
                         primitive->color[1] = _finalColor[1];
@@ -841,7 +1130,7 @@ namespace djv
             void Render2D::drawRects(const std::vector<BBox2f>& value)
             {
                 DJV_PRIVATE_PTR();
-                auto primitive = new Primitive;
+                auto primitive = p.primitivePool.create();
                 primitive->clipRect = _currentClipRect;
                 primitive->color[0] = _finalColor[0];
                 primitive->color[1] = _finalColor[1];
@@ -887,7 +1176,7 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (rect.intersects(_currentClipRect))
                 {
-                    auto primitive = new Primitive;
+                    auto primitive = p.primitivePool.create();
                     primitive->clipRect = _currentClipRect;
                     primitive->color[0] = _finalColor[0];
                     primitive->color[1] = _finalColor[1];
@@ -963,7 +1252,7 @@ namespace djv
                 const BBox2f rect(pos.x - radius, pos.y - radius, radius * 2.F, radius * 2.F);
                 if (rect.intersects(_currentClipRect))
                 {
-                    auto primitive = new Primitive;
+                    auto primitive = p.primitivePool.create();
                     primitive->clipRect = _currentClipRect;
                     primitive->color[0] = _finalColor[0];
                     primitive->color[1] = _finalColor[1];
@@ -1022,6 +1311,137 @@ namespace djv
                 p.drawImage(image, pos, options, ColorMode::ColorWithTextureAlpha, _currentTransform, _currentClipRect, _finalColor);
             }
 
+            void Render2D::drawTiledImage(
+                const std::shared_ptr<Image::TiledImage>& image,
+                const glm::vec2& pos,
+                const ImageOptions& options)
+            {
+                DJV_PRIVATE_PTR();
+                const auto& info = image->getInfo();
+                if (!info.isValid())
+                    return;
+
+                // Find the visible part of the image.
+                const glm::mat3x3 inverse = glm::inverse(_currentTransform);
+                const glm::vec3 pts[] =
+                {
+                    inverse * glm::vec3(_currentClipRect.min.x, _currentClipRect.min.y, 1.F),
+                    inverse * glm::vec3(_currentClipRect.max.x, _currentClipRect.min.y, 1.F),
+                    inverse * glm::vec3(_currentClipRect.max.x, _currentClipRect.max.y, 1.F),
+                    inverse * glm::vec3(_currentClipRect.min.x, _currentClipRect.max.y, 1.F)
+                };
+                glm::vec2 min(pts[0].x, pts[0].y);
+                glm::vec2 max = min;
+                for (size_t i = 1; i < 4; ++i)
+                {
+                    min.x = std::min(min.x, pts[i].x);
+                    min.y = std::min(min.y, pts[i].y);
+                    max.x = std::max(max.x, pts[i].x);
+                    max.y = std::max(max.y, pts[i].y);
+                }
+                min -= pos;
+                max -= pos;
+                const float w = static_cast<float>(info.width);
+                const float h = static_cast<float>(info.height);
+                const bool mirrorX = info.layout.mirror.x != options.mirror.x;
+                const bool mirrorY = info.layout.mirror.y != options.mirror.y;
+                if (mirrorX)
+                {
+                    const float tmp = min.x;
+                    min.x = w - max.x;
+                    max.x = w - tmp;
+                }
+                if (mirrorY)
+                {
+                    const float tmp = min.y;
+                    min.y = h - max.y;
+                    max.y = h - tmp;
+                }
+                min.x = Math::clamp(min.x, 0.F, w);
+                min.y = Math::clamp(min.y, 0.F, h);
+                max.x = Math::clamp(max.x, 0.F, w);
+                max.y = Math::clamp(max.y, 0.F, h);
+                if (min.x >= max.x || min.y >= max.y)
+                    return;
+                const uint32_t column0 = static_cast<uint32_t>(min.x) / info.tileSize.w;
+                const uint32_t row0 = static_cast<uint32_t>(min.y) / info.tileSize.h;
+                const uint32_t column1 = std::min(
+                    (static_cast<uint32_t>(ceilf(max.x)) + info.tileSize.w - 1) / info.tileSize.w,
+                    info.getTileColumns());
+                const uint32_t row1 = std::min(
+                    (static_cast<uint32_t>(ceilf(max.y)) + info.tileSize.h - 1) / info.tileSize.h,
+                    info.getTileRows());
+
+                for (const auto& i : image->getTileRequestErrors())
+                {
+                    _log(i, LogLevel::Error);
+                }
+
+                // Draw the overview underneath the tiles. When the image is
+                // zoomed out far enough that the overview has as much detail
+                // as the screen, only the overview is drawn and the tiles are
+                // read just to fill it in.
+                ImageOptions tileOptions = options;
+                tileOptions.cache = ImageCache::Dynamic;
+                bool tiles = true;
+                if (auto overview = image->getOverview())
+                {
+                    const auto& overviewInfo = overview->getInfo();
+                    const float sx = w / static_cast<float>(overviewInfo.size.w);
+                    const float sy = h / static_cast<float>(overviewInfo.size.h);
+                    glm::mat3x3 m(1.F);
+                    m[0][0] = sx;
+                    m[1][1] = sy;
+                    p.drawImage(overview, glm::vec2(pos.x / sx, pos.y / sy), tileOptions, ColorMode::ColorAndTexture, _currentTransform * m, _currentClipRect, _finalColor);
+                    const float zoom = glm::length(glm::vec2(_currentTransform[0][0], _currentTransform[0][1]));
+                    tiles = zoom * sx > 1.F;
+                }
+
+                // Draw the tiles that are in the cache, and read the missing
+                // tiles in the background.
+                size_t requests = 0;
+                for (uint32_t row = row0; row < row1; ++row)
+                {
+                    for (uint32_t column = column0; column < column1; ++column)
+                    {
+                        std::shared_ptr<Image::Image> tile;
+                        if (tiles)
+                        {
+                            tile = image->getCachedTile(column, row);
+                        }
+                        if (!tile &&
+                            (tiles || !image->hasOverviewTile(column, row)) &&
+                            requests < tiledImageRequestsPerFrame &&
+                            image->requestTile(column, row))
+                        {
+                            ++requests;
+                        }
+                        if (tile)
+                        {
+                            const auto& tileInfo = tile->getInfo();
+                            const float x = static_cast<float>(column * info.tileSize.w);
+                            const float y = static_cast<float>(row * info.tileSize.h);
+                            const glm::vec2 tilePos(
+                                mirrorX ? (w - x - tileInfo.size.w) : x,
+                                mirrorY ? (h - y - tileInfo.size.h) : y);
+                            p.drawImage(tile, pos + tilePos, tileOptions, ColorMode::ColorAndTexture, _currentTransform, _currentClipRect, _finalColor);
+                        }
+                    }
+                }
+            }
+
+            void Render2D::streamImages(const std::vector<std::shared_ptr<Image::Image> >& value)
+            {
+                DJV_PRIVATE_PTR();
+                for (const auto& i : value)
+                {
+                    if (i)
+                    {
+                        p.streamImages.push_back(i);
+                    }
+                }
+            }
+
             void Render2D::setCurrentFont(const Font::Info & value)
             {
                 _p->currentFont = value;
@@ -1039,7 +1459,6 @@ namespace djv
                 TextPrimitive* primitive = nullptr;
                 float x = 0.F;
                 int32_t rsbDeltaPrev = 0;
-                uint8_t textureIndex = 0;
                 for (const auto& glyph : glyphs)
                 {
                     if (rsbDeltaPrev - glyph->lsbDelta > 32)
@@ -1060,69 +1479,24 @@ namespace djv
                         const BBox2f bbox(pos.x + x + offset.x, pos.y - offset.y, width, height);
                         if (bbox.intersects(_currentClipRect))
                         {
-                            const auto uid = glyph->imageData->getUID();
-                            uint64_t id = 0;
-                            const auto i = p.glyphTextureIDs.find(uid);
-                            if (i != p.glyphTextureIDs.end())
-                            {
-                                id = i->second;
-                            }
                             TextureAtlasItem item;
-                            if (!p.textureAtlas->getItem(id, item))
+                            p.getGlyphItem(glyph, item);
+                            if (!primitive || item.textureIndex != primitive->atlasIndex)
                             {
-                                id = p.textureAtlas->addItem(glyph->imageData, item);
-                                p.glyphTextureIDs[uid] = id;
+                                primitive = p.createTextPrimitive(_currentClipRect, _finalColor, item.textureIndex);
                             }
-                            
-                            if (!primitive || item.textureIndex != textureIndex)
-                            {
-                                primitive = new TextPrimitive;
-                                primitive->clipRect = _currentClipRect;
-                                primitive->color[0] = _finalColor[0];
-                                primitive->color[1] = _finalColor[1];
-                                primitive->color[2] = _finalColor[2];
-                                primitive->color[3] = _finalColor[3];
-                                primitive->atlasIndex = item.textureIndex;
-                                primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
-                                primitive->vaoSize = 0;
-                                primitive->lcdText = p.lcdText;
-                                p.primitives.push_back(primitive);
-                                textureIndex = item.textureIndex;
-                            }
-                            
                             primitive->vaoSize += 6;
-                            const size_t vboDataSize = p.vboDataSize;
-                            p.updateVBODataSize(6);
-                            VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataSize]);
-                            pData->vx = bbox.min.x;
-                            pData->vy = bbox.min.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.min * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.min * 65535.F);
-                            ++pData;
-                            pData->vx = bbox.max.x;
-                            pData->vy = bbox.min.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.max * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.min * 65535.F);
-                            ++pData;
-                            pData->vx = bbox.max.x;
-                            pData->vy = bbox.max.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.max * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.max * 65535.F);
-                            ++pData;
-                            pData->vx = bbox.max.x;
-                            pData->vy = bbox.max.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.max * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.max * 65535.F);
-                            ++pData;
-                            pData->vx = bbox.min.x;
-                            pData->vy = bbox.max.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.min * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.max * 65535.F);
-                            ++pData;
-                            pData->vx = bbox.min.x;
-                            pData->vy = bbox.min.y;
-                            pData->tx = static_cast<uint16_t>(item.textureU.min * 65535.F);
-                            pData->ty = static_cast<uint16_t>(item.textureV.min * 65535.F);
+                            const uint16_t u[2] =
+                            {
+                                static_cast<uint16_t>(item.textureU.min * 65535.F),
+                                static_cast<uint16_t>(item.textureU.max * 65535.F)
+                            };
+                            const uint16_t v[2] =
+                            {
+                                static_cast<uint16_t>(item.textureV.min * 65535.F),
+                                static_cast<uint16_t>(item.textureV.max * 65535.F)
+                            };
+                            p.addTextVertices(bbox, u, v);
                         }
                     }
 
@@ -1130,12 +1504,82 @@ namespace djv
                 }
             }
 
+            void Render2D::drawText(TextRun& run, const glm::vec2& pos)
+            {
+                DJV_PRIVATE_PTR();
+
+                // Lay out the glyphs and add them to the texture atlas when the
+                // run is new or items have been removed from the atlas. Adding
+                // the glyphs can evict other glyphs of the same run, so the run
+                // is stamped with the generation from before the layout and
+                // laid out again if the generation changed. If it still changes
+                // the run is left out of date and laid out on the next draw.
+                for (size_t i = 0;
+                    i < textRunLayoutMax && run._atlasGeneration != p.textureAtlas->getGeneration();
+                    ++i)
+                {
+                    const size_t generation = p.textureAtlas->getGeneration();
+                    ++p.textRunLayoutCount;
+                    run._quads.clear();
+                    float x = 0.F;
+                    int32_t rsbDeltaPrev = 0;
+                    for (const auto& glyph : run._glyphs)
+                    {
+                        if (rsbDeltaPrev - glyph->lsbDelta > 32)
+                        {
+                            x -= 1.F;
+                        }
+                        else if (rsbDeltaPrev - glyph->lsbDelta < -31)
+                        {
+                            x += 1.F;
+                        }
+                        rsbDeltaPrev = glyph->rsbDelta;
+
+                        if (glyph->imageData && glyph->imageData->isValid())
+                        {
+                            TextureAtlasItem item;
+                            p.getGlyphItem(glyph, item);
+                            TextRun::Quad quad;
+                            quad.bbox = BBox2f(
+                                x + glyph->offset.x,
+                                -glyph->offset.y,
+                                glyph->imageData->getWidth(),
+                                glyph->imageData->getHeight());
+                            quad.textureIndex = item.textureIndex;
+                            quad.u[0] = static_cast<uint16_t>(item.textureU.min * 65535.F);
+                            quad.u[1] = static_cast<uint16_t>(item.textureU.max * 65535.F);
+                            quad.v[0] = static_cast<uint16_t>(item.textureV.min * 65535.F);
+                            quad.v[1] = static_cast<uint16_t>(item.textureV.max * 65535.F);
+                            run._quads.push_back(quad);
+                        }
+
+                        x += glyph->advance;
+                    }
+                    run._atlasGeneration = generation;
+                }
+
+                TextPrimitive* primitive = nullptr;
+                for (const auto& quad : run._quads)
+                {
+                    const BBox2f bbox(quad.bbox.min + pos, quad.bbox.max + pos);
+                    if (bbox.intersects(_currentClipRect))
+                    {
+                        if (!primitive || quad.textureIndex != primitive->atlasIndex)
+                        {
+                            primitive = p.createTextPrimitive(_currentClipRect, _finalColor, quad.textureIndex);
+                        }
+                        primitive->vaoSize += 6;
+                        p.addTextVertices(bbox, quad.u, quad.v);
+                    }
+                }
+            }
+
             void Render2D::drawShadow(const BBox2f& value, Side side)
             {
                 DJV_PRIVATE_PTR();
                 if (value.intersects(_currentClipRect))
                 {
-                    auto primitive = new ShadowPrimitive;
+                    auto primitive = p.shadowPrimitivePool.create();
                     primitive->clipRect = _currentClipRect;
                     primitive->color[0] = _finalColor[0];
                     primitive->color[1] = _finalColor[1];
@@ -1181,7 +1625,7 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (value.intersects(_currentClipRect))
                 {
-                    auto primitive = new ShadowPrimitive;
+                    auto primitive = p.shadowPrimitivePool.create();
                     primitive->clipRect = _currentClipRect;
                     primitive->color[0] = _finalColor[0];
                     primitive->color[1] = _finalColor[1];
@@ -1416,29 +1860,91 @@ namespace djv
                 return _p->textureAtlas->getPercentageUsed();
             }
 
+            std::vector<float> Render2D::getTextureAtlasPageOccupancy() const
+            {
+                std::vector<float> out;
+                for (const auto& i : _p->textureAtlas->getPageStats())
+                {
+                    out.push_back(i.occupancy);
+                }
+                return out;
+            }
+
+            size_t Render2D::getTextureAtlasEvictionCount() const
+            {
+                return _p->textureAtlas->getEvictionCount();
+            }
+
+            size_t Render2D::getTextureAtlasCompactionCount() const
+            {
+                return _p->textureAtlas->getCompactionCount();
+            }
+
+            size_t Render2D::getTextRunLayoutCount() const
+            {
+                return _p->textRunLayoutCount;
+            }
+
             size_t Render2D::getDynamicTextureCount() const
             {
                 return _p->dynamicTextureCache.size();
             }
 
+            size_t Render2D::getDynamicTextureCacheByteCount() const
+            {
+                return _p->dynamicTextureCacheByteCount;
+            }
+
+            size_t Render2D::getDynamicTextureCacheMax() const
+            {
+                return _p->dynamicTextureByteCountMax;
+            }
+
+            void Render2D::setDynamicTextureCacheMax(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                p.dynamicTextureByteCountMax = value;
+                p.updateDynamicTextureCache();
+            }
+
             size_t Render2D::getVBOSize() const
             {
                 return _p->vbo ? _p->vbo->getSize() : 0;
             }
 
+            size_t Render2D::getVBODataByteCount() const
+            {
+                return _p->vboDataByteCount;
+            }
+
+            size_t Render2D::getPrimitiveCount() const
+            {
+                return _p->primitiveCount;
+            }
+
+            size_t Render2D::getDrawCallCount() const
+            {
+                return _p->drawCallCount;
+            }
+
+            size_t Render2D::getStateChangeCount() const
+            {
+                return _p->stateChangeCount;
+            }
+
+            size_t Render2D::getTextureUploadBandwidth() const
+            {
+                return _p->textureUploadBandwidth;
+            }
+
+            size_t Render2D::getTextureUploadStallCount() const
+            {
+                return _p->textureUploadStallCount;
+            }
+
             void Render2D::_updateImageFilter()
             {
-                DJV_PRIVATE_PTR();
-                p.dynamicTextures.clear();
-                p.dynamicTextureCache.clear();
-                for (size_t i = 0; i < dynamicTextureCount; ++i)
-                {
-                    p.dynamicTextures.emplace_back(
-                        AV::OpenGL::Texture::create(
-                            AV::Image::Info(),
-                            toGL(p.imageFilterOptions.min),
-                            toGL(p.imageFilterOptions.mag)));
-                }
+                _p->clearDynamicTextureCache();
             }
 
             void Render2D::Private::updateVBODataSize(size_t value)
@@ -1451,6 +1957,577 @@ namespace djv
                 }
             }
 
+            void Render2D::Private::recordDrawCommands()
+            {
+                AlphaBlend currentAlphaBlend = AlphaBlend::Straight;
+                bool currentLCDText = false;
+                const Primitive* boundPrimitive = nullptr;
+                BBox2f currentScissor;
+                bool currentScissorValid = false;
+                drawCallCount = 0;
+                stateChangeCount = 0;
+                const size_t primitivesSize = primitives.size();
+                for (size_t i = 0; i < primitivesSize;)
+                {
+                    const auto primitive = primitives[i];
+
+                    // Merge the following primitives that can be drawn with the
+                    // same state.
+                    size_t vaoSize = primitive->vaoSize;
+                    size_t j = i + 1;
+                    if (GL_TRIANGLES == primitive->type)
+                    {
+                        for (; j < primitivesSize; ++j)
+                        {
+                            const auto& next = primitives[j];
+                            if (next->type != GL_TRIANGLES ||
+                                next->vaoOffset != primitive->vaoOffset + vaoSize ||
+                                next->clipRect != primitive->clipRect ||
+                                next->alphaBlend != primitive->alphaBlend ||
+                                !primitive->hasSameState(*next))
+                                break;
+                            vaoSize += next->vaoSize;
+                        }
+                    }
+                    i = j;
+                    if (!vaoSize)
+                        continue;
+
+                    DrawCommand command;
+                    command.primitive = primitive;
+                    command.vaoSize = vaoSize;
+                    if (!currentScissorValid || primitive->clipRect != currentScissor)
+                    {
+                        currentScissor = primitive->clipRect;
+                        currentScissorValid = true;
+                        command.scissor = true;
+                        ++stateChangeCount;
+                    }
+                    if (primitive->alphaBlend != currentAlphaBlend)
+                    {
+                        currentAlphaBlend = primitive->alphaBlend;
+                        command.alphaBlend = true;
+                        ++stateChangeCount;
+                    }
+                    if (primitive->lcdText != currentLCDText)
+                    {
+                        currentLCDText = primitive->lcdText;
+                        if (!currentLCDText)
+                        {
+                            command.colorMask = true;
+                            ++stateChangeCount;
+                        }
+                    }
+                    if (!boundPrimitive || !boundPrimitive->hasSameState(*primitive))
+                    {
+                        command.bind = true;
+                        ++stateChangeCount;
+                    }
+                    if (currentLCDText)
+                    {
+                        drawCallCount += 3;
+                        stateChangeCount += 6;
+
+                        // The color mode uniform is changed when the command is
+                        // drawn so the next primitive needs to be bound.
+                        boundPrimitive = nullptr;
+                    }
+                    else
+                    {
+                        ++drawCallCount;
+                        boundPrimitive = primitive;
+                    }
+                    drawCommands.push_back(command);
+                }
+            }
+
+            void Render2D::Private::drawOpenGL(const Image::Size& size)
+            {
+                if (!shader)
+                {
+                    auto source = Shader::create(vertexSource, getFragmentSource());
+                    source->setVertexName(vertexFileName);
+                    source->setFragmentName(fragmentFileName);
+                    shader = OpenGL::Shader::create(source);
+                    const auto program = shader->getProgram();
+                    mvpLoc = glGetUniformLocation(program, "transform.mvp");
+                    primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
+#if !defined(DJV_OPENGL_ES2)
+                    primitiveData.colorSpaceLoc = glGetUniformLocation(program, "colorSpace");
+                    primitiveData.colorSpaceSamplerLoc = glGetUniformLocation(program, "colorSpaceSampler");
+#endif // DJV_OPENGL_ES2
+                    primitiveData.imageChannelLoc = glGetUniformLocation(program, "imageChannel");
+                    primitiveData.colorMatrixLoc = glGetUniformLocation(program, "colorMatrix");
+                    primitiveData.colorMatrixEnabledLoc = glGetUniformLocation(program, "colorMatrixEnabled");
+                    primitiveData.colorInvertLoc = glGetUniformLocation(program, "colorInvert");
+                    primitiveData.levelsInLowLoc = glGetUniformLocation(program, "levels.inLow");
+                    primitiveData.levelsInHighLoc = glGetUniformLocation(program, "levels.inHigh");
+                    primitiveData.levelsGammaLoc = glGetUniformLocation(program, "levels.gamma");
+                    primitiveData.levelsOutLowLoc = glGetUniformLocation(program, "levels.outLow");
+                    primitiveData.levelsOutHighLoc = glGetUniformLocation(program, "levels.outHigh");
+                    primitiveData.levelsEnabledLoc = glGetUniformLocation(program, "levelsEnabled");
+                    primitiveData.exposureVLoc = glGetUniformLocation(program, "exposure.v");
+                    primitiveData.exposureDLoc = glGetUniformLocation(program, "exposure.d");
+                    primitiveData.exposureKLoc = glGetUniformLocation(program, "exposure.k");
+                    primitiveData.exposureFLoc = glGetUniformLocation(program, "exposure.f");
+                    primitiveData.exposureEnabledLoc = glGetUniformLocation(program, "exposureEnabled");
+                    primitiveData.softClipLoc = glGetUniformLocation(program, "softClip");
+                    primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
+                    primitiveData.colorLoc = glGetUniformLocation(program, "color");
+                    primitiveData.textureSamplerLoc = glGetUniformLocation(program, "textureSampler");
+                }
+                shader->bind();
+
+#if !defined(DJV_OPENGL_ES2)
+                glEnable(GL_MULTISAMPLE);
+#endif // DJV_OPENGL_ES2
+                glEnable(GL_SCISSOR_TEST);
+                glEnable(GL_BLEND);
+
+                glViewport(
+                    static_cast<GLint>(viewport.min.x),
+                    static_cast<GLint>(viewport.min.y),
+                    static_cast<GLsizei>(viewport.w()),
+                    static_cast<GLsizei>(viewport.h()));
+                glScissor(
+                    static_cast<GLint>(viewport.min.x),
+                    static_cast<GLint>(viewport.min.y),
+                    static_cast<GLsizei>(viewport.w()),
+                    static_cast<GLsizei>(viewport.h()));
+                glClearColor(0.F, 0.F, 0.F, 0.F);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                const auto viewMatrix = glm::ortho(
+                    viewport.min.x,
+                    viewport.max.x,
+                    viewport.max.y,
+                    viewport.min.y,
+                    -1.F, 1.F);
+                shader->setUniform(mvpLoc, viewMatrix);
+
+                const auto& atlasTextures = textureAtlas->getTextures();
+                for (GLuint i = 0; i < static_cast<GLuint>(atlasTextures.size()); ++i)
+                {
+                    glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + i));
+                    glBindTexture(GL_TEXTURE_2D, atlasTextures[i]);
+                }
+
+                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                if (!vbo || vboDataSize / vertexByteCount > vbo->getSize())
+                {
+                    vbo = OpenGL::VBO::create(vboDataSize / vertexByteCount, OpenGL::VBOType::Pos2_F32_UV_U16);
+                    vao = OpenGL::VAO::create(vbo->getType(), vbo->getID());
+                }
+                vbo->copy(vboData, 0, vboDataSize);
+                vao->bind();
+
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                for (const auto& command : drawCommands)
+                {
+                    const auto primitive = command.primitive;
+                    if (command.scissor)
+                    {
+                        const BBox2f clipRect = flip(primitive->clipRect, size);
+                        glScissor(
+                            static_cast<GLint>(clipRect.min.x),
+                            static_cast<GLint>(clipRect.min.y),
+                            static_cast<GLsizei>(clipRect.w()),
+                            static_cast<GLsizei>(clipRect.h()));
+                    }
+                    if (command.alphaBlend)
+                    {
+                        switch (primitive->alphaBlend)
+                        {
+                        case AlphaBlend::None:
+                            glBlendFunc(GL_ONE, GL_ZERO);
+                            break;
+                        case AlphaBlend::Straight:
+                            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                            break;
+                        case AlphaBlend::Premultiplied:
+                            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                            break;
+                        default: break;
+                        }
+                    }
+                    if (command.colorMask)
+                    {
+                        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                    }
+                    if (command.bind)
+                    {
+                        primitive->bind(primitiveData, shader);
+                    }
+                    if (primitive->lcdText)
+                    {
+                        shader->setUniform(primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaR));
+                        glColorMask(GL_TRUE, GL_FALSE, GL_FALSE, GL_TRUE);
+                        vao->draw(primitive->type, primitive->vaoOffset, command.vaoSize);
+                        shader->setUniform(primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaG));
+                        glColorMask(GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE);
+                        vao->draw(primitive->type, primitive->vaoOffset, command.vaoSize);
+                        shader->setUniform(primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaB));
+                        glColorMask(GL_FALSE, GL_FALSE, GL_TRUE, GL_FALSE);
+                        vao->draw(primitive->type, primitive->vaoOffset, command.vaoSize);
+                    }
+                    else
+                    {
+                        vao->draw(primitive->type, primitive->vaoOffset, command.vaoSize);
+                    }
+                }
+            }
+
+            namespace
+            {
+                uint64_t getSizeClass(const Image::Info& info)
+                {
+                    return
+                        (static_cast<uint64_t>(info.size.w) << 32) |
+                        (static_cast<uint64_t>(info.size.h) << 16) |
+                        static_cast<uint64_t>(info.type);
+                }
+
+                //! Integer textures cannot be filtered so they don't use mipmaps.
+                bool hasMipmaps(Image::Type type)
+                {
+                    return Image::getDataType(type) != Image::DataType::U32;
+                }
+
+                GLenum toGLMipmap(ImageFilter value)
+                {
+                    GLenum out = GL_NONE;
+                    switch (value)
+                    {
+                    case ImageFilter::Nearest: out = GL_NEAREST_MIPMAP_NEAREST; break;
+                    case ImageFilter::Linear:  out = GL_LINEAR_MIPMAP_LINEAR;   break;
+                    default: break;
+                    }
+                    return out;
+                }
+
+                //! Get the mipmap level for an image drawn with the given
+                //! transformed corners. Only the levels down to mipmapLevelMax
+                //! are reduced on the CPU, the GPU generates the rest.
+                uint8_t getMipLevel(const Image::Info& info, const glm::vec3 pts[4])
+                {
+                    uint8_t out = 0;
+                    if (hasMipmaps(info.type))
+                    {
+                        const float scale = std::max(
+                            glm::length(glm::vec2(pts[1] - pts[0])) / info.size.w,
+                            glm::length(glm::vec2(pts[3] - pts[0])) / info.size.h);
+                        if (scale > 0.F && scale < 1.F)
+                        {
+                            out = static_cast<uint8_t>(Math::clamp(
+                                static_cast<int>(std::floor(std::log2(1.F / scale))),
+                                0,
+                                static_cast<int>(mipmapLevelMax)));
+                        }
+                    }
+                    return out;
+                }
+
+                std::shared_ptr<Image::Data> getMipmap(const Image::Data& data, uint8_t level)
+                {
+                    Image::Info info = data.getInfo();
+                    info.size = Image::getMipmapSize(info.size, level);
+                    auto out = Image::Data::create(info);
+                    Image::mipmap(data, *out, level);
+                    return out;
+                }
+
+            } // namespace
+
+            std::shared_ptr<OpenGL::Texture> Render2D::Private::getDynamicTexture(const Image::Info& info)
+            {
+                std::shared_ptr<OpenGL::Texture> out;
+                const uint64_t sizeClass = getSizeClass(info);
+                const size_t byteCount = info.getDataByteCount();
+
+                // Re-use an unused texture with the same size class.
+                const auto i = dynamicTexturePool.find(sizeClass);
+                if (i != dynamicTexturePool.end() && i->second.size())
+                {
+                    out = i->second.front();
+                    i->second.pop_front();
+                    if (i->second.empty())
+                    {
+                        dynamicTexturePool.erase(i);
+                    }
+                    --dynamicTexturePoolCount;
+                    dynamicTexturePoolByteCount -= out->getInfo().getDataByteCount();
+                }
+
+                // If the cache is full re-use the least recently used texture
+                // with the same size class.
+                if (!out && dynamicTextureCacheByteCount + byteCount > dynamicTextureByteCountMax)
+                {
+                    for (auto j = dynamicTextureLRU.rbegin(); j != dynamicTextureLRU.rend(); ++j)
+                    {
+                        const auto k = dynamicTextureCache.find(*j);
+                        if (k->second.frame != frame && getSizeClass(k->second.texture->getInfo()) == sizeClass)
+                        {
+                            out = k->second.texture;
+                            removeDynamicTexture(k);
+                            break;
+                        }
+                    }
+                }
+
+                if (out)
+                {
+                    out->set(info);
+                }
+                else
+                {
+                    out = OpenGL::Texture::create(
+                        info,
+                        imageFilterOptions.mipmaps && hasMipmaps(info.type) ?
+                            toGLMipmap(imageFilterOptions.min) :
+                            toGL(imageFilterOptions.min),
+                        toGL(imageFilterOptions.mag));
+                }
+                return out;
+            }
+
+            void Render2D::Private::addDynamicTexture(UID uid, const std::shared_ptr<OpenGL::Texture>& texture, uint8_t mipLevel)
+            {
+                const auto i = dynamicTextureCache.find(uid);
+                if (i != dynamicTextureCache.end())
+                {
+                    removeDynamicTexture(i);
+                }
+                DynamicTexture value;
+                value.texture = texture;
+                value.byteCount = texture->getInfo().getDataByteCount();
+                value.frame = frame;
+                value.mipLevel = mipLevel;
+                dynamicTextureLRU.push_front(uid);
+                value.lru = dynamicTextureLRU.begin();
+                dynamicTextureCache[uid] = value;
+                dynamicTextureCacheByteCount += value.byteCount;
+            }
+
+            void Render2D::Private::touchDynamicTexture(DynamicTexture& value)
+            {
+                value.frame = frame;
+                dynamicTextureLRU.splice(dynamicTextureLRU.begin(), dynamicTextureLRU, value.lru);
+            }
+
+            void Render2D::Private::removeDynamicTexture(std::map<UID, DynamicTexture>::iterator i)
+            {
+                dynamicTextureCacheByteCount -= i->second.byteCount;
+                dynamicTextureLRU.erase(i->second.lru);
+                dynamicTextureCache.erase(i);
+            }
+
+            void Render2D::Private::updateDynamicTextureCache()
+            {
+                // Move the least recently used textures to the pool. Textures
+                // used by the current frame are kept.
+                while (dynamicTextureCacheByteCount > dynamicTextureByteCountMax && dynamicTextureLRU.size())
+                {
+                    const auto i = dynamicTextureCache.find(dynamicTextureLRU.back());
+                    if (i->second.frame == frame)
+                        break;
+                    auto texture = i->second.texture;
+                    const size_t byteCount = i->second.byteCount;
+                    removeDynamicTexture(i);
+                    dynamicTexturePool[getSizeClass(texture->getInfo())].push_back(texture);
+                    ++dynamicTexturePoolCount;
+                    dynamicTexturePoolByteCount += byteCount;
+                }
+
+                // Release pool textures that do not fit in the budget.
+                while (dynamicTexturePoolCount > 0 &&
+                    (dynamicTexturePoolCount > dynamicTexturePoolMax ||
+                    dynamicTextureCacheByteCount + dynamicTexturePoolByteCount > dynamicTextureByteCountMax))
+                {
+                    auto i = dynamicTexturePool.begin();
+                    dynamicTexturePoolByteCount -= i->second.front()->getInfo().getDataByteCount();
+                    --dynamicTexturePoolCount;
+                    i->second.pop_front();
+                    if (i->second.empty())
+                    {
+                        dynamicTexturePool.erase(i);
+                    }
+                }
+            }
+
+            void Render2D::Private::clearDynamicTextureCache()
+            {
+                dynamicTextureCache.clear();
+                dynamicTextureLRU.clear();
+                dynamicTextureCacheByteCount = 0;
+                dynamicTexturePool.clear();
+                dynamicTexturePoolCount = 0;
+                dynamicTexturePoolByteCount = 0;
+            }
+
+            void Render2D::Private::uploadDynamicTexture(const std::shared_ptr<Image::Image>& image, uint8_t mipLevel)
+            {
+                const UID uid = image->getUID();
+#if !defined(DJV_OPENGL_ES2)
+                for (auto& i : textureStreams)
+                {
+                    if (i.image && i.image->getUID() == uid)
+                    {
+                        const bool done = i.mipLevel <= mipLevel;
+                        finishTextureStream(i);
+                        if (done)
+                            return;
+                        break;
+                    }
+                }
+#endif // DJV_OPENGL_ES2
+                std::shared_ptr<Image::Data> data = image;
+                if (mipLevel > 0)
+                {
+                    data = getMipmap(*image, mipLevel);
+                }
+                auto texture = getDynamicTexture(data->getInfo());
+                texture->copy(*data);
+                if (imageFilterOptions.mipmaps && hasMipmaps(data->getType()))
+                {
+                    texture->generateMipmaps();
+                }
+                addDynamicTexture(uid, texture, mipLevel);
+                textureUploadByteCount += data->getDataByteCount();
+            }
+
+            void Render2D::Private::updateTextureStreams()
+            {
+#if !defined(DJV_OPENGL_ES2)
+                if (!textureStreams.size())
+                {
+                    textureStreams.resize(textureStreamCount);
+                    for (auto& i : textureStreams)
+                    {
+                        glGenBuffers(1, &i.pbo);
+                    }
+                }
+
+                // Finish the uploads where the worker thread is done.
+                for (auto& i : textureStreams)
+                {
+                    if (i.image && i.copy.valid() &&
+                        i.copy.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        finishTextureStream(i);
+                    }
+                }
+
+                // Start uploads for the images that are not resident at the
+                // mipmap level of the last drawn image.
+                for (const auto& image : streamImages)
+                {
+                    const UID uid = image->getUID();
+                    const uint8_t mipLevel = hasMipmaps(image->getType()) ? streamMipLevel : 0;
+                    const auto j = dynamicTextureCache.find(uid);
+                    if (j != dynamicTextureCache.end() && j->second.mipLevel <= mipLevel)
+                        continue;
+                    TextureStream* stream = nullptr;
+                    bool inFlight = false;
+                    for (auto& i : textureStreams)
+                    {
+                        if (i.image && i.image->getUID() == uid)
+                        {
+                            inFlight = true;
+                            break;
+                        }
+                        if (!i.image && !stream)
+                        {
+                            stream = &i;
+                        }
+                    }
+                    if (inFlight)
+                        continue;
+                    if (!stream)
+                        break;
+                    Image::Info info = image->getInfo();
+                    info.size = Image::getMipmapSize(info.size, mipLevel);
+                    const size_t byteCount = info.getDataByteCount();
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream->pbo);
+                    if (byteCount > stream->byteCount)
+                    {
+                        glBufferData(GL_PIXEL_UNPACK_BUFFER, byteCount, 0, GL_STREAM_DRAW);
+                        stream->byteCount = byteCount;
+                    }
+                    void* data = glMapBufferRange(
+                        GL_PIXEL_UNPACK_BUFFER,
+                        0,
+                        byteCount,
+                        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    if (data)
+                    {
+                        stream->image = image;
+                        stream->info = info;
+                        stream->mipLevel = mipLevel;
+                        stream->copy = std::async(
+                            std::launch::async,
+                            [image, data, byteCount, mipLevel]
+                            {
+                                if (mipLevel > 0)
+                                {
+                                    memcpy(data, getMipmap(*image, mipLevel)->getData(), byteCount);
+                                }
+                                else
+                                {
+                                    memcpy(data, image->getData(), byteCount);
+                                }
+                            });
+                    }
+                }
+#endif // DJV_OPENGL_ES2
+                streamImages.clear();
+            }
+
+#if !defined(DJV_OPENGL_ES2)
+            void Render2D::Private::finishTextureStream(TextureStream& stream)
+            {
+                stream.copy.get();
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream.pbo);
+                const bool valid = glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                const auto& image = stream.image;
+                auto texture = getDynamicTexture(stream.info);
+                if (valid)
+                {
+                    texture->copy(stream.pbo, stream.info);
+                }
+                else if (stream.mipLevel > 0)
+                {
+                    // The buffer contents were lost, fall back to a direct copy.
+                    texture->copy(*getMipmap(*image, stream.mipLevel));
+                }
+                else
+                {
+                    texture->copy(*image);
+                }
+                if (imageFilterOptions.mipmaps && hasMipmaps(stream.info.type))
+                {
+                    texture->generateMipmaps();
+                }
+                addDynamicTexture(image->getUID(), texture, stream.mipLevel);
+                textureUploadByteCount += stream.info.getDataByteCount();
+                stream.image.reset();
+            }
+#endif // DJV_OPENGL_ES2
+
+            void Render2D::Private::updateTextureUploadBandwidth()
+            {
+                const auto now = std::chrono::steady_clock::now();
+                const std::chrono::duration<float> delta = now - textureUploadTime;
+                if (delta.count() >= 1.F)
+                {
+                    textureUploadBandwidth = static_cast<size_t>(textureUploadByteCount / delta.count());
+                    textureUploadByteCount = 0;
+                    textureUploadTime = now;
+                }
+            }
+
             void Render2D::Private::drawImage(
                 const std::shared_ptr<Image::Image>& image,
                 const glm::vec2& pos,
@@ -1493,7 +2570,7 @@ namespace djv
 
                 if (bbox.intersects(currentClipRect))
                 {
-                    auto primitive = new ImagePrimitive;
+                    auto primitive = imagePrimitivePool.create();
                     primitives.push_back(primitive);
                     primitive->clipRect = currentClipRect;
                     primitive->imageChannels = Image::getChannels(info.type);
@@ -1570,27 +2647,22 @@ namespace djv
                     }
                     case ImageCache::Dynamic:
                     {
-                        const auto i = dynamicTextureCache.find(uid);
-                        if (i != dynamicTextureCache.end())
+                        if (Backend::OpenGL == backend)
                         {
-                            primitive->textureID = i->second->getID();
-                        }
-                        else
-                        {
-                            std::shared_ptr<OpenGL::Texture> texture;
-                            if (dynamicTextures.size())
-                            {
-                                texture = dynamicTextures.back();
-                                dynamicTextures.pop_back();
-                                texture->set(image->getInfo());
-                            }
-                            else
+                            const uint8_t mipLevel = imageFilterOptions.mipmaps ? getMipLevel(info, pts) : 0;
+                            streamMipLevel = mipLevel;
+                            auto i = dynamicTextureCache.find(uid);
+                            if (i == dynamicTextureCache.end() || i->second.mipLevel > mipLevel)
                             {
-                                texture = OpenGL::Texture::create(image->getInfo(), GL_LINEAR, GL_NEAREST);
+                                // The image was not streamed ahead of time or the
+                                // resident mipmap level is too small, so wait for
+                                // the upload.
+                                uploadDynamicTexture(image, mipLevel);
+                                ++textureUploadStallCount;
+                                i = dynamicTextureCache.find(uid);
                             }
-                            texture->copy(*image);
-                            dynamicTextureCache[uid] = texture;
-                            primitive->textureID = texture->getID();
+                            touchDynamicTexture(i->second);
+                            primitive->textureID = i->second.texture->getID();
                         }
                         if (info.layout.mirror.x)
                         {
@@ -1627,45 +2699,9 @@ namespace djv
                         textureV.max = 1.F - textureV.max;
                     }
 #if !defined(DJV_OPENGL_ES2)
-                    if (options.colorSpace.isValid())
+                    if (options.colorSpace.isValid() && Backend::OpenGL == backend)
                     {
-                        ColorSpaceData colorSpaceData;
-                        const auto i = colorSpaceCache.find(options.colorSpace);
-                        if (i != colorSpaceCache.end())
-                        {
-                            colorSpaceData = i->second;
-                        }
-                        else
-                        {
-                            try
-                            {
-                                colorSpaceData.id = colorSpaceID++;
-                                colorSpaceData.lut3D.reset(new LUT3D);
-                                auto config = _OCIO::GetCurrentConfig();
-                                auto processor = config->getProcessor(options.colorSpace.input.c_str(), options.colorSpace.output.c_str());
-                                _OCIO::GpuShaderDesc shaderDesc;
-                                shaderDesc.setLanguage(_OCIO::GPU_LANGUAGE_GLSL_1_3);
-                                std::stringstream ss;
-                                ss << "colorSpace" << colorSpaceData.id;
-                                shaderDesc.setFunctionName(ss.str().c_str());
-                                shaderDesc.setLut3DEdgeLen(colorSpaceData.lut3D->getEdgeLen());
-                                colorSpaceData.shaderSource = processor->getGpuShaderText(shaderDesc);
-                                size_t index = colorSpaceData.shaderSource.find("texture3D");
-                                if (index != std::string::npos)
-                                {
-                                    colorSpaceData.shaderSource.replace(index, std::string("texture3D").size(), "texture");
-                                }
-                                auto data = colorSpaceData.lut3D->getData();
-                                processor->getGpuLut3D(data, shaderDesc);
-                                colorSpaceData.lut3D->copy();
-                                colorSpaceCache[options.colorSpace] = colorSpaceData;
-                                shader.reset();
-                            }
-                            catch (const std::exception& e)
-                            {
-                                system->_log(e.what());
-                            }
-                        }
+                        const ColorSpaceData colorSpaceData = getColorSpace(options.colorSpace);
                         primitive->colorSpace = colorSpaceData.id;
                         primitive->colorSpaceTextureID = colorSpaceData.lut3D ? colorSpaceData.lut3D->getID() : 0;
                     }
@@ -1699,6 +2735,169 @@ namespace djv
                 }
             }
 
+            void Render2D::Private::getGlyphItem(const std::shared_ptr<Font::Glyph>& glyph, TextureAtlasItem& item)
+            {
+                const auto uid = glyph->imageData->getUID();
+                uint64_t id = 0;
+                const auto i = glyphTextureIDs.find(uid);
+                if (i != glyphTextureIDs.end())
+                {
+                    id = i->second;
+                }
+                if (!textureAtlas->getItem(id, item))
+                {
+                    id = textureAtlas->addItem(glyph->imageData, item);
+                    glyphTextureIDs[uid] = id;
+                }
+            }
+
+            TextPrimitive* Render2D::Private::createTextPrimitive(const BBox2f& clipRect, const float color[4], uint8_t atlasIndex)
+            {
+                auto out = textPrimitivePool.create();
+                out->clipRect = clipRect;
+                out->color[0] = color[0];
+                out->color[1] = color[1];
+                out->color[2] = color[2];
+                out->color[3] = color[3];
+                out->atlasIndex = atlasIndex;
+                out->vaoOffset = vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                out->vaoSize = 0;
+                out->lcdText = lcdText;
+                primitives.push_back(out);
+                return out;
+            }
+
+            void Render2D::Private::addTextVertices(const BBox2f& bbox, const uint16_t u[2], const uint16_t v[2])
+            {
+                const size_t vboDataSize = this->vboDataSize;
+                updateVBODataSize(6);
+                VBOVertex* pData = reinterpret_cast<VBOVertex*>(&vboData[vboDataSize]);
+                pData->vx = bbox.min.x;
+                pData->vy = bbox.min.y;
+                pData->tx = u[0];
+                pData->ty = v[0];
+                ++pData;
+                pData->vx = bbox.max.x;
+                pData->vy = bbox.min.y;
+                pData->tx = u[1];
+                pData->ty = v[0];
+                ++pData;
+                pData->vx = bbox.max.x;
+                pData->vy = bbox.max.y;
+                pData->tx = u[1];
+                pData->ty = v[1];
+                ++pData;
+                pData->vx = bbox.max.x;
+                pData->vy = bbox.max.y;
+                pData->tx = u[1];
+                pData->ty = v[1];
+                ++pData;
+                pData->vx = bbox.min.x;
+                pData->vy = bbox.max.y;
+                pData->tx = u[0];
+                pData->ty = v[1];
+                ++pData;
+                pData->vx = bbox.min.x;
+                pData->vy = bbox.min.y;
+                pData->tx = u[0];
+                pData->ty = v[0];
+            }
+
+#if !defined(DJV_OPENGL_ES2)
+            ColorSpaceData Render2D::Private::getColorSpace(const OCIO::Convert& value)
+            {
+                ColorSpaceData out;
+                const auto i = colorSpaceCache.find(value);
+                if (i != colorSpaceCache.end())
+                {
+                    i->second.frame = frame;
+                    out = i->second;
+                }
+                else
+                {
+                    const auto j = colorSpaceBuilds.find(value);
+                    if (j == colorSpaceBuilds.end())
+                    {
+                        // Start building the conversion in the background. The image
+                        // is drawn without the conversion until it is finished.
+                        colorSpaceBuilds[value] = std::async(
+                            std::launch::async,
+                            buildColorSpace,
+                            value,
+                            lut3DSize,
+                            colorSpaceDiskCachePath);
+                    }
+                    else if (j->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        auto build = j->second.get();
+                        colorSpaceBuilds.erase(j);
+                        addColorSpace(value, build);
+                        out = colorSpaceCache[value];
+                    }
+                }
+                return out;
+            }
+
+            void Render2D::Private::addColorSpace(const OCIO::Convert& value, ColorSpaceBuild& build)
+            {
+                ColorSpaceData data;
+                data.frame = frame;
+                if (build.error.empty())
+                {
+                    data.id = static_cast<int>(colorSpaceID++);
+                    std::stringstream ss;
+                    ss << "colorSpace" << data.id;
+                    const std::string functionName = ss.str();
+                    size_t index = build.shaderSource.find(colorSpaceFunctionName);
+                    while (index != std::string::npos)
+                    {
+                        build.shaderSource.replace(index, colorSpaceFunctionName.size(), functionName);
+                        index = build.shaderSource.find(colorSpaceFunctionName, index + functionName.size());
+                    }
+                    data.shaderSource = build.shaderSource;
+                    data.lut3D.reset(new LUT3D);
+                    memcpy(data.lut3D->getData(), build.lut3D.data(), data.lut3D->getSize() * sizeof(float));
+                    data.lut3D->copy();
+                    if (build.diskCacheHit)
+                    {
+                        ++colorSpaceDiskCacheHits;
+                    }
+                    shader.reset();
+                }
+                else
+                {
+                    // Keep the failed conversion in the cache so that it is not
+                    // re-built every frame.
+                    system->_log(build.error, LogLevel::Error);
+                }
+                colorSpaceCache[value] = data;
+            }
+
+            void Render2D::Private::updateColorSpaceCache()
+            {
+                // Remove the least recently used conversions. The shader is not
+                // re-compiled, the unused functions are removed the next time a
+                // new conversion is added.
+                while (colorSpaceCache.size() > colorSpaceCacheMax)
+                {
+                    auto lru = colorSpaceCache.end();
+                    for (auto i = colorSpaceCache.begin(); i != colorSpaceCache.end(); ++i)
+                    {
+                        if (i->second.frame != frame &&
+                            (lru == colorSpaceCache.end() || i->second.frame < lru->second.frame))
+                        {
+                            lru = i;
+                        }
+                    }
+                    if (lru == colorSpaceCache.end())
+                    {
+                        break;
+                    }
+                    colorSpaceCache.erase(lru);
+                }
+            }
+#endif // DJV_OPENGL_ES2
+
             std::string Render2D::Private::getFragmentSource() const
             {
                 std::string out = fragmentSource;
@@ -1709,6 +2908,10 @@ namespace djv
                 size_t i = 0;
                 for (const auto& j : colorSpaceCache)
                 {
+                    if (!j.second.id)
+                    {
+                        continue;
+                    }
                     functions += j.second.shaderSource;
                     {
                         std::stringstream ss;
@@ -1783,6 +2986,7 @@ namespace djv
             picojson::value object(picojson::object_type, true);
             out.get<picojson::object>()["Min"] = toJSON(value.min);
             out.get<picojson::object>()["Mag"] = toJSON(value.mag);
+            out.get<picojson::object>()["Mipmaps"] = toJSON(value.mipmaps);
         }
         return out;
     }
@@ -1816,6 +3020,10 @@ namespace djv
                     std::stringstream ss(i.second.get<std::string>());
                     ss >> out.mag;
                 }
+                else if ("Mipmaps" == i.first)
+                {
+                    fromJSON(i.second, out.mipmaps);
+                }
             }
         }
         else
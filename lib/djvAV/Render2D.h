@@ -33,11 +33,13 @@
 #include <djvAV/FontSystem.h>
 #include <djvAV/Image.h>
 #include <djvAV/OCIO.h>
+#include <djvAV/TiledImage.h>
 
 #include <djvCore/BBox.h>
 #include <djvCore/ISystem.h>
 #include <djvCore/PicoJSON.h>
 #include <djvCore/Range.h>
+#include <djvCore/ValueObserver.h>
 
 #include <list>
 
@@ -176,28 +178,76 @@ namespace djv
             {
             public:
                 ImageFilterOptions();
-                ImageFilterOptions(ImageFilter min, ImageFilter mag);
+                ImageFilterOptions(ImageFilter min, ImageFilter mag, bool mipmaps = false);
 
                 ImageFilter min = ImageFilter::Linear;
                 ImageFilter mag = ImageFilter::Nearest;
 
+                //! Use mipmaps for dynamic textures when the image is drawn
+                //! smaller than its size.
+                bool mipmaps = false;
+
                 bool operator == (const ImageFilterOptions&) const;
                 bool operator != (const ImageFilterOptions&) const;
             };
 
-            //! This class provides a 2D renderer.
+            //! This class provides a run of text glyphs. The glyph positions and
+            //! texture atlas coordinates are computed the first time the run is
+            //! drawn and re-used until items are removed from the texture atlas.
+            class TextRun
+            {
+            public:
+                TextRun();
+                explicit TextRun(const std::vector<std::shared_ptr<Font::Glyph> >&);
+
+                const std::vector<std::shared_ptr<Font::Glyph> >& getGlyphs() const;
+
+                void setGlyphs(const std::vector<std::shared_ptr<Font::Glyph> >&);
+
+            private:
+                struct Quad
+                {
+                    Core::BBox2f bbox;
+                    uint8_t      textureIndex = 0;
+                    uint16_t     u[2]         = { 0, 0 };
+                    uint16_t     v[2]         = { 0, 0 };
+                };
+
+                std::vector<std::shared_ptr<Font::Glyph> > _glyphs;
+                std::vector<Quad> _quads;
+                size_t _atlasGeneration = 0;
+
+                friend class Render2D;
+            };
+
+            //! This enumeration provides the render back ends.
+            enum class Backend
+            {
+                OpenGL, //!< Draw the recorded commands with OpenGL
+                Record  //!< Only record the commands, no OpenGL context is needed
+            };
+
+            //! This class provides a 2D renderer. The draw functions record
+            //! primitives and vertex data, and endFrame() batches them into
+            //! draw commands which are then submitted by the back end.
             class Render2D : public Core::ISystem
             {
                 DJV_NON_COPYABLE(Render2D);
 
             protected:
-                void _init(const std::shared_ptr<Core::Context>&);
+                void _init(const std::shared_ptr<Core::Context>&, Backend);
                 Render2D();
 
             public:
                 ~Render2D();
 
-                static std::shared_ptr<Render2D> create(const std::shared_ptr<Core::Context>&);
+                static std::shared_ptr<Render2D> create(
+                    const std::shared_ptr<Core::Context>&,
+                    Backend = Backend::OpenGL);
+
+                Backend getBackend() const;
+
+                void tick(const std::chrono::steady_clock::time_point&, const Core::Time::Unit&) override;
 
                 //! \name Begin and End
                 ///@{
@@ -256,6 +306,14 @@ namespace djv
                 //! This function should only be called outside of beginFrame()/endFrame().
                 void setImageFilterOptions(const ImageFilterOptions&);
 
+                //! Get the maximum number of bytes used by dynamic textures.
+                size_t getDynamicTextureCacheMax() const;
+
+                //! Set the maximum number of bytes used by dynamic textures. When
+                //! the cache is full the least recently drawn textures are
+                //! re-used.
+                void setDynamicTextureCacheMax(size_t);
+
                 void drawImage(
                     const std::shared_ptr<Image::Image> &,
                     const glm::vec2& pos,
@@ -266,6 +324,27 @@ namespace djv
                     const glm::vec2& pos,
                     const ImageOptions & = ImageOptions());
 
+                //! Draw the visible tiles of a tiled image. Only the tiles that
+                //! are cached are drawn, the missing tiles are read in the
+                //! background so the image should be drawn again while
+                //! Image::TiledImage::getTileRequestCount() is not zero. When
+                //! the image is zoomed out the overview is drawn instead of the
+                //! tiles. The tiles are always drawn with dynamic textures.
+                void drawTiledImage(
+                    const std::shared_ptr<Image::TiledImage>&,
+                    const glm::vec2& pos,
+                    const ImageOptions& = ImageOptions());
+
+                //! Upload images to dynamic textures ahead of drawing them. The
+                //! uploads are started by endFrame() and finish in a later frame,
+                //! so this should be given the images that will be drawn next.
+                void streamImages(const std::vector<std::shared_ptr<Image::Image> >&);
+
+                //! Observe the number of color space conversions that have been
+                //! built in the background. This is incremented each time a
+                //! conversion is ready to be drawn.
+                std::shared_ptr<Core::IValueSubject<size_t> > observeColorSpacesReady() const;
+
                 ///@}
 
                 //! \name Text
@@ -275,6 +354,7 @@ namespace djv
                 void setLCDText(bool);
 
                 void drawText(const std::vector<std::shared_ptr<Font::Glyph> >& glyphs, const glm::vec2& position);
+                void drawText(TextRun&, const glm::vec2& position);
 
                 ///@}
 
@@ -290,9 +370,39 @@ namespace djv
                 ///@{
 
                 float getTextureAtlasPercentage() const;
+
+                //! Get the percentage of each texture atlas page used by items.
+                std::vector<float> getTextureAtlasPageOccupancy() const;
+
+                size_t getTextureAtlasEvictionCount() const;
+                size_t getTextureAtlasCompactionCount() const;
+
+                //! Get the number of times text runs have been laid out.
+                size_t getTextRunLayoutCount() const;
+
                 size_t getDynamicTextureCount() const;
+                size_t getDynamicTextureCacheByteCount() const;
                 size_t getVBOSize() const;
 
+                //! Get the number of bytes of vertex data recorded by the last frame.
+                size_t getVBODataByteCount() const;
+
+                //! Get the number of primitives drawn by the last frame.
+                size_t getPrimitiveCount() const;
+
+                //! Get the number of draw calls made by the last frame. Adjacent
+                //! primitives that share the same state are drawn together.
+                size_t getDrawCallCount() const;
+
+                //! Get the number of OpenGL state changes made by the last frame.
+                size_t getStateChangeCount() const;
+
+                //! Get the texture upload bandwidth in bytes per second.
+                size_t getTextureUploadBandwidth() const;
+
+                //! Get the number of times drawing had to wait for a texture upload.
+                size_t getTextureUploadStallCount() const;
+
                 ///@}
 
             private:
@@ -35,6 +35,25 @@ namespace djv
     {
         namespace Render
         {
+            inline TextRun::TextRun()
+            {}
+
+            inline TextRun::TextRun(const std::vector<std::shared_ptr<Font::Glyph> >& value) :
+                _glyphs(value)
+            {}
+
+            inline const std::vector<std::shared_ptr<Font::Glyph> >& TextRun::getGlyphs() const
+            {
+                return _glyphs;
+            }
+
+            inline void TextRun::setGlyphs(const std::vector<std::shared_ptr<Font::Glyph> >& value)
+            {
+                _glyphs = value;
+                _quads.clear();
+                _atlasGeneration = 0;
+            }
+
             inline ImageColor::ImageColor()
             {}
             
@@ -115,14 +134,15 @@ namespace djv
             inline ImageFilterOptions::ImageFilterOptions()
             {}
 
-            inline ImageFilterOptions::ImageFilterOptions(ImageFilter min, ImageFilter mag) :
+            inline ImageFilterOptions::ImageFilterOptions(ImageFilter min, ImageFilter mag, bool mipmaps) :
                 min(min),
-                mag(mag)
+                mag(mag),
+                mipmaps(mipmaps)
             {}
 
             inline bool ImageFilterOptions::operator == (const ImageFilterOptions& other) const
             {
-                return min == other.min && mag == other.mag;
+                return min == other.min && mag == other.mag && mipmaps == other.mipmaps;
             }
 
             inline bool ImageFilterOptions::operator != (const ImageFilterOptions& other) const
@@ -30,6 +30,7 @@
 #include <djvAV/SequenceIO.h>
 
 #include <djvAV/ImageConvert.h>
+#include <djvAV/OCIOProcessor.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/FileSystem.h>
@@ -43,7 +44,10 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <chrono>
+#include <cstring>
 #include <future>
+#include <thread>
 
 using namespace djv::Core;
 
@@ -55,8 +59,16 @@ namespace djv
         {
             namespace
             {
-                //! \todo Should this be configurable?
+                //! \todo Should these be configurable?
                 const double infoTimeout = 0.5;
+                const float statsSmoothing = .1F;
+
+                float smooth(float prev, double value)
+                {
+                    return prev > 0.F ?
+                        (prev + (static_cast<float>(value) - prev) * statsSmoothing) :
+                        static_cast<float>(value);
+                }
 
             } // namespace
 
@@ -64,6 +76,11 @@ namespace djv
             {
                 Frame::Number frame = Frame::invalid;
                 std::shared_ptr<Image::Image> image;
+                double decodeTime = 0.0;
+                std::shared_ptr<Image::CompressedImage> compressed;
+                double compressTime = 0.0;
+                bool decompressed = false;
+                double decompressTime = 0.0;
             };
 
             struct ISequenceRead::Private
@@ -77,6 +94,16 @@ namespace djv
                 std::thread thread;
                 std::atomic<bool> running;
                 std::chrono::system_clock::time_point infoTimer;
+                FileSystem::FileNameTemplate fileNameTemplate;
+                std::string fileName;
+                std::vector<Frame::Index> cacheIndices;
+                std::vector<Frame::Number> cacheFrames;
+                std::vector<std::string> fileNames;
+                ThreadController threadController;
+                size_t videoQueueCount = 0;
+                float compressTime = 0.F;
+                float decompressTime = 0.F;
+                float compressRatio = 0.F;
             };
 
             void ISequenceRead::_init(
@@ -86,38 +113,41 @@ namespace djv
                 const std::shared_ptr<LogSystem>& logSystem)
             {
                 IRead::_init(fileInfo, options, resourceSystem, logSystem);
+
+                DJV_PRIVATE_PTR();
                 _speed = Time::Speed();
-                _p->running = true;
-                _p->thread = std::thread(
-                    [this]
-                {
-                    DJV_PRIVATE_PTR();
 
-                    // Get the sequence.
-                    size_t sequenceSize = 0;
-                    p.frame = Frame::invalid;
-                    if (_fileInfo.isSequenceValid())
+                // Get the sequence.
+                p.frame = Frame::invalid;
+                if (_fileInfo.isSequenceValid())
+                {
+                    _sequence = _fileInfo.getSequence();
+                    if (_sequence.getSize())
                     {
-                        _sequence = _fileInfo.getSequence();
-                        sequenceSize = _sequence.getSize();
-                        if (sequenceSize)
-                        {
-                            p.frame = 0;
-                        }
+                        p.frame = 0;
                     }
+                }
+                p.fileNameTemplate = _fileInfo.getFileNameTemplate();
+                p.threadController.setQueueSize(_videoQueue.getMax());
+
+                // Without a thread the file is read on demand by getInfo()
+                // and readImage().
+                p.running = options.thread;
+                if (!options.thread)
+                {
+                    return;
+                }
+
+                p.thread = std::thread(
+                    [this]
+                {
+                    DJV_PRIVATE_PTR();
 
                     // Read the file information.
-                    Frame::Number frameNumber = Frame::invalid;
-                    if (sequenceSize)
-                    {
-                        frameNumber = _sequence.getFrame(0);
-                    }
                     Info info;
-                    std::string fileName = _fileInfo.getFileName(frameNumber);
                     try
                     {
-                        info = _readInfo(fileName);
-                        info.fileName = _fileInfo.getFileName();
+                        info = _readFirstInfo();
                         p.infoPromise.set_value(info);
                     }
                     catch (const std::exception&)
@@ -149,6 +179,7 @@ namespace djv
                         InOutPoints inOutPoints;
                         bool cacheEnabled = false;
                         size_t cacheMaxByteCount = 0;
+                        bool cacheCompression = false;
                         {
                             std::lock_guard<std::mutex> lock(_mutex);
                             threadCount = _threadCount;
@@ -156,14 +187,31 @@ namespace djv
                             inOutPoints = _inOutPoints;
                             cacheEnabled = _cacheEnabled;
                             cacheMaxByteCount = _cacheMaxByteCount;
+                            cacheCompression = _cacheCompression;
                         }
                         if (!cacheEnabled)
                         {
                             _cache.clear();
                         }
+
+                        // During playback the thread controller picks the
+                        // number of threads, up to the thread count or the
+                        // number of hardware threads.
+                        const size_t hardwareThreadCount = std::thread::hardware_concurrency();
+                        p.threadController.setThreadMax(hardwareThreadCount > 0 ?
+                            std::min(threadCount, hardwareThreadCount) :
+                            threadCount);
+                        p.threadController.setSpeed(_speed.toFloat());
+                        const size_t playbackThreadCount = p.threadController.getThreadCount();
                         if (info.video.size() && _options.layer < info.video.size())
                         {
-                            const size_t dataByteCount = info.video[_options.layer].info.getDataByteCount();
+                            size_t dataByteCount = info.video[_options.layer].info.getDataByteCount();
+                            if (cacheCompression && p.compressRatio > 1.F)
+                            {
+                                // Fit more frames in the cache using the
+                                // measured compression ratio.
+                                dataByteCount = static_cast<size_t>(dataByteCount / p.compressRatio);
+                            }
                             _cache.setMax(dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
                             _cache.setSequenceSize(info.video[_options.layer].sequence.getSize());
                             _cache.setInOutPoints(inOutPoints);
@@ -186,7 +234,23 @@ namespace djv
                                     return _hasWork();
                                 }))
                             {
-                                queueCount = _getQueueCount(playback ? (threadCount / 2) : 1);
+                                // Count the times the video queue runs empty
+                                // during playback.
+                                if (playback &&
+                                    p.videoQueueCount > 0 &&
+                                    0 == _videoQueue.getCount() &&
+                                    !_videoQueue.isFinished() &&
+                                    Frame::invalid == p.seek &&
+                                    p.direction == _direction)
+                                {
+                                    p.threadController.addStarved();
+                                }
+                                // The video queue only grows during playback.
+                                _videoQueue.setMax(playback ?
+                                    p.threadController.getQueueSize() :
+                                    p.threadController.getQueueSizeMin());
+
+                                queueCount = _getQueueCount(playback ? playbackThreadCount : 1);
                                 if (p.direction != _direction)
                                 {
                                     p.direction = _direction;
@@ -216,14 +280,19 @@ namespace djv
                         size_t read = 0;
                         if (queueCount > 0)
                         {
-                            read = _readQueue(queueCount, cacheEnabled);
+                            read = _readQueue(queueCount, cacheEnabled, cacheCompression);
                         }
 
                         // Fill the cache.
                         if (cacheEnabled)
                         {
-                            _readCache(playback ? (threadCount / 2) : threadCount, inOutPoints);
+                            _readCache(playback ? playbackThreadCount : threadCount, inOutPoints, cacheCompression);
                         }
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            p.videoQueueCount = _videoQueue.getCount();
+                        }
+                        p.threadController.update(std::chrono::steady_clock::now());
 
                         // Update information.
                         const auto now = std::chrono::system_clock::now();
@@ -234,11 +303,23 @@ namespace djv
                             size_t cacheByteCount = _cache.getTotalByteCount();
                             auto cacheSequence = _cache.getSequence();
                             auto cachedFrames = _cache.getFrames();
+                            CacheCompressionStats compressionStats;
+                            compressionStats.frameCount = _cache.getCompressedCount();
+                            compressionStats.dataByteCount = _cache.getCompressedDataByteCount();
+                            compressionStats.compressedByteCount = _cache.getCompressedByteCount();
+                            compressionStats.compressTime = p.compressTime;
+                            compressionStats.decompressTime = p.decompressTime;
+                            if (compressionStats.frameCount > 0)
+                            {
+                                p.compressRatio = compressionStats.getRatio();
+                            }
                             {
                                 std::lock_guard<std::mutex> lock(_mutex);
                                 _cacheByteCount = cacheByteCount;
                                 _cacheSequence = cacheSequence;
                                 _cachedFrames = std::move(cachedFrames);
+                                _cacheCompressionStats = compressionStats;
+                                _threadControllerState = p.threadController.getState();
                             }
                         }
                     }
@@ -261,7 +342,27 @@ namespace djv
 
             std::future<Info> ISequenceRead::getInfo()
             {
-                return _p->infoPromise.get_future();
+                DJV_PRIVATE_PTR();
+                if (!_options.thread)
+                {
+                    std::promise<Info> promise;
+                    auto future = promise.get_future();
+                    try
+                    {
+                        promise.set_value(_readFirstInfo());
+                    }
+                    catch (const std::exception&)
+                    {
+                        promise.set_exception(std::current_exception());
+                    }
+                    return future;
+                }
+                return p.infoPromise.get_future();
+            }
+
+            std::shared_ptr<Image::Image> ISequenceRead::readImage()
+            {
+                return _readImage(_getFileName(0));
             }
 
             void ISequenceRead::seek(Frame::Number value, Direction direction)
@@ -286,6 +387,23 @@ namespace djv
                 }
             }
 
+            std::string ISequenceRead::_getFileName(Frame::Index value) const
+            {
+                Frame::Number frameNumber = Frame::invalid;
+                if (_sequence.getSize())
+                {
+                    frameNumber = _sequence.getFrame(value);
+                }
+                return _p->fileNameTemplate.get(frameNumber);
+            }
+
+            Info ISequenceRead::_readFirstInfo()
+            {
+                Info out = _readInfo(_getFileName(0));
+                out.fileName = _fileInfo.getFileName();
+                return out;
+            }
+
             bool ISequenceRead::_hasWork() const
             {
                 const bool queue = (_videoQueue.getCount() < _videoQueue.getMax()) && !_videoQueue.isFinished();
@@ -296,21 +414,34 @@ namespace djv
 
             size_t ISequenceRead::_getQueueCount(size_t threadCount) const
             {
-                const size_t queueMax = _videoQueue.getMax() - _videoQueue.getCount();
-                return std::min(queueMax, threadCount);
+                const size_t max = _videoQueue.getMax();
+                const size_t count = _videoQueue.getCount();
+                return count < max ? std::min(max - count, threadCount) : 0;
             }
 
-            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(Frame::Number i, std::string fileName)
+            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(Frame::Number i, std::string fileName, bool compress)
             {
+                // The file name is passed as an argument so it is moved into
+                // the task, C++11 lambdas can only capture it by copy.
                 return std::async(
                     std::launch::async,
-                    [this, i, fileName]
+                    [this, i, compress](const std::string& fileName)
                     {
                         Future out;
                         out.frame = i;
                         try
                         {
+                            auto start = std::chrono::steady_clock::now();
                             out.image = _readImage(fileName);
+                            auto end = std::chrono::steady_clock::now();
+                            out.decodeTime = std::chrono::duration<double>(end - start).count();
+                            if (compress && out.image)
+                            {
+                                start = end;
+                                out.compressed = Image::CompressedImage::create(out.image);
+                                end = std::chrono::steady_clock::now();
+                                out.compressTime = std::chrono::duration<double>(end - start).count();
+                            }
                         }
                         catch (const std::exception& e)
                         {
@@ -319,10 +450,77 @@ namespace djv
                             _logSystem->log("djv::AV::ISequenceRead", ss.str(), LogLevel::Error);
                         }
                         return out;
+                    },
+                    std::move(fileName));
+            }
+
+            std::future<ISequenceRead::Future> ISequenceRead::_getCompressFuture(const Future& value)
+            {
+                return std::async(
+                    std::launch::async,
+                    [value]
+                    {
+                        Future out = value;
+                        const auto start = std::chrono::steady_clock::now();
+                        out.compressed = Image::CompressedImage::create(out.image);
+                        out.compressTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        return out;
+                    });
+            }
+
+            std::future<ISequenceRead::Future> ISequenceRead::_getDecompressFuture(
+                Frame::Number i,
+                const std::shared_ptr<Image::CompressedImage>& compressed)
+            {
+                return std::async(
+                    std::launch::async,
+                    [this, i, compressed]
+                    {
+                        Future out;
+                        out.frame = i;
+                        out.decompressed = true;
+                        const auto start = std::chrono::steady_clock::now();
+                        out.image = compressed->decompress();
+                        out.decompressTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        if (!out.image)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _getFileName(i) << "' " << DJV_TEXT("error_cache_decompress") << ".";
+                            _logSystem->log("djv::AV::ISequenceRead", ss.str(), LogLevel::Error);
+                        }
+                        return out;
                     });
             }
 
-            size_t ISequenceRead::_readQueue(size_t count, bool cacheEnabled)
+            void ISequenceRead::_addFuture(const Future& value, bool cacheEnabled)
+            {
+                DJV_PRIVATE_PTR();
+                if (value.decompressed)
+                {
+                    p.decompressTime = smooth(p.decompressTime, value.decompressTime);
+                }
+                else
+                {
+                    p.threadController.addDecode(value.decodeTime);
+                    if (cacheEnabled)
+                    {
+                        if (value.compressed)
+                        {
+                            p.compressTime = smooth(p.compressTime, value.compressTime);
+                            _cache.add(value.frame, value.compressed);
+                        }
+                        else
+                        {
+#if defined(DJV_MMAP)
+                            value.image->detach();
+#endif // DJV_MMAP
+                            _cache.add(value.frame, value.image);
+                        }
+                    }
+                }
+            }
+
+            size_t ISequenceRead::_readQueue(size_t count, bool cacheEnabled, bool cacheCompression)
             {
                 DJV_PRIVATE_PTR();
 
@@ -333,10 +531,15 @@ namespace djv
                 for (size_t i = 0; i < count; ++i)
                 {
                     std::shared_ptr<Image::Image> cachedImage;
+                    std::shared_ptr<Image::CompressedImage> compressedImage;
                     if (cacheEnabled && _cache.get(p.frame, cachedImage))
                     {
                         images.push_back(std::make_pair(p.frame, cachedImage));
                     }
+                    else if (cacheEnabled && _cache.get(p.frame, compressedImage))
+                    {
+                        futures.push_back(_getDecompressFuture(p.frame, compressedImage));
+                    }
                     else
                     {
                         if (sequenceSize)
@@ -344,14 +547,12 @@ namespace djv
                             if (p.frame >= 0 && p.frame < sequenceSize)
                             {
                                 const Frame::Number frameNumber = _sequence.getFrame(p.frame);
-                                const std::string fileName = _fileInfo.getFileName(frameNumber);
-                                futures.push_back(_getFuture(p.frame, fileName));
+                                futures.push_back(_getFuture(p.frame, p.fileNameTemplate.format(frameNumber, p.fileName), false));
                             }
                         }
                         else
                         {
-                            const std::string fileName = _fileInfo.getFileName();
-                            futures.push_back(_getFuture(p.frame, fileName));
+                            futures.push_back(_getFuture(p.frame, p.fileNameTemplate.format(Frame::invalid, p.fileName), false));
                         }
                     }
 
@@ -379,21 +580,29 @@ namespace djv
                 }
 
                 // Get the results.
+                const auto waitStart = std::chrono::steady_clock::now();
                 for (auto& future : futures)
                 {
                     const auto result = future.get();
                     if (result.image)
                     {
-                        images.push_back(std::make_pair(result.frame, result.image));
-                        if (cacheEnabled)
+                        if (cacheEnabled && cacheCompression)
                         {
-#if defined(DJV_MMAP)
-                            result.image->detach();
-#endif // DJV_MMAP
-                            _cache.add(result.frame, result.image);
+                            // Compress the image for the cache in the
+                            // background so it does not delay the queue.
+                            p.cacheFutures.push_back(_getCompressFuture(result));
+                        }
+                        else
+                        {
+                            _addFuture(result, cacheEnabled);
                         }
+                        images.push_back(std::make_pair(result.frame, result.image));
                     }
                 }
+                if (futures.size())
+                {
+                    p.threadController.addWait(std::chrono::duration<double>(std::chrono::steady_clock::now() - waitStart).count());
+                }
 
                 // Add the frames to the queue.
                 {
@@ -417,7 +626,7 @@ namespace djv
                 return futures.size();
             }
 
-            void ISequenceRead::_readCache(size_t count, const AV::IO::InOutPoints& inOutPoints)
+            void ISequenceRead::_readCache(size_t count, const AV::IO::InOutPoints& inOutPoints, bool cacheCompression)
             {
                 DJV_PRIVATE_PTR();
 
@@ -432,8 +641,8 @@ namespace djv
                 }
                 if (count > 0 && frame != Frame::invalid)
                 {
-                    const size_t sequenceSize = _sequence.getSize();
                     const auto range = inOutPoints.getRange(_sequence.getSize());
+                    const size_t rangeSize = static_cast<size_t>(range.max - range.min + 1);
                     _cache.setDirection(p.direction);
                     _cache.setCurrentFrame(frame);
                     const size_t readBehind = _cache.getReadBehind();
@@ -449,13 +658,13 @@ namespace djv
                                 frame = range.max;
                             }
                         }
-                        const size_t max = std::min(_cache.getMax(), sequenceSize);
-                        for (size_t i = 0; i < max && p.cacheFutures.size() < count; ++i)
+                        const size_t max = std::min(_cache.getMax(), rangeSize);
+                        for (size_t i = 0; i < max && p.cacheFutures.size() + p.cacheIndices.size() < count; ++i)
                         {
                             if (!_cache.contains(frame))
                             {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.cacheIndices.push_back(frame);
+                                p.cacheFrames.push_back(_sequence.getFrame(frame));
                             }
                             ++frame;
                             if (frame > range.max)
@@ -475,13 +684,13 @@ namespace djv
                                 frame = range.min;
                             }
                         }
-                        const size_t max = std::min(_cache.getMax(), sequenceSize);
-                        for (Frame::Number i = 0; i < max && p.cacheFutures.size() < count; ++i)
+                        const size_t max = std::min(_cache.getMax(), rangeSize);
+                        for (size_t i = 0; i < max && p.cacheFutures.size() + p.cacheIndices.size() < count; ++i)
                         {
                             if (!_cache.contains(frame))
                             {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.cacheIndices.push_back(frame);
+                                p.cacheFrames.push_back(_sequence.getFrame(frame));
                             }
                             --frame;
                             if (frame < range.min)
@@ -493,6 +702,15 @@ namespace djv
                     }
                     default: break;
                     }
+
+                    // Only format the file names of the frames that are read.
+                    p.fileNameTemplate.get(p.cacheFrames, p.fileNames);
+                    for (size_t i = 0; i < p.cacheIndices.size(); ++i)
+                    {
+                        p.cacheFutures.push_back(_getFuture(p.cacheIndices[i], p.fileNames[i], cacheCompression));
+                    }
+                    p.cacheIndices.clear();
+                    p.cacheFrames.clear();
                 }
 
                 // Get the results.
@@ -505,10 +723,7 @@ namespace djv
                         const auto result = i->get();
                         if (result.image)
                         {
-#if defined(DJV_MMAP)
-                            result.image->detach();
-#endif // DJV_MMAP
-                            _cache.add(result.frame, result.image);
+                            _addFuture(result, true);
                         }
                         i = p.cacheFutures.erase(i);
                     }
@@ -522,9 +737,11 @@ namespace djv
             struct ISequenceWrite::Private
             {
                 FileSystem::FileInfo fileInfo;
+                FileSystem::FileNameTemplate fileNameTemplate;
                 Frame::Number frameNumber = Frame::invalid;
                 GLFWwindow * glfwWindow = nullptr;
                 std::shared_ptr<Image::Convert> convert;
+                std::shared_ptr<OCIO::Processor> ocioProcessor;
                 std::thread thread;
                 std::atomic<bool> running;
             };
@@ -550,12 +767,13 @@ namespace djv
                 if (p.fileInfo.isSequenceValid())
                 {
                     auto sequence = p.fileInfo.getSequence();
-                    if (sequence.ranges.size())
+                    if (sequence.getRanges().size())
                     {
                         sequence.sort();
-                        p.frameNumber = sequence.ranges[0].min;
+                        p.frameNumber = sequence.getRanges()[0].min;
                     }
                 }
+                p.fileNameTemplate = p.fileInfo.getFileNameTemplate();
 
 #if defined(DJV_OPENGL_ES2)
                 glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
@@ -600,6 +818,13 @@ namespace djv
                         }
 
                         p.convert = Image::Convert::create(_resourceSystem);
+                        if (_options.colorSpaceConvert.isValid())
+                        {
+                            p.ocioProcessor = OCIO::Processor::create(
+                                _options.colorSpaceConvert,
+                                _options.lut3DEdgeLen);
+                            p.ocioProcessor->setThreadCount(std::max(p.ocioProcessor->getThreadCount() / _threadCount, size_t(1)));
+                        }
 
                         const auto timeout = Time::getValue(Time::TimerValue::VeryFast);
                         while (p.running)
@@ -631,7 +856,7 @@ namespace djv
                                 std::vector<std::future<Future> > futures;
                                 for (size_t i = 0; i < images.size(); ++i)
                                 {
-                                    const auto fileName = p.fileInfo.getFileName(p.frameNumber);
+                                    const auto fileName = p.fileNameTemplate.get(p.frameNumber);
                                     /*{
                                         std::stringstream ss;
                                         ss << "Writing: " << fileName;
@@ -658,14 +883,28 @@ namespace djv
                                         p.convert->process(*image, info, *tmp);
                                         image = tmp;
                                     }
+                                    else if (p.ocioProcessor)
+                                    {
+                                        // Copy the image so the color space conversion
+                                        // doesn't modify the original.
+                                        auto tmp = Image::Image::create(image->getInfo());
+                                        tmp->setTags(image->getTags());
+                                        memcpy(tmp->getData(), image->getData(), image->getDataByteCount());
+                                        image = tmp;
+                                    }
+                                    auto ocioProcessor = p.ocioProcessor;
                                     futures.push_back(std::async(
                                         std::launch::async,
-                                        [this, fileName, image]
+                                        [this, fileName, image, ocioProcessor]
                                         {
                                             Future out;
                                             out.fileName = fileName;
                                             try
                                             {
+                                                if (ocioProcessor)
+                                                {
+                                                    ocioProcessor->apply(*image);
+                                                }
                                                 _write(fileName, image);
                                             }
                                             catch (const std::exception& e)
@@ -696,6 +935,7 @@ namespace djv
                         }
 
                         p.convert.reset();
+                        p.ocioProcessor.reset();
                     }
                     catch (const std::exception & e)
                     {
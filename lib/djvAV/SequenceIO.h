@@ -57,6 +57,7 @@ namespace djv
 
                 bool isRunning() const override;
                 std::future<Info> getInfo() override;
+                std::shared_ptr<Image::Image> readImage() override;
                 void seek(int64_t, Direction) override;
                 bool hasCache() const override { return true; }
 
@@ -69,12 +70,17 @@ namespace djv
                 Core::Frame::Sequence _sequence;
 
             private:
+                std::string _getFileName(Core::Frame::Index) const;
+                Info _readFirstInfo();
                 bool _hasWork() const;
                 size_t _getQueueCount(size_t threadCount) const;
                 struct Future;
-                std::future<Future> _getFuture(Core::Frame::Number, std::string fileName);
-                size_t _readQueue(size_t count, bool cacheEnabled);
-                void _readCache(size_t count, const AV::IO::InOutPoints&);
+                std::future<Future> _getFuture(Core::Frame::Number, std::string fileName, bool compress);
+                std::future<Future> _getCompressFuture(const Future&);
+                std::future<Future> _getDecompressFuture(Core::Frame::Number, const std::shared_ptr<Image::CompressedImage>&);
+                void _addFuture(const Future&, bool cacheEnabled);
+                size_t _readQueue(size_t count, bool cacheEnabled, bool cacheCompression);
+                void _readCache(size_t count, const AV::IO::InOutPoints&, bool cacheCompression);
 
                 DJV_PRIVATE();
             };
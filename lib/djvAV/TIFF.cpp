@@ -113,6 +113,11 @@ namespace djv
                     return Read::create(fileInfo, options, _resourceSystem, _logSystem);
                 }
 
+                std::shared_ptr<Image::TiledImage> Plugin::readTiled(const FileSystem::FileInfo& fileInfo, const ReadOptions&) const
+                {
+                    return TIFF::readTiled(fileInfo.getFileName());
+                }
+
                 std::shared_ptr<IWrite> Plugin::write(const FileSystem::FileInfo& fileInfo, const Info & info, const WriteOptions& options) const
                 {
                     return Write::create(fileInfo, info, options, _p->options, _resourceSystem, _logSystem);
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <djvAV/SequenceIO.h>
+#include <djvAV/TiledImage.h>
 
 #include <tiffio.h>
 
@@ -75,6 +76,13 @@ namespace djv
                     uint16_t * green,
                     uint16_t * blue);
 
+                //! Read a file as a tiled image. Tiled files are read with the
+                //! file tiles, and strip files are read a scanline at a time.
+                //!
+                //! Throws:
+                //! - Core::FileSystem::Error
+                std::shared_ptr<Image::TiledImage> readTiled(const std::string& fileName);
+
                 //! This class provides the TIFF file reader.
                 class Read : public ISequenceRead
                 {
@@ -144,6 +152,7 @@ namespace djv
                     void setOptions(const picojson::value &) override;
 
                     std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
+                    std::shared_ptr<Image::TiledImage> readTiled(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
                     std::shared_ptr<IWrite> write(const Core::FileSystem::FileInfo&, const Info &, const WriteOptions&) const override;
 
                 private:
@@ -32,6 +32,9 @@
 #include <djvCore/FileIO.h>
 #include <djvCore/FileSystem.h>
 
+#include <limits>
+#include <mutex>
+
 using namespace djv::Core;
 
 namespace djv
@@ -42,6 +45,248 @@ namespace djv
         {
             namespace TIFF
             {
+                namespace
+                {
+                    Image::Type getImageType(uint16 photometric, uint16 samples, uint16 sampleDepth, uint16 sampleFormat)
+                    {
+                        Image::Type out = Image::Type::None;
+                        switch (photometric)
+                        {
+                        case PHOTOMETRIC_PALETTE:
+                            out = Image::Type::RGB_U8;
+                            break;
+                        case PHOTOMETRIC_MINISWHITE:
+                        case PHOTOMETRIC_MINISBLACK:
+                        case PHOTOMETRIC_RGB:
+                            if (32 == sampleDepth && sampleFormat != SAMPLEFORMAT_IEEEFP)
+                                break;
+                            if (SAMPLEFORMAT_IEEEFP == sampleFormat)
+                            {
+                                out = Image::getFloatType(samples, sampleDepth);
+                            }
+                            else
+                            {
+                                out = Image::getIntType(samples, sampleDepth);
+                            }
+                            break;
+                        }
+                        return out;
+                    }
+
+                    Image::Layout getLayout(uint16 orient)
+                    {
+                        Image::Layout out;
+                        switch (orient)
+                        {
+                        case ORIENTATION_TOPLEFT:  break;
+                        case ORIENTATION_TOPRIGHT: out.mirror.x = true; break;
+                        case ORIENTATION_BOTRIGHT: out.mirror.x = out.mirror.y = true; break;
+                        case ORIENTATION_BOTLEFT:  out.mirror.y = true; break;
+                        }
+                        return out;
+                    }
+
+                    void readTags(::TIFF* f, AV::Tags& tags)
+                    {
+                        char * tag = 0;
+                        if (TIFFGetField(f, TIFFTAG_ARTIST, &tag))
+                        {
+                            if (tag)
+                            {
+                                tags.setTag("Creator", tag);
+                            }
+                        }
+                        if (TIFFGetField(f, TIFFTAG_IMAGEDESCRIPTION, &tag))
+                        {
+                            if (tag)
+                            {
+                                tags.setTag("Description", tag);
+                            }
+                        }
+                        if (TIFFGetField(f, TIFFTAG_COPYRIGHT, &tag))
+                        {
+                            if (tag)
+                            {
+                                tags.setTag("Copyright", tag);
+                            }
+                        }
+                        if (TIFFGetField(f, TIFFTAG_DATETIME, &tag))
+                        {
+                            if (tag)
+                            {
+                                tags.setTag("Time", tag);
+                            }
+                        }
+                    }
+
+                    //! This struct provides a file that tiles are read from.
+                    //! The file is kept open for the lifetime of the tiled
+                    //! image.
+                    struct TiledFile
+                    {
+                        ~TiledFile()
+                        {
+                            if (f)
+                            {
+                                TIFFClose(f);
+                                f = nullptr;
+                            }
+                        }
+
+                        std::mutex mutex;
+                        ::TIFF *   f              = nullptr;
+                        bool       tiled          = false;
+                        uint32     fileTileWidth  = 0;
+                        uint32     fileTileHeight = 0;
+                        bool       palette        = false;
+                        uint16 *   colormap[3]    = { nullptr, nullptr, nullptr };
+                    };
+
+                    std::shared_ptr<Image::Image> readTile(
+                        TiledFile& f,
+                        const Image::TiledInfo& info,
+                        uint32_t column,
+                        uint32_t row)
+                    {
+                        auto out = Image::Image::create(info.getTileInfo(column, row));
+                        out->setPluginName(pluginName);
+                        out->zero();
+                        const auto& tileInfo = out->getInfo();
+                        const size_t pixelByteCount = Image::getByteCount(tileInfo.type);
+                        const uint32_t x0 = column * info.tileSize.w;
+                        const uint32_t y0 = row * info.tileSize.h;
+                        const uint32_t x1 = x0 + tileInfo.size.w;
+                        const uint32_t y1 = y0 + tileInfo.size.h;
+
+                        std::lock_guard<std::mutex> lock(f.mutex);
+                        if (f.tiled)
+                        {
+                            // Read the file tiles that cover the tile.
+                            std::vector<uint8_t> buf(TIFFTileSize(f.f));
+                            for (uint32_t ty = y0 / f.fileTileHeight * f.fileTileHeight; ty < y1; ty += f.fileTileHeight)
+                            {
+                                for (uint32_t tx = x0 / f.fileTileWidth * f.fileTileWidth; tx < x1; tx += f.fileTileWidth)
+                                {
+                                    if (TIFFReadTile(f.f, buf.data(), tx, ty, 0, 0) == -1)
+                                    {
+                                        throw FileSystem::Error(DJV_TEXT("error_read_tile"));
+                                    }
+                                    const uint32_t ix0 = std::max(tx, x0);
+                                    const uint32_t ix1 = std::min(tx + f.fileTileWidth, x1);
+                                    const uint32_t iy0 = std::max(ty, y0);
+                                    const uint32_t iy1 = std::min(ty + f.fileTileHeight, y1);
+                                    for (uint32_t y = iy0; y < iy1; ++y)
+                                    {
+                                        memcpy(
+                                            out->getData(ix0 - x0, y - y0),
+                                            buf.data() + ((y - ty) * f.fileTileWidth + (ix0 - tx)) * pixelByteCount,
+                                            (ix1 - ix0) * pixelByteCount);
+                                    }
+                                }
+                            }
+                        }
+                        else
+                        {
+                            // Read the scanlines that cover the tile.
+                            std::vector<uint8_t> buf(std::max(
+                                static_cast<size_t>(TIFFScanlineSize(f.f)),
+                                info.width * pixelByteCount));
+                            for (uint32_t y = y0; y < y1; ++y)
+                            {
+                                if (TIFFReadScanline(f.f, (tdata_t *)buf.data(), y) == -1)
+                                {
+                                    throw FileSystem::Error(DJV_TEXT("error_read_scanline"));
+                                }
+                                if (f.palette)
+                                {
+                                    TIFF::paletteLoad(
+                                        buf.data(),
+                                        info.width,
+                                        static_cast<int>(Image::getChannelCount(tileInfo.type)),
+                                        f.colormap[0], f.colormap[1], f.colormap[2]);
+                                }
+                                memcpy(
+                                    out->getData(0, y - y0),
+                                    buf.data() + x0 * pixelByteCount,
+                                    tileInfo.size.w * pixelByteCount);
+                            }
+                        }
+                        return out;
+                    }
+
+                } // namespace
+
+                std::shared_ptr<Image::TiledImage> readTiled(const std::string& fileName)
+                {
+                    auto f = std::make_shared<TiledFile>();
+                    f->f = TIFFOpen(fileName.data(), "r");
+                    if (!f->f)
+                    {
+                        throw FileSystem::Error(DJV_TEXT("error_file_open"));
+                    }
+
+                    uint32   width        = 0;
+                    uint32   height       = 0;
+                    uint16   photometric  = 0;
+                    uint16   samples      = 0;
+                    uint16   sampleDepth  = 0;
+                    uint16   sampleFormat = 0;
+                    uint16   orient       = 0;
+                    uint16   planar       = 0;
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_IMAGEWIDTH, &width);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_IMAGELENGTH, &height);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_PHOTOMETRIC, &photometric);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_SAMPLESPERPIXEL, &samples);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_BITSPERSAMPLE, &sampleDepth);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_SAMPLEFORMAT, &sampleFormat);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_ORIENTATION, &orient);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_PLANARCONFIG, &planar);
+                    TIFFGetFieldDefaulted(f->f, TIFFTAG_COLORMAP, &f->colormap[0], &f->colormap[1], &f->colormap[2]);
+                    f->palette = PHOTOMETRIC_PALETTE == photometric;
+                    f->tiled = TIFFIsTiled(f->f) != 0;
+
+                    Image::TiledInfo info;
+                    info.width = width;
+                    info.height = height;
+                    info.type = getImageType(photometric, samples, sampleDepth, sampleFormat);
+                    info.layout = getLayout(orient);
+                    if (Image::Type::None == info.type ||
+                        (f->tiled && (f->palette || planar != PLANARCONFIG_CONTIG)))
+                    {
+                        throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
+                    }
+                    if (f->tiled)
+                    {
+                        TIFFGetField(f->f, TIFFTAG_TILEWIDTH, &f->fileTileWidth);
+                        TIFFGetField(f->f, TIFFTAG_TILELENGTH, &f->fileTileHeight);
+                        if (!f->fileTileWidth || !f->fileTileHeight)
+                        {
+                            throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
+                        }
+
+                        // Use a multiple of the file tile size so that each
+                        // file tile is only read once.
+                        info.tileSize.w = static_cast<uint16_t>(std::min(
+                            std::max(Image::tileSizeDefault / f->fileTileWidth, static_cast<uint32>(1)) * f->fileTileWidth,
+                            static_cast<uint32>(std::numeric_limits<uint16_t>::max())));
+                        info.tileSize.h = static_cast<uint16_t>(std::min(
+                            std::max(Image::tileSizeDefault / f->fileTileHeight, static_cast<uint32>(1)) * f->fileTileHeight,
+                            static_cast<uint32>(std::numeric_limits<uint16_t>::max())));
+                    }
+
+                    auto out = Image::TiledImage::create(
+                        info,
+                        [f, info](uint32_t column, uint32_t row)
+                        {
+                            return readTile(*f, info, column, row);
+                        });
+                    out->setPluginName(pluginName);
+                    AV::Tags tags;
+                    readTags(f->f, tags);
+                    out->setTags(tags);
+                    return out;
+                }
+
                 struct Read::File
                 {
                     ~File()
@@ -144,74 +389,18 @@ namespace djv
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_PLANARCONFIG, &channels);
                     TIFFGetFieldDefaulted(f.f, TIFFTAG_COLORMAP, &f.colormap[0], &f.colormap[1], &f.colormap[2]);
 
-                    Image::Type imageType = Image::Type::None;
-                    switch (photometric)
-                    {
-                    case PHOTOMETRIC_PALETTE:
-                        imageType = Image::Type::RGB_U8;
-                        break;
-                    case PHOTOMETRIC_MINISWHITE:
-                    case PHOTOMETRIC_MINISBLACK:
-                    case PHOTOMETRIC_RGB:
-                        if (32 == sampleDepth && sampleFormat != SAMPLEFORMAT_IEEEFP)
-                            break;
-                        if (SAMPLEFORMAT_IEEEFP == sampleFormat)
-                        {
-                            imageType = Image::getFloatType(samples, sampleDepth);
-                        }
-                        else
-                        {
-                            imageType = Image::getIntType(samples, sampleDepth);
-                        }
-                        break;
-                    }
+                    const Image::Type imageType = getImageType(photometric, samples, sampleDepth, sampleFormat);
                     if (Image::Type::None == imageType)
                     {
                         throw FileSystem::Error(DJV_TEXT("error_unsupported_image_type"));
                     }
-
-                    Image::Layout layout;
-                    switch (orient)
-                    {
-                    case ORIENTATION_TOPLEFT:  break;
-                    case ORIENTATION_TOPRIGHT: layout.mirror.x = true; break;
-                    case ORIENTATION_BOTRIGHT: layout.mirror.x = layout.mirror.y = true; break;
-                    case ORIENTATION_BOTLEFT:  layout.mirror.y = true; break;
-                    }
+                    const Image::Layout layout = getLayout(orient);
 
                     f.compression = compression != COMPRESSION_NONE;
                     f.palette = PHOTOMETRIC_PALETTE == photometric;
 
                     AV::Tags tags;
-                    char * tag = 0;
-                    if (TIFFGetField(f.f, TIFFTAG_ARTIST, &tag))
-                    {
-                        if (tag)
-                        {
-                            tags.setTag("Creator", tag);
-                        }
-                    }
-                    if (TIFFGetField(f.f, TIFFTAG_IMAGEDESCRIPTION, &tag))
-                    {
-                        if (tag)
-                        {
-                            tags.setTag("Description", tag);
-                        }
-                    }
-                    if (TIFFGetField(f.f, TIFFTAG_COPYRIGHT, &tag))
-                    {
-                        if (tag)
-                        {
-                            tags.setTag("Copyright", tag);
-                        }
-                    }
-                    if (TIFFGetField(f.f, TIFFTAG_DATETIME, &tag))
-                    {
-                        if (tag)
-                        {
-                            tags.setTag("Time", tag);
-                        }
-                    }
+                    readTags(f.f, tags);
 
                     auto imageInfo = Image::Info(width, height, imageType, layout);
                     auto info = Info(fileName, VideoInfo(imageInfo, _speed, _sequence));
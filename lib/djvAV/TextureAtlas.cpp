@@ -31,7 +31,8 @@
 
 #include <djvAV/OpenGLTexture.h>
 
-#include <djvCore/BBox.h>
+#include <algorithm>
+#include <map>
 
 using namespace djv::Core;
 
@@ -43,104 +44,55 @@ namespace djv
         {
             namespace
             {
-                uint64_t _timestamp = 0;
+                //! Shelf heights are rounded up to a multiple of this value.
+                const uint16_t shelfHeightRound = 4;
 
-            } // namespace
-
-            //! This class provides the nodes used for box packing.
-            //!
-            //! References:
-            //! - http://blackpawn.com/texts/lightmaps/
-            class TextureAtlas::BoxPackingNode : public std::enable_shared_from_this< TextureAtlas::BoxPackingNode>
-            {
-            private:
-                explicit BoxPackingNode(int border);
-
-            public:
-                static std::shared_ptr<BoxPackingNode> create(int border);
-
-                UID uid = 0;
-                uint64_t timestamp = 0;
-
-                BBox2i bbox;
-                uint8_t border = 0;
-                uint8_t textureIndex = 0;
-                std::shared_ptr<BoxPackingNode> children[2];
-
-                bool isBranch() const { return children[0].get(); }
-                bool isOccupied() const { return uid != 0; }
+                //! Items can be placed in shelves up to this many times their height.
+                const float shelfHeightTolerance = 1.5F;
 
-                std::shared_ptr<BoxPackingNode> insert(const std::shared_ptr<Image::Data> &);
-            };
-
-            TextureAtlas::BoxPackingNode::BoxPackingNode(int border) :
-                timestamp(++_timestamp),
-                border(border)
-            {}
-
-            std::shared_ptr<TextureAtlas::BoxPackingNode> TextureAtlas::BoxPackingNode::create(int border)
-            {
-                auto out = std::shared_ptr<BoxPackingNode>(new BoxPackingNode(border));
-                return out;
-            }
+                //! Compact a page when less than this percentage of the shelf
+                //! area is used by items.
+                const float compactThreshold = .75F;
 
-            std::shared_ptr<TextureAtlas::BoxPackingNode> TextureAtlas::BoxPackingNode::insert(const std::shared_ptr<Image::Data> & data)
-            {
-                if (isBranch())
+                uint16_t getShelfHeight(uint16_t value)
                 {
-                    if (auto node = children[0]->insert(data))
-                    {
-                        return node;
-                    }
-                    return children[1]->insert(data);
+                    return (value + shelfHeightRound - 1) / shelfHeightRound * shelfHeightRound;
                 }
-                else if (isOccupied())
+
+                struct Item
                 {
-                    return nullptr;
-                }
-                else
+                    uint8_t  page      = 0;
+                    size_t   shelf     = 0;
+                    uint16_t x         = 0;
+                    uint16_t y         = 0;
+                    uint16_t w         = 0;
+                    uint16_t h         = 0;
+                    uint64_t timestamp = 0;
+                };
+
+                struct Shelf
                 {
-                    const glm::ivec2 & dataSize = glm::ivec2(data->getWidth(), data->getHeight()) + border * 2;
-                    const glm::ivec2 & bboxSize = bbox.getSize();
-                    if (dataSize.x > bboxSize.x || dataSize.y > bboxSize.y)
-                    {
-                        return nullptr;
-                    }
-                    if (dataSize == bboxSize)
-                    {
-                        return shared_from_this();
-                    }
-                    children[0] = create(border);
-                    children[1] = create(border);
-                    const int dw = bboxSize.x - dataSize.x;
-                    const int dh = bboxSize.y - dataSize.y;
-                    if (dw > dh)
-                    {
-                        children[0]->bbox.min.x = bbox.min.x;
-                        children[0]->bbox.min.y = bbox.min.y;
-                        children[0]->bbox.max.x = bbox.min.x + dataSize.x - 1;
-                        children[0]->bbox.max.y = bbox.max.y;
-                        children[1]->bbox.min.x = bbox.min.x + dataSize.x;
-                        children[1]->bbox.min.y = bbox.min.y;
-                        children[1]->bbox.max.x = bbox.max.x;
-                        children[1]->bbox.max.y = bbox.max.y;
-                    }
-                    else
-                    {
-                        children[0]->bbox.min.x = bbox.min.x;
-                        children[0]->bbox.min.y = bbox.min.y;
-                        children[0]->bbox.max.x = bbox.max.x;
-                        children[0]->bbox.max.y = bbox.min.y + dataSize.y - 1;
-                        children[1]->bbox.min.x = bbox.min.x;
-                        children[1]->bbox.min.y = bbox.min.y + dataSize.y;
-                        children[1]->bbox.max.x = bbox.max.x;
-                        children[1]->bbox.max.y = bbox.max.y;
-                    }
-                    children[0]->textureIndex = textureIndex;
-                    children[1]->textureIndex = textureIndex;
-                    return children[0]->insert(data);
-                }
-            }
+                    uint16_t         y         = 0;
+                    uint16_t         h         = 0;
+                    uint16_t         x         = 0;
+                    bool             open      = true;
+                    std::vector<UID> items;
+                    uint64_t         timestamp = 0;
+                };
+
+                struct Page
+                {
+                    std::vector<Shelf> shelves;
+                    uint16_t y = 0;
+
+                    //! Shelves with free space ordered by height.
+                    std::multimap<uint16_t, size_t> openShelves;
+
+                    size_t itemArea = 0;
+                    bool   evicted  = false;
+                };
+
+            } // namespace
 
             struct TextureAtlas::Private
             {
@@ -149,35 +101,61 @@ namespace djv
                 Image::Type textureType = Image::Type::None;
                 uint8_t border = 0;
                 std::vector<std::shared_ptr<OpenGL::Texture> > textures;
-                std::vector<std::shared_ptr<BoxPackingNode> > boxPackingNodes;
-                std::map<UID, std::shared_ptr<BoxPackingNode> > cache;
+                std::shared_ptr<OpenGL::Texture> compactTexture;
+                GLuint compactFramebuffer = 0;
+                std::vector<Page> pages;
+                std::map<UID, Item> items;
+                UID uid = 0;
+                uint64_t timestamp = 0;
+                size_t generation = 1;
+                size_t evictionCount = 0;
+                size_t compactionCount = 0;
+
+                bool allocate(uint8_t page, UID, Item&);
+                bool allocate(uint8_t page, size_t shelf, UID, Item&);
+                void openShelf(Page&, size_t shelf);
+                void closeShelf(Page&, size_t shelf);
+                void evictShelf(uint8_t page, size_t shelf);
+                void evictPage(uint8_t page);
+                void clearPage(Page&);
+                void toTextureAtlasItem(const Item&, TextureAtlasItem&) const;
             };
 
-            TextureAtlas::TextureAtlas(uint8_t textureCount, uint16_t textureSize, Image::Type textureType, GLenum filter, uint8_t border) :
+            TextureAtlas::TextureAtlas(
+                uint8_t textureCount,
+                uint16_t textureSize,
+                Image::Type textureType,
+                GLenum filter,
+                uint8_t border,
+                bool textures) :
                 _p(new Private)
             {
                 DJV_PRIVATE_PTR();
                 p.textureCount = textureCount;
                 p.textureSize = textureSize;
                 p.textureType = textureType;
+                p.border = border;
 
-                for (uint8_t i = 0; i < p.textureCount; ++i)
+                if (textures)
                 {
-                    auto texture = OpenGL::Texture::create(Image::Info(textureSize, textureSize, textureType), filter, filter);
-                    p.textures.push_back(std::move(texture));
-
-                    auto node = BoxPackingNode::create(border);
-                    node->bbox.min.x = 0;
-                    node->bbox.min.y = 0;
-                    node->bbox.max.x = textureSize - 1;
-                    node->bbox.max.y = textureSize - 1;
-                    node->textureIndex = i;
-                    p.boxPackingNodes.push_back(node);
+                    for (uint8_t i = 0; i < p.textureCount; ++i)
+                    {
+                        auto texture = OpenGL::Texture::create(Image::Info(textureSize, textureSize, textureType), filter, filter);
+                        p.textures.push_back(std::move(texture));
+                    }
                 }
+                p.pages.resize(p.textureCount);
             }
 
             TextureAtlas::~TextureAtlas()
-            {}
+            {
+                DJV_PRIVATE_PTR();
+                if (p.compactFramebuffer)
+                {
+                    glDeleteFramebuffers(1, &p.compactFramebuffer);
+                    p.compactFramebuffer = 0;
+                }
+            }
 
             uint8_t TextureAtlas::getTextureCount() const
             {
@@ -208,10 +186,12 @@ namespace djv
             bool TextureAtlas::getItem(UID uid, TextureAtlasItem & out)
             {
                 DJV_PRIVATE_PTR();
-                const auto & i = p.cache.find(uid);
-                if (i != p.cache.end())
+                const auto i = p.items.find(uid);
+                if (i != p.items.end())
                 {
-                    _toTextureAtlasItem(i->second, out);
+                    i->second.timestamp = ++p.timestamp;
+                    p.pages[i->second.page].shelves[i->second.shelf].timestamp = i->second.timestamp;
+                    p.toTextureAtlasItem(i->second, out);
                     return true;
                 }
                 return false;
@@ -220,151 +200,403 @@ namespace djv
             UID TextureAtlas::addItem(const std::shared_ptr<Image::Data> & data, TextureAtlasItem & out)
             {
                 DJV_PRIVATE_PTR();
+                const size_t w = static_cast<size_t>(data->getWidth()) + p.border * 2;
+                const size_t h = static_cast<size_t>(data->getHeight()) + p.border * 2;
+                if (!p.textureCount || w > p.textureSize || h > p.textureSize)
+                    return 0;
+
+                const UID uid = ++p.uid;
+                Item item;
+                item.w = static_cast<uint16_t>(w);
+                item.h = static_cast<uint16_t>(h);
+                bool allocated = false;
+                for (uint8_t i = 0; i < p.textureCount && !allocated; ++i)
+                {
+                    allocated = p.allocate(i, uid, item);
+                }
 
-                static UID _uid = 0;
-
-                for (uint8_t i = 0; i < p.textureCount; ++i)
+                if (!allocated)
                 {
-                    if (auto node = p.boxPackingNodes[i]->insert(data))
+                    // The atlas is full, evict the least recently used shelf
+                    // that can hold the item. Shelves of about the same height
+                    // are preferred, followed by taller shelves. The item is
+                    // placed directly in the evicted shelf since a taller
+                    // shelf is not found by the normal allocation.
+                    const uint16_t shelfHeight = getShelfHeight(item.h);
+                    const float shelfHeightMax = shelfHeight * shelfHeightTolerance;
+                    uint8_t page = 0;
+                    size_t shelf = 0;
+                    uint64_t timestamp = 0;
+                    bool found = false;
+                    for (size_t pass = 0; pass < 2 && !found; ++pass)
+                    {
+                        for (uint8_t i = 0; i < p.textureCount; ++i)
+                        {
+                            const auto& shelves = p.pages[i].shelves;
+                            for (size_t j = 0; j < shelves.size(); ++j)
+                            {
+                                if (shelves[j].h >= shelfHeight &&
+                                    (pass > 0 || shelves[j].h <= shelfHeightMax) &&
+                                    (!found || shelves[j].timestamp < timestamp))
+                                {
+                                    page = i;
+                                    shelf = j;
+                                    timestamp = shelves[j].timestamp;
+                                    found = true;
+                                }
+                            }
+                        }
+                    }
+                    if (found)
                     {
-                        // The data has been added to the atlas.
-                        node->uid = ++_uid;
-                        p.textures[node->textureIndex]->copy(*data, node->bbox.min.x + p.border, node->bbox.min.y + p.border);
-                        p.cache[node->uid] = node;
-                        _toTextureAtlasItem(node, out);
-                        return node->uid;
+                        p.evictShelf(page, shelf);
+                        allocated = p.allocate(page, shelf, uid, item);
+                    }
+                    else
+                    {
+                        // There are no shelves of the right height, evict the
+                        // least recently used page.
+                        for (uint8_t i = 0; i < p.textureCount; ++i)
+                        {
+                            uint64_t pageTimestamp = 0;
+                            for (const auto& j : p.pages[i].shelves)
+                            {
+                                pageTimestamp = std::max(pageTimestamp, j.timestamp);
+                            }
+                            if (0 == i || pageTimestamp < timestamp)
+                            {
+                                page = i;
+                                timestamp = pageTimestamp;
+                            }
+                        }
+                        p.evictPage(page);
+                        allocated = p.allocate(page, uid, item);
                     }
                 }
 
-                // The atlas is full, over-write older data.
-                std::vector<std::shared_ptr<BoxPackingNode> > nodes;
-                for (uint8_t i = 0; i < p.textureCount; ++i)
+                if (allocated)
                 {
-                    _getAllNodes(p.boxPackingNodes[i], nodes);
+                    if (item.page < p.textures.size())
+                    {
+                        p.textures[item.page]->copy(
+                            *data,
+                            static_cast<uint16_t>(item.x + p.border),
+                            static_cast<uint16_t>(item.y + p.border));
+                    }
+                    p.toTextureAtlasItem(item, out);
+                    p.items[uid] = item;
+                    return uid;
                 }
-                std::sort(nodes.begin(), nodes.end(),
-                    [](const std::shared_ptr<BoxPackingNode>& a, const std::shared_ptr<BoxPackingNode>& b)
-                {
-                    return a->timestamp < b->timestamp;
-                });
-                const glm::ivec2 dataSize = glm::ivec2(data->getWidth(), data->getHeight()) + p.border * 2;
-                for (auto node : nodes)
+                return 0;
+            }
+
+            void TextureAtlas::compact()
+            {
+                DJV_PRIVATE_PTR();
+                for (uint8_t i = 0; i < p.textureCount; ++i)
                 {
-                    const glm::ivec2 nodeSize = node->bbox.getSize();
-                    if (dataSize.x <= nodeSize.x && dataSize.y <= nodeSize.y)
+                    auto& page = p.pages[i];
+                    if (!page.evicted)
+                        continue;
+                    page.evicted = false;
+
+                    size_t shelfArea = 0;
+                    for (const auto& j : page.shelves)
                     {
-                        auto old = node;
-                        _removeFromAtlas(old);
-                        if (old->isBranch())
+                        shelfArea += static_cast<size_t>(p.textureSize) * j.h;
+                    }
+                    if (shelfArea > 0 && page.itemArea / static_cast<float>(shelfArea) >= compactThreshold)
+                        continue;
+
+                    // Re-pack the items from tallest to shortest, keeping the
+                    // most recently used items if they no longer fit.
+                    std::vector<std::pair<UID, Item> > items;
+                    for (const auto& j : page.shelves)
+                    {
+                        for (const auto& k : j.items)
                         {
-                            for (uint8_t i = 0; i < 2; ++i)
+                            const auto l = p.items.find(k);
+                            if (l != p.items.end())
                             {
-                                old->children[i].reset();
+                                items.push_back(*l);
+                                p.items.erase(l);
                             }
                         }
-                        old->uid = 0;
-                        old->timestamp = ++_timestamp;
-                        if (auto node = old->insert(data))
+                    }
+                    std::sort(
+                        items.begin(),
+                        items.end(),
+                        [](const std::pair<UID, Item>& a, const std::pair<UID, Item>& b)
                         {
-                            node->uid = ++_uid;
-
-                            //! \todo Do we need to zero out the old data?
-                            //auto zero = Image::Data::create(Image::Info(data->getSize() + p.border * 2, p.textureType));
-                            //zero->zero();
-                            //p.textures[node->texture]->copy(zero, node->bbox.min);
-
-                            p.textures[node->textureIndex]->copy(
-                                *data,
-                                static_cast<uint16_t>(node->bbox.min.x + p.border),
-                                static_cast<uint16_t>(node->bbox.min.y + p.border));
-                            p.cache[node->uid] = node;
-                            _toTextureAtlasItem(node, out);
+                            return a.second.h != b.second.h ?
+                                (a.second.h > b.second.h) :
+                                (a.second.timestamp > b.second.timestamp);
+                        });
+
+                    // The item images are not kept in memory, so the page is
+                    // copied to a temporary texture on the GPU and the items
+                    // are copied back to their new positions.
+                    const bool copy = i < p.textures.size();
+                    GLint framebufferBinding = 0;
+                    GLint textureBinding = 0;
+                    if (copy)
+                    {
+                        if (!p.compactTexture)
+                        {
+                            p.compactTexture = OpenGL::Texture::create(
+                                Image::Info(p.textureSize, p.textureSize, p.textureType),
+                                GL_NEAREST,
+                                GL_NEAREST);
+                        }
+                        if (!p.compactFramebuffer)
+                        {
+                            glGenFramebuffers(1, &p.compactFramebuffer);
+                        }
+                        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebufferBinding);
+                        glGetIntegerv(GL_TEXTURE_BINDING_2D, &textureBinding);
+                        glBindFramebuffer(GL_FRAMEBUFFER, p.compactFramebuffer);
+                        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p.textures[i]->getID(), 0);
+                        glBindTexture(GL_TEXTURE_2D, p.compactTexture->getID());
+                        glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, p.textureSize, page.y);
+                        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, p.compactTexture->getID(), 0);
+                        glBindTexture(GL_TEXTURE_2D, p.textures[i]->getID());
+                    }
 
-                            return node->uid;
+                    p.clearPage(page);
+                    for (auto& j : items)
+                    {
+                        const uint16_t x = j.second.x;
+                        const uint16_t y = j.second.y;
+                        if (p.allocate(i, j.first, j.second))
+                        {
+                            p.pages[i].shelves[j.second.shelf].timestamp = std::max(
+                                p.pages[i].shelves[j.second.shelf].timestamp,
+                                j.second.timestamp);
+                            if (copy)
+                            {
+                                glCopyTexSubImage2D(
+                                    GL_TEXTURE_2D,
+                                    0,
+                                    j.second.x,
+                                    j.second.y,
+                                    x,
+                                    y,
+                                    j.second.w,
+                                    j.second.h);
+                            }
+                            p.items[j.first] = j.second;
                         }
                     }
+
+                    if (copy)
+                    {
+                        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+                        glBindFramebuffer(GL_FRAMEBUFFER, framebufferBinding);
+                        glBindTexture(GL_TEXTURE_2D, textureBinding);
+                    }
+                    ++p.generation;
+                    ++p.compactionCount;
                 }
-                return 0;
             }
 
             float TextureAtlas::getPercentageUsed() const
             {
                 DJV_PRIVATE_PTR();
-                float out = 0.F;
-                for (uint8_t i = 0; i < p.textureCount; ++i)
+                size_t used = 0;
+                for (const auto& i : p.pages)
                 {
-                    size_t used = 0;
-                    std::vector<std::shared_ptr<BoxPackingNode> > leafs;
-                    _getLeafNodes(p.boxPackingNodes[i], leafs);
-                    for (const auto & i : leafs)
+                    used += i.itemArea;
+                }
+                return p.textureCount ?
+                    (used / static_cast<float>(p.textureSize * p.textureSize) / static_cast<float>(p.textureCount) * 100.F) :
+                    0.F;
+            }
+
+            std::vector<TextureAtlasPageStats> TextureAtlas::getPageStats() const
+            {
+                DJV_PRIVATE_PTR();
+                std::vector<TextureAtlasPageStats> out;
+                const float area = static_cast<float>(p.textureSize) * static_cast<float>(p.textureSize);
+                for (const auto& i : p.pages)
+                {
+                    TextureAtlasPageStats stats;
+                    for (const auto& j : i.shelves)
                     {
-                        if (i->isOccupied())
-                        {
-                            used += i->bbox.getArea();
-                        }
+                        stats.itemCount += j.items.size();
                     }
-                    out += used;
+                    stats.shelfCount = i.shelves.size();
+                    stats.occupancy = i.itemArea / area * 100.F;
+                    stats.allocated = static_cast<float>(p.textureSize) * i.y / area * 100.F;
+                    out.push_back(stats);
                 }
-                return out / static_cast<float>(p.textureSize * p.textureSize) / static_cast<float>(p.textureCount) * 100.F;
+                return out;
             }
 
-            void TextureAtlas::_getAllNodes(
-                const std::shared_ptr<BoxPackingNode>& node,
-                std::vector<std::shared_ptr<BoxPackingNode> > & out)
+            size_t TextureAtlas::getEvictionCount() const
             {
-                out.push_back(node);
-                if (node->isBranch())
+                return _p->evictionCount;
+            }
+
+            size_t TextureAtlas::getCompactionCount() const
+            {
+                return _p->compactionCount;
+            }
+
+            size_t TextureAtlas::getGeneration() const
+            {
+                return _p->generation;
+            }
+
+            bool TextureAtlas::Private::allocate(uint8_t pageIndex, UID uid, Item& item)
+            {
+                auto& page = pages[pageIndex];
+                const uint16_t shelfHeight = getShelfHeight(item.h);
+                const float shelfHeightMax = shelfHeight * shelfHeightTolerance;
+
+                // Find the shortest open shelf with enough room.
+                size_t shelfIndex = 0;
+                bool found = false;
+                for (auto i = page.openShelves.lower_bound(shelfHeight);
+                    i != page.openShelves.end() && i->first <= shelfHeightMax;
+                    ++i)
                 {
-                    _getAllNodes(node->children[0], out);
-                    _getAllNodes(node->children[1], out);
+                    if (page.shelves[i->second].x + item.w <= textureSize)
+                    {
+                        shelfIndex = i->second;
+                        found = true;
+                        break;
+                    }
                 }
+
+                // Add a new shelf.
+                if (!found && page.y + shelfHeight <= textureSize)
+                {
+                    Shelf shelf;
+                    shelf.y = page.y;
+                    shelf.h = shelfHeight;
+                    shelf.open = false;
+                    shelfIndex = page.shelves.size();
+                    page.shelves.push_back(shelf);
+                    page.y += shelfHeight;
+                    openShelf(page, shelfIndex);
+                    found = true;
+                }
+
+                return found ? allocate(pageIndex, shelfIndex, uid, item) : false;
             }
 
-            void TextureAtlas::_getLeafNodes(
-                const std::shared_ptr<BoxPackingNode>& node,
-                std::vector<std::shared_ptr<BoxPackingNode> > & out) const
+            bool TextureAtlas::Private::allocate(uint8_t pageIndex, size_t shelfIndex, UID uid, Item& item)
             {
-                if (node->isBranch())
+                auto& page = pages[pageIndex];
+                auto& shelf = page.shelves[shelfIndex];
+                const bool out = shelf.h >= item.h && shelf.x + item.w <= textureSize;
+                if (out)
                 {
-                    _getLeafNodes(node->children[0], out);
-                    _getLeafNodes(node->children[1], out);
+                    item.page = pageIndex;
+                    item.shelf = shelfIndex;
+                    item.x = shelf.x;
+                    item.y = shelf.y;
+                    if (!item.timestamp)
+                    {
+                        item.timestamp = ++timestamp;
+                    }
+                    shelf.x += item.w;
+                    shelf.items.push_back(uid);
+                    shelf.timestamp = std::max(shelf.timestamp, item.timestamp);
+                    page.itemArea += static_cast<size_t>(item.w) * item.h;
+
+                    // Close the shelf when there is no longer room for items
+                    // of about the same size.
+                    if (textureSize - shelf.x < shelf.h / 2)
+                    {
+                        closeShelf(page, shelfIndex);
+                    }
                 }
-                else
+                return out;
+            }
+
+            void TextureAtlas::Private::openShelf(Page& page, size_t shelf)
+            {
+                if (!page.shelves[shelf].open)
                 {
-                    out.push_back(node);
+                    page.shelves[shelf].open = true;
+                    page.openShelves.insert(std::make_pair(page.shelves[shelf].h, shelf));
                 }
             }
 
-            void TextureAtlas::_toTextureAtlasItem(
-                const std::shared_ptr<BoxPackingNode>& node,
-                TextureAtlasItem & out)
+            void TextureAtlas::Private::closeShelf(Page& page, size_t shelf)
             {
-                DJV_PRIVATE_PTR();
-                out.w = node->bbox.w();
-                out.h = node->bbox.h();
-                out.textureIndex = node->textureIndex;
-                out.textureU = FloatRange(
-                    (node->bbox.min.x + p.border)     / static_cast<float>(p.textureSize),
-                    (node->bbox.max.x - p.border + 1) / static_cast<float>(p.textureSize));
-                out.textureV = FloatRange(
-                    (node->bbox.min.y + p.border)     / static_cast<float>(p.textureSize),
-                    (node->bbox.max.y - p.border + 1) / static_cast<float>(p.textureSize));
+                if (page.shelves[shelf].open)
+                {
+                    page.shelves[shelf].open = false;
+                    auto range = page.openShelves.equal_range(page.shelves[shelf].h);
+                    for (auto i = range.first; i != range.second; ++i)
+                    {
+                        if (i->second == shelf)
+                        {
+                            page.openShelves.erase(i);
+                            break;
+                        }
+                    }
+                }
             }
 
-            void TextureAtlas::_removeFromAtlas(const std::shared_ptr<BoxPackingNode>& node)
+            void TextureAtlas::Private::evictShelf(uint8_t pageIndex, size_t shelfIndex)
             {
-                DJV_PRIVATE_PTR();
-                auto i = p.cache.find(node->uid);
-                if (i != p.cache.end())
+                auto& page = pages[pageIndex];
+                auto& shelf = page.shelves[shelfIndex];
+                for (const auto& i : shelf.items)
                 {
-                    node->uid = 0;
-                    p.cache.erase(i);
+                    const auto j = items.find(i);
+                    if (j != items.end())
+                    {
+                        page.itemArea -= static_cast<size_t>(j->second.w) * j->second.h;
+                        items.erase(j);
+                    }
                 }
-                if (node->isBranch())
+                shelf.items.clear();
+                shelf.x = 0;
+                shelf.timestamp = 0;
+                openShelf(page, shelfIndex);
+                page.evicted = true;
+                ++generation;
+                ++evictionCount;
+            }
+
+            void TextureAtlas::Private::evictPage(uint8_t pageIndex)
+            {
+                auto& page = pages[pageIndex];
+                for (const auto& i : page.shelves)
                 {
-                    _removeFromAtlas(node->children[0]);
-                    _removeFromAtlas(node->children[1]);
+                    for (const auto& j : i.items)
+                    {
+                        items.erase(j);
+                    }
                 }
+                clearPage(page);
+                ++generation;
+                ++evictionCount;
+            }
+
+            void TextureAtlas::Private::clearPage(Page& page)
+            {
+                page.shelves.clear();
+                page.openShelves.clear();
+                page.y = 0;
+                page.itemArea = 0;
+            }
+
+            void TextureAtlas::Private::toTextureAtlasItem(const Item& item, TextureAtlasItem& out) const
+            {
+                out.w = item.w;
+                out.h = item.h;
+                out.textureIndex = item.page;
+                out.textureU = FloatRange(
+                    (item.x + border)          / static_cast<float>(textureSize),
+                    (item.x + item.w - border) / static_cast<float>(textureSize));
+                out.textureV = FloatRange(
+                    (item.y + border)          / static_cast<float>(textureSize),
+                    (item.y + item.h - border) / static_cast<float>(textureSize));
             }
 
         } // namespace Render
@@ -33,6 +33,8 @@
 #include <djvCore/Range.h>
 #include <djvCore/UID.h>
 
+#include <vector>
+
 namespace djv
 {
     namespace AV
@@ -49,13 +51,38 @@ namespace djv
                 Core::FloatRange textureV;
             };
 
-            //! This class provides a texture atlas.
+            //! This struct provides texture atlas page statistics.
+            struct TextureAtlasPageStats
+            {
+                size_t itemCount  = 0;
+                size_t shelfCount = 0;
+                float  occupancy  = 0.F; //!< Percentage of the page used by items.
+                float  allocated  = 0.F; //!< Percentage of the page allocated to shelves.
+            };
+
+            //! This class provides a texture atlas. Items are packed into
+            //! horizontal shelves on each page (texture), and shelves are
+            //! found by height. When the atlas is full the least recently used
+            //! shelf is evicted, and compact() re-packs the pages that have
+            //! had evictions.
+            //!
+            //! References:
+            //! - Jukka Jylanki, "A Thousand Ways to Pack the Bin"
             class TextureAtlas
             {
                 DJV_NON_COPYABLE(TextureAtlas);
 
             public:
-                TextureAtlas(uint8_t textureCount, uint16_t textureSize, Image::Type, GLenum filter = GL_LINEAR, uint8_t border = 1);
+                //! If textures is false no OpenGL textures are created and the
+                //! atlas only packs items, so it can be used without an OpenGL
+                //! context.
+                TextureAtlas(
+                    uint8_t textureCount,
+                    uint16_t textureSize,
+                    Image::Type,
+                    GLenum filter = GL_LINEAR,
+                    uint8_t border = 1,
+                    bool textures = true);
                 ~TextureAtlas();
 
                 uint8_t getTextureCount() const;
@@ -66,22 +93,21 @@ namespace djv
                 bool getItem(Core::UID, TextureAtlasItem &);
                 Core::UID addItem(const std::shared_ptr<Image::Data> &, TextureAtlasItem &);
 
-                float getPercentageUsed() const;
+                //! Re-pack the pages that have had items evicted. This changes
+                //! the texture coordinates of the items so it should not be
+                //! called while the items are being drawn.
+                void compact();
 
-            private:
-                class BoxPackingNode;
+                float getPercentageUsed() const;
+                std::vector<TextureAtlasPageStats> getPageStats() const;
+                size_t getEvictionCount() const;
+                size_t getCompactionCount() const;
 
-                void _getAllNodes(
-                    const std::shared_ptr<BoxPackingNode>&,
-                    std::vector<std::shared_ptr<BoxPackingNode> >&);
-                void _getLeafNodes(
-                    const std::shared_ptr<BoxPackingNode>&,
-                    std::vector<std::shared_ptr<BoxPackingNode> >&) const;
-                void _toTextureAtlasItem(
-                    const std::shared_ptr<BoxPackingNode>&,
-                    TextureAtlasItem&);
-                void _removeFromAtlas(const std::shared_ptr<BoxPackingNode>&);
+                //! Get the generation. This is incremented each time items are
+                //! removed or moved so cached items can be validated.
+                size_t getGeneration() const;
 
+            private:
                 DJV_PRIVATE();
             };
 
@@ -30,20 +30,17 @@
 #include <djvAV/ThumbnailSystem.h>
 
 #include <djvAV/Image.h>
-#include <djvAV/ImageConvert.h>
+#include <djvAV/ImageUtil.h>
 #include <djvAV/IO.h>
 
 #include <djvCore/Cache.h>
 #include <djvCore/Context.h>
 #include <djvCore/LogSystem.h>
-#include <djvCore/OS.h>
-#include <djvCore/ResourceSystem.h>
 #include <djvCore/Timer.h>
 
-#define GLFW_INCLUDE_NONE
-#include <GLFW/glfw3.h>
-
 #include <atomic>
+#include <condition_variable>
+#include <map>
 #include <mutex>
 #include <thread>
 
@@ -56,22 +53,22 @@ namespace djv
         namespace
         {
             //! \todo Should this be configurable?
-            const size_t infoProcessMax  = 4;
-            const size_t imageProcessMax = 4;
-            const size_t infoCacheMax    = 1000;
-            const size_t imageCacheMax   = 1000;
+            const size_t infoCacheMax  = 1000;
+            const size_t imageCacheMax = 1000;
+            const size_t proxyMax      = 3;
 
             struct InfoRequest
             {
                 InfoRequest() :
-                    uid(createUID())
+                    uid(createUID()),
+                    time(std::chrono::steady_clock::now())
                 {}
 
                 InfoRequest(InfoRequest&& other) noexcept :
                     uid(other.uid),
                     fileInfo(other.fileInfo),
-                    read(std::move(other.read)),
-                    infoFuture(std::move(other.infoFuture)),
+                    options(std::move(other.options)),
+                    time(other.time),
                     promise(std::move(other.promise))
                 {}
 
@@ -84,8 +81,8 @@ namespace djv
                     {
                         uid = other.uid;
                         fileInfo = other.fileInfo;
-                        read = std::move(other.read);
-                        infoFuture = std::move(other.infoFuture);
+                        options = std::move(other.options);
+                        time = other.time;
                         promise = std::move(other.promise);
                     }
                     return *this;
@@ -93,15 +90,16 @@ namespace djv
 
                 UID uid = 0;
                 FileSystem::FileInfo fileInfo;
-                std::shared_ptr<IO::IRead> read;
-                std::future<IO::Info> infoFuture;
+                ThumbnailSystem::RequestOptions options;
+                std::chrono::steady_clock::time_point time;
                 std::promise<IO::Info> promise;
             };
 
             struct ImageRequest
             {
                 ImageRequest() :
-                    uid(createUID())
+                    uid(createUID()),
+                    time(std::chrono::steady_clock::now())
                 {}
 
                 ImageRequest(ImageRequest && other) noexcept :
@@ -109,7 +107,8 @@ namespace djv
                     fileInfo(other.fileInfo),
                     size(std::move(other.size)),
                     type(std::move(other.type)),
-                    read(std::move(other.read)),
+                    options(std::move(other.options)),
+                    time(other.time),
                     promise(std::move(other.promise))
                 {}
 
@@ -124,7 +123,8 @@ namespace djv
                         fileInfo = other.fileInfo;
                         size = std::move(other.size);
                         type = std::move(other.type);
-                        read = std::move(other.read);
+                        options = std::move(other.options);
+                        time = other.time;
                         promise = std::move(other.promise);
                     }
                     return *this;
@@ -134,10 +134,85 @@ namespace djv
                 FileSystem::FileInfo fileInfo;
                 Image::Size size;
                 Image::Type type = Image::Type::None;
-                std::shared_ptr<IO::IRead> read;
+                ThumbnailSystem::RequestOptions options;
+                std::chrono::steady_clock::time_point time;
                 std::promise<std::shared_ptr<Image::Image> > promise;
             };
 
+            //! Requests are ordered by priority, and then by the order they
+            //! were made in.
+            typedef std::pair<size_t, UID> RequestKey;
+
+            bool isStale(const ThumbnailSystem::RequestOptions& options)
+            {
+                return options.generation && options.generationValue < options.generation->get();
+            }
+
+            //! Pop the next request from the queue, dropping stale requests.
+            template<typename T>
+            bool popRequest(
+                std::map<RequestKey, T>& requests,
+                std::map<UID, RequestKey>& keys,
+                T& out,
+                size_t& dropped)
+            {
+                while (requests.size())
+                {
+                    auto i = requests.begin();
+                    T request = std::move(i->second);
+                    keys.erase(request.uid);
+                    requests.erase(i);
+                    if (!isStale(request.options))
+                    {
+                        out = std::move(request);
+                        return true;
+                    }
+                    ++dropped;
+                }
+                return false;
+            }
+
+            //! Move a pending request to a new position in the queue.
+            template<typename T>
+            void setRequestOptions(
+                std::map<RequestKey, T>& requests,
+                std::map<UID, RequestKey>& keys,
+                UID uid,
+                const ThumbnailSystem::RequestOptions& options)
+            {
+                const auto i = keys.find(uid);
+                if (i != keys.end())
+                {
+                    const auto j = requests.find(i->second);
+                    T request = std::move(j->second);
+                    requests.erase(j);
+                    request.options = options;
+                    i->second = RequestKey(options.priority, uid);
+                    requests.insert(std::make_pair(i->second, std::move(request)));
+                }
+            }
+
+            //! Remove a pending request from the queue.
+            template<typename T>
+            void cancelRequest(
+                std::map<RequestKey, T>& requests,
+                std::map<UID, RequestKey>& keys,
+                UID uid)
+            {
+                const auto i = keys.find(uid);
+                if (i != keys.end())
+                {
+                    requests.erase(i->second);
+                    keys.erase(i);
+                }
+            }
+
+            size_t getMicroseconds(const std::chrono::steady_clock::time_point& time)
+            {
+                return std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - time).count();
+            }
+
             size_t getInfoCacheKey(const FileSystem::FileInfo & fileInfo)
             {
                 size_t out = 0;
@@ -155,8 +230,41 @@ namespace djv
                 return out;
             }
 
+            //! Get the smallest proxy level that is still larger than the
+            //! thumbnail size.
+            size_t getProxy(const Image::Size& imageSize, const Image::Size& size)
+            {
+                size_t out = 0;
+                while (out < proxyMax &&
+                    (imageSize.w >> (out + 1)) >= size.w &&
+                    (imageSize.h >> (out + 1)) >= size.h)
+                {
+                    ++out;
+                }
+                return out;
+            }
+
         } // namespace
+
+        ThumbnailSystem::Generation::Generation() :
+            _value(0)
+        {}
+
+        size_t ThumbnailSystem::Generation::get() const
+        {
+            return _value;
+        }
+
+        void ThumbnailSystem::Generation::set(size_t value)
+        {
+            _value = value;
+        }
         
+        ThumbnailSystem::RequestOptions::RequestOptions() :
+            priority(0),
+            generationValue(0)
+        {}
+
         ThumbnailSystem::InfoFuture::InfoFuture()
         {}
         
@@ -181,23 +289,29 @@ namespace djv
         {
             std::shared_ptr<IO::System> io;
 
-            std::list<InfoRequest> infoRequests;
-            std::list<ImageRequest> imageRequests;
+            std::map<RequestKey, InfoRequest> infoRequests;
+            std::map<UID, RequestKey> infoRequestKeys;
+            std::map<RequestKey, ImageRequest> imageRequests;
+            std::map<UID, RequestKey> imageRequestKeys;
+            size_t droppedRequests = 0;
+            size_t droppedRequestsLogged = 0;
+            bool paused = false;
             std::condition_variable requestCV;
-            std::mutex requestMutex;
-            std::list<InfoRequest> pendingInfoRequests;
-            std::list<ImageRequest> pendingImageRequests;
+            mutable std::mutex requestMutex;
 
             Memory::Cache<size_t, IO::Info> infoCache;
             std::atomic<float> infoCachePercentage;
             Memory::Cache<size_t, std::shared_ptr<Image::Image> > imageCache;
             std::atomic<float> imageCachePercentage;
-            std::atomic<bool> clearCache;
+            std::mutex cacheMutex;
             std::shared_ptr<ValueObserver<bool> > ioOptionsObserver;
 
-            GLFWwindow * glfwWindow = nullptr;
+            std::atomic<size_t> infoLatencyTotal;
+            std::atomic<size_t> infoLatencyCount;
+            std::atomic<size_t> imageLatencyTotal;
+            std::atomic<size_t> imageLatencyCount;
             std::shared_ptr<Time::Timer> statsTimer;
-            std::thread thread;
+            std::vector<std::thread> threads;
             std::atomic<bool> running;
         };
 
@@ -215,30 +329,10 @@ namespace djv
             p.infoCachePercentage = 0.F;
             p.imageCache.setMax(imageCacheMax);
             p.imageCachePercentage = 0.F;
-            p.clearCache = false;
-
-#if defined(DJV_OPENGL_ES2)
-            glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-#else // DJV_OPENGL_ES2
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
-            glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#endif // DJV_OPENGL_ES2
-            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
-            if (OS::getIntEnv("DJV_OPENGL_DEBUG") != 0)
-            {
-                glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
-            }
-            p.glfwWindow = glfwCreateWindow(100, 100, context->getName().c_str(), NULL, NULL);
-            if (!p.glfwWindow)
-            {
-                std::stringstream ss;
-                ss << DJV_TEXT("error_glfw_window_creation");
-                throw ThumbnailError(ss.str());
-            }
+            p.infoLatencyTotal = 0;
+            p.infoLatencyCount = 0;
+            p.imageLatencyTotal = 0;
+            p.imageLatencyCount = 0;
 
             p.statsTimer = Time::Timer::create(context);
             p.statsTimer->setRepeating(true);
@@ -247,81 +341,52 @@ namespace djv
                 [this](const std::chrono::steady_clock::time_point&, const Time::Unit&)
             {
                 DJV_PRIVATE_PTR();
+                size_t infoRequests = 0;
+                size_t imageRequests = 0;
+                size_t droppedRequests = 0;
+                {
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    infoRequests = p.infoRequests.size();
+                    imageRequests = p.imageRequests.size();
+                    droppedRequests = p.droppedRequests - p.droppedRequestsLogged;
+                    p.droppedRequestsLogged = p.droppedRequests;
+                }
+                const size_t infoLatencyTotal = p.infoLatencyTotal.exchange(0);
+                const size_t infoLatencyCount = p.infoLatencyCount.exchange(0);
+                const size_t imageLatencyTotal = p.imageLatencyTotal.exchange(0);
+                const size_t imageLatencyCount = p.imageLatencyCount.exchange(0);
                 std::stringstream ss;
                 {
                     ss << "Info cache: " << p.infoCachePercentage << "%\n";
-                    ss << "Image cache: " << p.imageCachePercentage << '%';
+                    ss << "Image cache: " << p.imageCachePercentage << "%\n";
+                    ss << "Info queue: " << infoRequests << "\n";
+                    ss << "Image queue: " << imageRequests << "\n";
+                    ss << "Dropped requests: " << droppedRequests << "\n";
+                    ss << "Info latency: " <<
+                        (infoLatencyCount ? (infoLatencyTotal / infoLatencyCount / 1000) : 0) << "ms\n";
+                    ss << "Image latency: " <<
+                        (imageLatencyCount ? (imageLatencyTotal / imageLatencyCount / 1000) : 0) << "ms";
                 }
                 _log(ss.str());
             });
 
-            auto logSystem = context->getSystemT<LogSystem>();
-            auto resourceSystem = context->getSystemT<ResourceSystem>();
+            // Start the worker threads. The files are read and resized on the
+            // worker threads so no OpenGL context is required.
+            const size_t threadCount = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+            {
+                std::stringstream ss;
+                ss << "Thread count: " << threadCount;
+                _log(ss.str());
+            }
             p.running = true;
-            p.thread = std::thread(
-                [this, resourceSystem, logSystem]
+            for (size_t i = 0; i < threadCount; ++i)
             {
-                DJV_PRIVATE_PTR();
-                try
-                {
-                    glfwMakeContextCurrent(p.glfwWindow);
-#if defined(DJV_OPENGL_ES2)
-                    if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
-#else // DJV_OPENGL_ES2
-                    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-#endif // DJV_OPENGL_ES2
+                p.threads.push_back(std::thread(
+                    [this]
                     {
-                        std::stringstream ss;
-                        ss << DJV_TEXT("error_glad_init");
-                        throw ThumbnailError(ss.str());
-                    }
-
-                    auto convert = Image::Convert::create(resourceSystem);
-
-                    const auto timeout = Time::getValue(Time::TimerValue::Medium);
-                    while (p.running)
-                    {
-                        if (p.clearCache)
-                        {
-                            p.clearCache = false;
-                            p.infoCache.clear();
-                            p.infoCachePercentage = 0.F;
-                            p.imageCache.clear();
-                            p.imageCachePercentage = 0.F;
-                        }
-
-                        bool infoRequests  = p.pendingInfoRequests.size();
-                        bool imageRequests = p.pendingImageRequests.size();
-                        {
-                            std::unique_lock<std::mutex> lock(p.requestMutex);
-                            if (p.requestCV.wait_for(
-                                lock,
-                                std::chrono::milliseconds(timeout),
-                                [this]
-                            {
-                                DJV_PRIVATE_PTR();
-                                return p.infoRequests.size() || p.imageRequests.size();
-                            }))
-                            {
-                                infoRequests  |= p.infoRequests.size () > 0;
-                                imageRequests |= p.imageRequests.size() > 0;
-                            }
-                        }
-                        if (infoRequests)
-                        {
-                            _handleInfoRequests();
-                        }
-                        if (imageRequests)
-                        {
-                            _handleImageRequests(convert);
-                        }
-                    }
-                }
-                catch (const std::exception & e)
-                {
-                    logSystem->log("djv::AV::ThumbnailSystem", e.what(), LogLevel::Error);
-                }
-            });
+                        _run();
+                    }));
+            }
 
             auto weak = std::weak_ptr<ThumbnailSystem>(std::dynamic_pointer_cast<ThumbnailSystem>(shared_from_this()));
             p.ioOptionsObserver = ValueObserver<bool>::create(
@@ -343,13 +408,13 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             p.running = false;
-            if (p.thread.joinable())
+            p.requestCV.notify_all();
+            for (auto& i : p.threads)
             {
-                p.thread.join();
-            }
-            if (p.glfwWindow)
-            {
-                glfwDestroyWindow(p.glfwWindow);
+                if (i.joinable())
+                {
+                    i.join();
+                }
             }
         }
 
@@ -360,75 +425,76 @@ namespace djv
             return out;
         }
 
-        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(const FileSystem::FileInfo & fileInfo)
+        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(
+            const FileSystem::FileInfo& fileInfo,
+            const RequestOptions&       options)
         {
             DJV_PRIVATE_PTR();
             InfoRequest request;
             request.fileInfo = fileInfo;
+            request.options = options;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
-                p.infoRequests.push_back(std::move(request));
+                const RequestKey key(options.priority, uid);
+                p.infoRequests.insert(std::make_pair(key, std::move(request)));
+                p.infoRequestKeys[uid] = key;
             }
             p.requestCV.notify_one();
-            return InfoFuture(future, request.uid);
+            return InfoFuture(future, uid);
+        }
+
+        void ThumbnailSystem::setInfoOptions(UID uid, const RequestOptions& options)
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            setRequestOptions(p.infoRequests, p.infoRequestKeys, uid, options);
         }
         
         void ThumbnailSystem::cancelInfo(UID uid)
         {
             DJV_PRIVATE_PTR();
-            {
-                std::unique_lock<std::mutex> lock(p.requestMutex);
-                const auto i = std::find_if(
-                    p.infoRequests.rbegin(),
-                    p.infoRequests.rend(),
-                    [uid](const InfoRequest & value)
-                {
-                    return value.uid == uid;
-                });
-                if (i != p.infoRequests.rend())
-                {
-                    p.infoRequests.erase(--(i.base()));
-                }
-            }
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            cancelRequest(p.infoRequests, p.infoRequestKeys, uid);
         }
 
         ThumbnailSystem::ImageFuture ThumbnailSystem::getImage(
             const FileSystem::FileInfo& fileInfo,
             const Image::Size&          size,
-            Image::Type                 type)
+            Image::Type                 type,
+            const RequestOptions&       options)
         {
             DJV_PRIVATE_PTR();
             ImageRequest request;
             request.fileInfo = fileInfo;
             request.size = size;
             request.type = type;
+            request.options = options;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
-                p.imageRequests.push_back(std::move(request));
+                const RequestKey key(options.priority, uid);
+                p.imageRequests.insert(std::make_pair(key, std::move(request)));
+                p.imageRequestKeys[uid] = key;
             }
             p.requestCV.notify_one();
-            return ImageFuture(future, request.uid);
+            return ImageFuture(future, uid);
+        }
+
+        void ThumbnailSystem::setImageOptions(UID uid, const RequestOptions& options)
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            setRequestOptions(p.imageRequests, p.imageRequestKeys, uid, options);
         }
         
         void ThumbnailSystem::cancelImage(UID uid)
         {
             DJV_PRIVATE_PTR();
-            {
-                std::unique_lock<std::mutex> lock(p.requestMutex);
-                const auto i = std::find_if(
-                    p.imageRequests.rbegin(),
-                    p.imageRequests.rend(),
-                    [uid](const ImageRequest & value)
-                {
-                    return value.uid == uid;
-                });
-                if (i != p.imageRequests.rend())
-                {
-                    p.imageRequests.erase(--(i.base()));
-                }
-            }
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            cancelRequest(p.imageRequests, p.imageRequestKeys, uid);
         }
 
         float ThumbnailSystem::getInfoCachePercentage() const
@@ -441,224 +507,215 @@ namespace djv
             return _p->imageCachePercentage;
         }
 
-        void ThumbnailSystem::clearCache()
+        size_t ThumbnailSystem::getInfoRequestCount() const
         {
-            _p->clearCache = true;
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.infoRequests.size();
         }
 
-        void ThumbnailSystem::_handleInfoRequests()
+        size_t ThumbnailSystem::getImageRequestCount() const
         {
             DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.imageRequests.size();
+        }
 
-            // Process new requests.
-            while (p.pendingInfoRequests.size() < infoProcessMax)
+        size_t ThumbnailSystem::getDroppedRequestCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.droppedRequests;
+        }
+
+        bool ThumbnailSystem::isPaused() const
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.paused;
+        }
+
+        void ThumbnailSystem::setPaused(bool value)
+        {
+            DJV_PRIVATE_PTR();
             {
-                InfoRequest i;
-                {
-                    std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.infoRequests.size())
-                    {
-                        i = std::move(p.infoRequests.front());
-                        p.infoRequests.pop_front();
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-                const auto key = getInfoCacheKey(i.fileInfo);
-                IO::Info info;
-                const bool cached = p.infoCache.get(key, info);
-                if (cached)
-                {
-                    i.promise.set_value(info);
-                }
-                else
-                {
-                    try
-                    {
-                        i.read = p.io->read(i.fileInfo);
-                        i.infoFuture = i.read->getInfo();
-                        p.pendingInfoRequests.push_back(std::move(i));
-                    }
-                    catch (const std::exception &)
-                    {
-                        try
-                        {
-                            i.promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception & e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
-                    }
-                }
+                std::unique_lock<std::mutex> lock(p.requestMutex);
+                p.paused = value;
             }
-
-            // Process pending requests.
-            auto i = p.pendingInfoRequests.begin();
-            while (i != p.pendingInfoRequests.end())
+            if (!value)
             {
-                if (i->infoFuture.valid() &&
-                    i->infoFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-                {
-                    try
-                    {
-                        const auto info = i->infoFuture.get();
-                        p.infoCache.add(getInfoCacheKey(i->fileInfo), info);
-                        p.infoCachePercentage = p.infoCache.getPercentageUsed();
-                        i->promise.set_value(info);
-                    }
-                    catch (const std::exception &)
-                    {
-                        try
-                        {
-                            i->promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception & e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
-                    }
-                    i = p.pendingInfoRequests.erase(i);
-                }
-                else
-                {
-                    ++i;
-                }
+                p.requestCV.notify_all();
             }
         }
 
-        void ThumbnailSystem::_handleImageRequests(const std::shared_ptr<Image::Convert> & convert)
+        void ThumbnailSystem::clearCache()
         {
             DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.cacheMutex);
+            p.infoCache.clear();
+            p.infoCachePercentage = 0.F;
+            p.imageCache.clear();
+            p.imageCachePercentage = 0.F;
+        }
 
-            // Process new requests.
-            while (p.pendingImageRequests.size() < imageProcessMax)
+        void ThumbnailSystem::_run()
+        {
+            DJV_PRIVATE_PTR();
+            const auto timeout = Time::getValue(Time::TimerValue::Medium);
+            while (p.running)
             {
-                ImageRequest i;
+                // Get the next request. Information requests are handled
+                // first since they are cheap compared to images. Stale
+                // requests are dropped here before any files are opened.
+                InfoRequest infoRequest;
+                ImageRequest imageRequest;
+                bool hasInfoRequest = false;
+                bool hasImageRequest = false;
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.imageRequests.size())
+                    if (p.requestCV.wait_for(
+                        lock,
+                        std::chrono::milliseconds(timeout),
+                        [this]
                     {
-                        i = std::move(p.imageRequests.front());
-                        p.imageRequests.pop_front();
-                    }
-                    else
+                        DJV_PRIVATE_PTR();
+                        return (!p.paused && (p.infoRequests.size() || p.imageRequests.size())) || !p.running;
+                    }) && !p.paused)
                     {
-                        break;
+                        hasInfoRequest = popRequest(p.infoRequests, p.infoRequestKeys, infoRequest, p.droppedRequests);
+                        if (!hasInfoRequest)
+                        {
+                            hasImageRequest = popRequest(p.imageRequests, p.imageRequestKeys, imageRequest, p.droppedRequests);
+                        }
                     }
                 }
-                const auto key = getImageCacheKey(i.fileInfo, i.size, i.type);
-                std::shared_ptr<Image::Image> image;
-                p.imageCache.get(key, image);
-                if (image)
+
+                try
                 {
-                    i.promise.set_value(image);
+                    if (hasInfoRequest)
+                    {
+                        std::shared_ptr<IO::IRead> read;
+                        infoRequest.promise.set_value(_getInfo(infoRequest.fileInfo, read));
+                        p.infoLatencyTotal += getMicroseconds(infoRequest.time);
+                        ++p.infoLatencyCount;
+                    }
+                    else if (hasImageRequest)
+                    {
+                        imageRequest.promise.set_value(_getImage(
+                            imageRequest.fileInfo,
+                            imageRequest.size,
+                            imageRequest.type));
+                        p.imageLatencyTotal += getMicroseconds(imageRequest.time);
+                        ++p.imageLatencyCount;
+                    }
                 }
-                else
+                catch (const std::exception&)
                 {
                     try
                     {
-                        i.read = p.io->read(i.fileInfo);
-                        const auto info = i.read->getInfo().get();
-                        if (info.video.size() > 0)
+                        if (hasInfoRequest)
                         {
-                            p.pendingImageRequests.push_back(std::move(i));
+                            infoRequest.promise.set_exception(std::current_exception());
                         }
-                        else
+                        else if (hasImageRequest)
                         {
-                            i.promise.set_value(nullptr);
+                            imageRequest.promise.set_exception(std::current_exception());
                         }
                     }
-                    catch (const std::exception&)
+                    catch (const std::exception& e)
                     {
-                        try
-                        {
-                            i.promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception &e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
+                        _log(e.what(), LogLevel::Error);
                     }
                 }
             }
+        }
 
-            // Process pending requests.
-            auto i = p.pendingImageRequests.begin();
-            while (i != p.pendingImageRequests.end())
+        IO::Info ThumbnailSystem::_getInfo(const FileSystem::FileInfo& fileInfo, std::shared_ptr<IO::IRead>& read)
+        {
+            DJV_PRIVATE_PTR();
+            const auto key = getInfoCacheKey(fileInfo);
+            IO::Info out;
             {
-                std::shared_ptr<Image::Image> image;
-                bool finished = false;
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                if (p.infoCache.get(key, out))
                 {
-                    std::lock_guard<std::mutex> lock(i->read->getMutex());
-                    auto& queue = i->read->getVideoQueue();
-                    if (!queue.isEmpty())
-                    {
-                        image = queue.getFrame().image;
-                    }
-                    if (queue.isFinished())
-                    {
-                        finished = true;
-                    }
+                    return out;
                 }
-                if (image)
+            }
+            // The reader is returned so it can be re-used to read the image
+            // instead of opening the file again.
+            IO::ReadOptions options;
+            options.thread = false;
+            read = p.io->read(fileInfo, options);
+            out = read->getInfo().get();
+            {
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                p.infoCache.add(key, out);
+                p.infoCachePercentage = p.infoCache.getPercentageUsed();
+            }
+            return out;
+        }
+
+        std::shared_ptr<Image::Image> ThumbnailSystem::_getImage(
+            const FileSystem::FileInfo& fileInfo,
+            const Image::Size&          size,
+            Image::Type                 type)
+        {
+            DJV_PRIVATE_PTR();
+            const auto key = getImageCacheKey(fileInfo, size, type);
+            std::shared_ptr<Image::Image> out;
+            {
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                p.imageCache.get(key, out);
+            }
+            if (out)
+            {
+                return out;
+            }
+
+            // Get the information first so we can decode at a proxy level.
+            std::shared_ptr<IO::IRead> read;
+            const auto info = _getInfo(fileInfo, read);
+            if (0 == info.video.size())
+            {
+                return nullptr;
+            }
+            if (!read)
+            {
+                IO::ReadOptions options;
+                options.thread = false;
+                read = p.io->read(fileInfo, options);
+            }
+            read->setProxy(getProxy(info.video[0].info.size, size));
+            out = read->readImage();
+            if (out)
+            {
+                Image::Size imageSize = out->getSize();
+                imageSize.w *= out->getInfo().pixelAspectRatio;
+                if (size != imageSize || type != Image::Type::None)
                 {
-                    try
+                    Image::Size resizeSize = size;
+                    const float aspect = resizeSize.h != 0 ? (resizeSize.w / static_cast<float>(resizeSize.h)) : 1.F;
+                    const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
+                    if (imageAspect < aspect)
                     {
-                        Image::Size imageSize = image->getSize();
-                        imageSize.w *= image->getInfo().pixelAspectRatio;
-                        if (i->size != imageSize || i->type != Image::Type::None)
-                        {
-                            Image::Size size = i->size;
-                            const float aspect = size.h != 0 ? (size.w / static_cast<float>(size.h)) : 1.F;
-                            const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
-                            if (imageAspect < aspect)
-                            {
-                                size.w = static_cast<uint16_t>(size.h * imageAspect);
-                            }
-                            else
-                            {
-                                size.h = static_cast<int>(size.w / imageAspect);
-                            }
-                            const auto type = i->type != Image::Type::None ? i->type : image->getType();
-                            const auto info = Image::Info(size, type);
-                            auto tmp = Image::Image::create(info);
-                            tmp->setPluginName(image->getPluginName());
-                            tmp->setTags(image->getTags());
-                            convert->process(*image, info, *tmp);
-                            image = tmp;
-                        }
-                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image);
-                        p.imageCachePercentage = p.imageCache.getPercentageUsed();
-                        i->promise.set_value(image);
+                        resizeSize.w = static_cast<uint16_t>(resizeSize.h * imageAspect);
                     }
-                    catch (const std::exception&)
+                    else
                     {
-                        try
-                        {
-                            i->promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
+                        resizeSize.h = static_cast<uint16_t>(resizeSize.w / imageAspect);
                     }
+                    auto tmp = Image::Image::create(Image::Info(resizeSize, type != Image::Type::None ? type : out->getType()));
+                    tmp->setPluginName(out->getPluginName());
+                    tmp->setTags(out->getTags());
+                    Image::resize(*out, *tmp);
+                    out = tmp;
                 }
-                else if (finished)
-                {
-                    i->promise.set_value(nullptr);
-                }
-                if (image || finished)
-                {
-                    i = p.pendingImageRequests.erase(i);
-                }
-                else
-                {
-                    ++i;
-                }
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                p.imageCache.add(key, out);
+                p.imageCachePercentage = p.imageCache.getPercentageUsed();
             }
+            return out;
         }
 
     } // namespace AV
@@ -35,6 +35,7 @@
 #include <djvCore/UID.h>
 #include <djvCore/Vector.h>
 
+#include <atomic>
 #include <future>
 
 namespace djv
@@ -53,6 +54,7 @@ namespace djv
         namespace IO
         {
             class Info;
+            class IRead;
 
         } // namespace IO
 
@@ -60,7 +62,6 @@ namespace djv
         {
             class Size;
             class Info;
-            class Convert;
             class Image;
             
         } // namespace Image
@@ -73,6 +74,12 @@ namespace djv
         };
         
         //! This class provides a system for generating thumbnail images from files.
+        //!
+        //! Requests are handled by a pool of worker threads that read the
+        //! files directly (without reader threads) and resize the images on
+        //! the CPU. Pending requests are handled in priority order, and
+        //! requests that belong to an old generation are dropped before they
+        //! are read. Each request opens at most one reader.
         class ThumbnailSystem : public Core::ISystem
         {
             DJV_NON_COPYABLE(ThumbnailSystem);
@@ -85,10 +92,34 @@ namespace djv
             virtual ~ThumbnailSystem();
 
             //! Create a new thumbnail system.
-            //! Throws:
-            //! - ThumbnailError
             static std::shared_ptr<ThumbnailSystem> create(const std::shared_ptr<Core::Context>&);
 
+            //! This class provides a request generation. Requests made with a
+            //! generation value older than the current one are dropped before
+            //! they are handled, for example when the items they belong to have
+            //! been scrolled out of view.
+            class Generation
+            {
+            public:
+                Generation();
+
+                size_t get() const;
+                void set(size_t);
+
+            private:
+                std::atomic<size_t> _value;
+            };
+
+            //! This structure provides request options.
+            struct RequestOptions
+            {
+                RequestOptions();
+
+                size_t                      priority;        //!< Lower values are handled first.
+                std::shared_ptr<Generation> generation;
+                size_t                      generationValue;
+            };
+
             //! This structure provides information about a file.
             struct InfoFuture
             {
@@ -99,7 +130,12 @@ namespace djv
             };
             
             //! Get information about a file.
-            InfoFuture getInfo(const Core::FileSystem::FileInfo&);
+            InfoFuture getInfo(
+                const Core::FileSystem::FileInfo&,
+                const RequestOptions& = RequestOptions());
+
+            //! Set the options for a pending information request.
+            void setInfoOptions(Core::UID, const RequestOptions&);
 
             //! Cancel information about a file.
             void cancelInfo(Core::UID);
@@ -117,7 +153,11 @@ namespace djv
             ImageFuture getImage(
                 const Core::FileSystem::FileInfo& path,
                 const Image::Size&                size,
-                Image::Type                       type = Image::Type::None);
+                Image::Type                       type = Image::Type::None,
+                const RequestOptions&             options = RequestOptions());
+
+            //! Set the options for a pending thumbnail image request.
+            void setImageOptions(Core::UID, const RequestOptions&);
 
             //! Cancel a thumbnail image.
             void cancelImage(Core::UID);
@@ -128,12 +168,32 @@ namespace djv
             //! Get the image cache percentage used.
             float getImageCachePercentage() const;
 
+            //! Get the number of pending information requests.
+            size_t getInfoRequestCount() const;
+
+            //! Get the number of pending thumbnail image requests.
+            size_t getImageRequestCount() const;
+
+            //! Get the total number of stale requests that have been dropped.
+            size_t getDroppedRequestCount() const;
+
+            //! Get whether handling requests is paused.
+            bool isPaused() const;
+
+            //! Set whether handling requests is paused. Pausing while a batch
+            //! of requests is made ensures they are handled in priority order.
+            void setPaused(bool);
+
             //! Clear the cache.
             void clearCache();
 
         private:
-            void _handleInfoRequests();
-            void _handleImageRequests(const std::shared_ptr<Image::Convert> &);
+            void _run();
+            IO::Info _getInfo(const Core::FileSystem::FileInfo&, std::shared_ptr<IO::IRead>&);
+            std::shared_ptr<Image::Image> _getImage(
+                const Core::FileSystem::FileInfo&,
+                const Image::Size&,
+                Image::Type);
 
             DJV_PRIVATE();
         };
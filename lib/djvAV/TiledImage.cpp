@@ -0,0 +1,463 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/TiledImage.h>
+
+#include <djvCore/Memory.h>
+#include <djvCore/UID.h>
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            namespace
+            {
+                //! The default tile cache size, the viewer replaces this with
+                //! the memory cache size from the settings.
+                const size_t tileCacheMaxDefault = 256 * Memory::megabyte;
+
+                //! The maximum number of tiles read in the background at once.
+                const size_t tileRequestMax = 4;
+
+                //! The maximum width or height of the overview.
+                const uint32_t overviewSizeMax = 1024;
+
+            } // namespace
+
+            TiledInfo::TiledInfo()
+            {}
+
+            TiledInfo::TiledInfo(uint32_t width, uint32_t height, const Size& tileSize, Type type, const Layout& layout) :
+                width(width),
+                height(height),
+                tileSize(tileSize),
+                type(type),
+                layout(layout)
+            {}
+
+            bool TiledInfo::isValid() const
+            {
+                return width > 0 && height > 0 && tileSize.w > 0 && tileSize.h > 0 && type != Type::None;
+            }
+
+            uint32_t TiledInfo::getTileColumns() const
+            {
+                return tileSize.w > 0 ? ((width + tileSize.w - 1) / tileSize.w) : 0;
+            }
+
+            uint32_t TiledInfo::getTileRows() const
+            {
+                return tileSize.h > 0 ? ((height + tileSize.h - 1) / tileSize.h) : 0;
+            }
+
+            Info TiledInfo::getTileInfo(uint32_t column, uint32_t row) const
+            {
+                const uint32_t x = column * tileSize.w;
+                const uint32_t y = row * tileSize.h;
+                Info out(
+                    static_cast<uint16_t>(x < width ? std::min(width - x, static_cast<uint32_t>(tileSize.w)) : 0),
+                    static_cast<uint16_t>(y < height ? std::min(height - y, static_cast<uint32_t>(tileSize.h)) : 0),
+                    type,
+                    layout);
+                out.name = name;
+                out.pixelAspectRatio = pixelAspectRatio;
+                return out;
+            }
+
+            bool TiledInfo::operator == (const TiledInfo& other) const
+            {
+                return
+                    other.width == width &&
+                    other.height == height &&
+                    other.tileSize == tileSize &&
+                    other.type == type &&
+                    other.layout == layout;
+            }
+
+            bool TiledInfo::operator != (const TiledInfo& other) const
+            {
+                return !(other == *this);
+            }
+
+            struct TiledImage::Private
+            {
+                UID uid = 0;
+                TiledInfo info;
+                TileReadFunction readFunction;
+                std::string pluginName;
+                Tags tags;
+
+                //! This struct provides a cached tile. The tiles are kept in
+                //! least recently used order.
+                struct Tile
+                {
+                    std::shared_ptr<Image>          image;
+                    std::list<uint64_t>::iterator   lru;
+                };
+                mutable std::mutex cacheMutex;
+                std::map<uint64_t, Tile> cache;
+                std::list<uint64_t> lru;
+                size_t cacheByteCount = 0;
+                size_t cacheMax = tileCacheMaxDefault;
+                size_t readCount = 0;
+
+                std::mutex requestMutex;
+                std::map<uint64_t, std::future<void> > requests;
+                std::vector<std::string> requestErrors;
+
+                mutable std::mutex overviewMutex;
+                std::shared_ptr<Image> overview;
+                std::shared_ptr<Image> overviewCopy;
+                std::vector<bool> overviewTiles;
+
+                uint64_t getKey(uint32_t column, uint32_t row) const
+                {
+                    return (static_cast<uint64_t>(row) << 32) | static_cast<uint64_t>(column);
+                }
+
+                void updateCache();
+                void updateRequests();
+                void updateOverview(uint32_t column, uint32_t row, const std::shared_ptr<Image>&);
+            };
+
+            void TiledImage::_init(const TiledInfo& info, const TileReadFunction& readFunction)
+            {
+                DJV_PRIVATE_PTR();
+                p.uid = createUID();
+                p.info = info;
+                p.readFunction = readFunction;
+
+                const uint32_t size = std::max(info.width, info.height);
+                if (size > overviewSizeMax)
+                {
+                    const uint32_t w = std::max(static_cast<uint32_t>(static_cast<uint64_t>(info.width) * overviewSizeMax / size), static_cast<uint32_t>(1));
+                    const uint32_t h = std::max(static_cast<uint32_t>(static_cast<uint64_t>(info.height) * overviewSizeMax / size), static_cast<uint32_t>(1));
+                    Info overviewInfo(static_cast<uint16_t>(w), static_cast<uint16_t>(h), info.type, info.layout);
+                    overviewInfo.name = info.name;
+                    overviewInfo.pixelAspectRatio = info.pixelAspectRatio;
+                    p.overview = Image::create(overviewInfo);
+                    p.overview->zero();
+                    p.overviewTiles.resize(static_cast<size_t>(info.getTileColumns()) * info.getTileRows(), false);
+                }
+            }
+
+            TiledImage::TiledImage() :
+                _p(new Private)
+            {}
+
+            TiledImage::~TiledImage()
+            {
+                DJV_PRIVATE_PTR();
+                // Wait for the background reads to finish.
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.requests.clear();
+            }
+
+            std::shared_ptr<TiledImage> TiledImage::create(const TiledInfo& info, const TileReadFunction& readFunction)
+            {
+                auto out = std::shared_ptr<TiledImage>(new TiledImage);
+                out->_init(info, readFunction);
+                return out;
+            }
+
+            UID TiledImage::getUID() const
+            {
+                return _p->uid;
+            }
+
+            const TiledInfo& TiledImage::getInfo() const
+            {
+                return _p->info;
+            }
+
+            const std::string& TiledImage::getPluginName() const
+            {
+                return _p->pluginName;
+            }
+
+            void TiledImage::setPluginName(const std::string& value)
+            {
+                _p->pluginName = value;
+            }
+
+            const Tags& TiledImage::getTags() const
+            {
+                return _p->tags;
+            }
+
+            void TiledImage::setTags(const Tags& value)
+            {
+                _p->tags = value;
+            }
+
+            std::shared_ptr<Image> TiledImage::getTile(uint32_t column, uint32_t row)
+            {
+                DJV_PRIVATE_PTR();
+                const uint64_t key = p.getKey(column, row);
+                {
+                    std::lock_guard<std::mutex> lock(p.cacheMutex);
+                    const auto i = p.cache.find(key);
+                    if (i != p.cache.end())
+                    {
+                        p.lru.splice(p.lru.begin(), p.lru, i->second.lru);
+                        return i->second.image;
+                    }
+                }
+
+                // Read the tile outside of the lock so that other tiles can
+                // be retrieved from the cache in the meantime.
+                auto image = p.readFunction(column, row);
+                if (image)
+                {
+                    std::lock_guard<std::mutex> lock(p.cacheMutex);
+                    ++p.readCount;
+                    const auto i = p.cache.find(key);
+                    if (i != p.cache.end())
+                    {
+                        // Another thread read the same tile first.
+                        return i->second.image;
+                    }
+                    p.lru.push_front(key);
+                    Private::Tile tile;
+                    tile.image = image;
+                    tile.lru = p.lru.begin();
+                    p.cache[key] = tile;
+                    p.cacheByteCount += image->getDataByteCount();
+                    p.updateCache();
+                }
+                if (image)
+                {
+                    p.updateOverview(column, row, image);
+                }
+                return image;
+            }
+
+            std::shared_ptr<Image> TiledImage::getCachedTile(uint32_t column, uint32_t row)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                const auto i = p.cache.find(p.getKey(column, row));
+                if (i != p.cache.end())
+                {
+                    p.lru.splice(p.lru.begin(), p.lru, i->second.lru);
+                    return i->second.image;
+                }
+                return nullptr;
+            }
+
+            bool TiledImage::hasTile(uint32_t column, uint32_t row) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                return p.cache.find(p.getKey(column, row)) != p.cache.end();
+            }
+
+            bool TiledImage::requestTile(uint32_t column, uint32_t row)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.updateRequests();
+                const uint64_t key = p.getKey(column, row);
+                if (p.requests.size() >= tileRequestMax ||
+                    p.requests.find(key) != p.requests.end() ||
+                    hasTile(column, row))
+                {
+                    return false;
+                }
+                p.requests[key] = std::async(
+                    std::launch::async,
+                    [this, column, row]
+                    {
+                        getTile(column, row);
+                    });
+                return true;
+            }
+
+            size_t TiledImage::getTileRequestCount()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.updateRequests();
+                return p.requests.size();
+            }
+
+            std::vector<std::string> TiledImage::getTileRequestErrors()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.updateRequests();
+                std::vector<std::string> out;
+                std::swap(out, p.requestErrors);
+                return out;
+            }
+
+            std::shared_ptr<Image> TiledImage::getOverview()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.overviewMutex);
+                if (p.overview && !p.overviewCopy)
+                {
+                    // Copy the overview so it can be drawn while more tiles
+                    // are added.
+                    p.overviewCopy = Image::create(p.overview->getInfo());
+                    memcpy(p.overviewCopy->getData(), p.overview->getData(), p.overview->getDataByteCount());
+                }
+                return p.overviewCopy;
+            }
+
+            bool TiledImage::hasOverviewTile(uint32_t column, uint32_t row) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.overviewMutex);
+                const size_t i = static_cast<size_t>(row) * p.info.getTileColumns() + column;
+                return i < p.overviewTiles.size() && p.overviewTiles[i];
+            }
+
+            size_t TiledImage::getTileCacheMax() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                return p.cacheMax;
+            }
+
+            void TiledImage::setTileCacheMax(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                p.cacheMax = value;
+                p.updateCache();
+            }
+
+            size_t TiledImage::getTileCacheByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                return p.cacheByteCount;
+            }
+
+            size_t TiledImage::getTileReadCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                return p.readCount;
+            }
+
+            void TiledImage::Private::updateCache()
+            {
+                // Always keep the most recently used tile.
+                while (cacheByteCount > cacheMax && lru.size() > 1)
+                {
+                    const auto i = cache.find(lru.back());
+                    cacheByteCount -= i->second.image->getDataByteCount();
+                    cache.erase(i);
+                    lru.pop_back();
+                }
+            }
+
+            void TiledImage::Private::updateRequests()
+            {
+                auto i = requests.begin();
+                while (i != requests.end())
+                {
+                    if (i->second.valid() &&
+                        i->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        try
+                        {
+                            i->second.get();
+                        }
+                        catch (const std::exception& e)
+                        {
+                            requestErrors.push_back(e.what());
+                        }
+                        i = requests.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+            }
+
+            void TiledImage::Private::updateOverview(uint32_t column, uint32_t row, const std::shared_ptr<Image>& tile)
+            {
+                std::lock_guard<std::mutex> lock(overviewMutex);
+                const size_t index = static_cast<size_t>(row) * info.getTileColumns() + column;
+                if (index >= overviewTiles.size() || overviewTiles[index])
+                    return;
+                overviewTiles[index] = true;
+                overviewCopy.reset();
+
+                // Sample the center of each overview pixel from the tile.
+                const uint32_t x0 = column * info.tileSize.w;
+                const uint32_t y0 = row * info.tileSize.h;
+                const uint32_t x1 = x0 + tile->getWidth();
+                const uint32_t y1 = y0 + tile->getHeight();
+                const uint32_t w = overview->getWidth();
+                const uint32_t h = overview->getHeight();
+                const size_t pixelByteCount = overview->getPixelByteCount();
+                std::vector<std::pair<uint16_t, uint16_t> > xs;
+                for (uint32_t x = 0; x < w; ++x)
+                {
+                    const uint32_t tx = static_cast<uint32_t>((2 * static_cast<uint64_t>(x) + 1) * info.width / (2 * w));
+                    if (tx >= x0 && tx < x1)
+                    {
+                        xs.push_back(std::make_pair(static_cast<uint16_t>(x), static_cast<uint16_t>(tx - x0)));
+                    }
+                }
+                for (uint32_t y = 0; y < h; ++y)
+                {
+                    const uint32_t ty = static_cast<uint32_t>((2 * static_cast<uint64_t>(y) + 1) * info.height / (2 * h));
+                    if (ty >= y0 && ty < y1)
+                    {
+                        for (const auto& x : xs)
+                        {
+                            memcpy(
+                                overview->getData(x.first, static_cast<uint16_t>(y)),
+                                tile->getData(x.second, static_cast<uint16_t>(ty - y0)),
+                                pixelByteCount);
+                        }
+                    }
+                }
+            }
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/Image.h>
+
+#include <functional>
+#include <future>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            //! This constant provides the default tile size.
+            const uint16_t tileSizeDefault = 512;
+
+            //! This class provides tiled image information. The width and
+            //! height are not limited to the range of Size so that very large
+            //! images can be represented.
+            class TiledInfo
+            {
+            public:
+                TiledInfo();
+                TiledInfo(uint32_t width, uint32_t height, const Size& tileSize, Type, const Layout& = Layout());
+
+                std::string name;
+                uint32_t    width            = 0;
+                uint32_t    height           = 0;
+                Size        tileSize         = Size(tileSizeDefault, tileSizeDefault);
+                float       pixelAspectRatio = 1.F;
+                Type        type             = Type::None;
+                Layout      layout;
+
+                bool isValid() const;
+                uint32_t getTileColumns() const;
+                uint32_t getTileRows() const;
+
+                //! Get the information for a tile. The tiles on the right and
+                //! bottom edges are clipped to the image size.
+                Info getTileInfo(uint32_t column, uint32_t row) const;
+
+                bool operator == (const TiledInfo&) const;
+                bool operator != (const TiledInfo&) const;
+            };
+
+            //! This typedef provides a function that reads a tile.
+            typedef std::function<std::shared_ptr<Image>(uint32_t column, uint32_t row)> TileReadFunction;
+
+            //! This class provides an image that is split into fixed size
+            //! tiles. The tiles are read on demand and kept in a least
+            //! recently used cache, so only the tiles that are drawn need
+            //! to be in memory. Large images also keep a downsampled
+            //! overview that is filled in as the tiles are read.
+            class TiledImage : public std::enable_shared_from_this<TiledImage>
+            {
+                DJV_NON_COPYABLE(TiledImage);
+
+            protected:
+                void _init(const TiledInfo&, const TileReadFunction&);
+                TiledImage();
+
+            public:
+                ~TiledImage();
+
+                static std::shared_ptr<TiledImage> create(const TiledInfo&, const TileReadFunction&);
+
+                Core::UID getUID() const;
+                const TiledInfo& getInfo() const;
+
+                const std::string& getPluginName() const;
+                void setPluginName(const std::string&);
+
+                const Tags& getTags() const;
+                void setTags(const Tags&);
+
+                //! Get a tile, reading it if it is not in the cache. This
+                //! function is thread safe.
+                //!
+                //! Throws:
+                //! - std::exception
+                std::shared_ptr<Image> getTile(uint32_t column, uint32_t row);
+
+                //! Get a tile if it is in the cache, without reading it. This
+                //! function is thread safe.
+                std::shared_ptr<Image> getCachedTile(uint32_t column, uint32_t row);
+
+                //! Get whether a tile is in the cache.
+                bool hasTile(uint32_t column, uint32_t row) const;
+
+                //! Read a tile in the background. Returns false if the tile is
+                //! already cached or requested, or if the maximum number of
+                //! tiles are already being read.
+                bool requestTile(uint32_t column, uint32_t row);
+
+                //! Get the number of tiles being read in the background.
+                size_t getTileRequestCount();
+
+                //! Get the errors from reading tiles in the background and
+                //! clear them.
+                std::vector<std::string> getTileRequestErrors();
+
+                //! Get the downsampled overview of the image. Tiles that have
+                //! not been read yet are black in the overview. Returns nullptr
+                //! if the image is small enough that it does not need one.
+                std::shared_ptr<Image> getOverview();
+
+                //! Get whether a tile has been added to the overview.
+                bool hasOverviewTile(uint32_t column, uint32_t row) const;
+
+                //! Get the maximum number of bytes used by cached tiles.
+                size_t getTileCacheMax() const;
+
+                //! Set the maximum number of bytes used by cached tiles. When
+                //! the cache is full the least recently used tiles are removed.
+                void setTileCacheMax(size_t);
+
+                size_t getTileCacheByteCount() const;
+                size_t getTileReadCount() const;
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvAV/IO.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! This namespace provides WAV audio I/O.
+            //!
+            //! References:
+            //! - dr_wav, https://github.com/mackron/dr_libs
+            namespace WAV
+            {
+                static const std::string pluginName = "WAV";
+                static const std::set<std::string> fileExtensions = { ".wav" };
+
+                //! The number of samples in each audio frame.
+                const size_t frameSampleCount = 4096;
+
+                //! This class provides the WAV file reader. Uncompressed files
+                //! that match an audio type are copied directly to the audio
+                //! queue, other files are converted in one pass. Seeking in
+                //! uncompressed files does not read the preceding samples.
+                class Read : public IRead
+                {
+                    DJV_NON_COPYABLE(Read);
+
+                protected:
+                    void _init(
+                        const Core::FileSystem::FileInfo&,
+                        const ReadOptions&,
+                        const std::shared_ptr<Core::ResourceSystem>&,
+                        const std::shared_ptr<Core::LogSystem>&);
+                    Read();
+
+                public:
+                    ~Read() override;
+
+                    static std::shared_ptr<Read> create(
+                        const Core::FileSystem::FileInfo&,
+                        const ReadOptions&,
+                        const std::shared_ptr<Core::ResourceSystem>&,
+                        const std::shared_ptr<Core::LogSystem>&);
+
+                    bool isRunning() const override;
+
+                    std::future<Info> getInfo() override;
+
+                    //! \param value The audio sample.
+                    void seek(int64_t value, Direction) override;
+
+                private:
+                    void _run();
+
+                    DJV_PRIVATE();
+                };
+
+                //! This class provides the WAV file I/O plugin.
+                class Plugin : public IPlugin
+                {
+                    DJV_NON_COPYABLE(Plugin);
+
+                protected:
+                    void _init(const std::shared_ptr<Core::Context>&);
+
+                    Plugin();
+
+                public:
+                    static std::shared_ptr<Plugin> create(const std::shared_ptr<Core::Context>&);
+
+                    std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
+                };
+
+            } // namespace WAV
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,406 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/WAV.h>
+
+#include <djvCore/FileIO.h>
+#include <djvCore/FileSystem.h>
+#include <djvCore/LogSystem.h>
+#include <djvCore/Speed.h>
+#include <djvCore/Time.h>
+#include <djvCore/Timer.h>
+
+#define DR_WAV_IMPLEMENTATION
+#include <dr_libs/dr_wav.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace WAV
+            {
+                namespace
+                {
+#if !defined(DJV_MMAP)
+                    size_t readCallback(void* userData, void* out, size_t byteCount)
+                    {
+                        auto io = reinterpret_cast<FileSystem::FileIO*>(userData);
+                        const size_t pos = io->getPos();
+                        const size_t size = io->getSize();
+                        const size_t count = pos < size ? std::min(byteCount, size - pos) : 0;
+                        try
+                        {
+                            io->read(out, count);
+                        }
+                        catch (const std::exception&)
+                        {
+                            return 0;
+                        }
+                        return count;
+                    }
+
+                    drwav_bool32 seekCallback(void* userData, int offset, drwav_seek_origin origin)
+                    {
+                        auto io = reinterpret_cast<FileSystem::FileIO*>(userData);
+                        const int64_t pos = static_cast<int64_t>(drwav_seek_origin_current == origin ? io->getPos() : 0) + offset;
+                        if (pos < 0 || pos > static_cast<int64_t>(io->getSize()))
+                            return DRWAV_FALSE;
+                        io->setPos(static_cast<size_t>(pos));
+                        return DRWAV_TRUE;
+                    }
+#endif // DJV_MMAP
+
+                    std::string getCodec(const drwav& wav)
+                    {
+                        std::stringstream ss;
+                        switch (wav.translatedFormatTag)
+                        {
+                        case DR_WAVE_FORMAT_PCM:        ss << "PCM";       break;
+                        case DR_WAVE_FORMAT_ADPCM:      ss << "MS ADPCM";  break;
+                        case DR_WAVE_FORMAT_IEEE_FLOAT: ss << "IEEE";      break;
+                        case DR_WAVE_FORMAT_ALAW:       ss << "A-law";     break;
+                        case DR_WAVE_FORMAT_MULAW:      ss << "Mu-law";    break;
+                        case DR_WAVE_FORMAT_DVI_ADPCM:  ss << "IMA ADPCM"; break;
+                        default: break;
+                        }
+                        ss << " " << wav.bitsPerSample;
+                        return ss.str();
+                    }
+
+                } // namespace
+
+                struct Read::Private
+                {
+                    AudioInfo audioInfo;
+                    //! WAV files have no video, so frames are converted to
+                    //! samples with the default speed like other audio files.
+                    Time::Speed speed;
+                    std::promise<Info> infoPromise;
+                    bool infoRead = false;
+                    std::condition_variable queueCV;
+                    int64_t seek = Frame::invalid;
+                    std::thread thread;
+                    std::atomic<bool> running;
+                };
+
+                void Read::_init(
+                    const FileSystem::FileInfo& fileInfo,
+                    const ReadOptions& readOptions,
+                    const std::shared_ptr<ResourceSystem>& resourceSystem,
+                    const std::shared_ptr<LogSystem>& logSystem)
+                {
+                    IRead::_init(fileInfo, readOptions, resourceSystem, logSystem);
+                    DJV_PRIVATE_PTR();
+                    // Without a thread the file information is read on demand
+                    // by getInfo().
+                    p.running = readOptions.thread;
+                    if (!readOptions.thread)
+                    {
+                        return;
+                    }
+
+                    p.thread = std::thread(
+                        [this]
+                    {
+                        _run();
+                    });
+                }
+
+                Read::Read() :
+                    _p(new Private)
+                {}
+
+                Read::~Read()
+                {
+                    DJV_PRIVATE_PTR();
+                    p.running = false;
+                    if (p.thread.joinable())
+                    {
+                        p.thread.join();
+                    }
+                }
+
+                std::shared_ptr<Read> Read::create(
+                    const FileSystem::FileInfo& fileInfo,
+                    const ReadOptions& readOptions,
+                    const std::shared_ptr<ResourceSystem>& resourceSystem,
+                    const std::shared_ptr<LogSystem>& logSystem)
+                {
+                    auto out = std::shared_ptr<Read>(new Read);
+                    out->_init(fileInfo, readOptions, resourceSystem, logSystem);
+                    return out;
+                }
+
+                bool Read::isRunning() const
+                {
+                    return _p->running;
+                }
+
+                std::future<Info> Read::getInfo()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (!_options.thread && !p.infoRead)
+                    {
+                        // Without a thread this only reads the information,
+                        // the sample loop is skipped since the reader is not
+                        // running.
+                        p.infoRead = true;
+                        _run();
+                    }
+                    return p.infoPromise.get_future();
+                }
+
+                void Read::_run()
+                {
+                    DJV_PRIVATE_PTR();
+                    FileSystem::FileIO io;
+                    drwav wav;
+                    bool wavInit = false;
+                    bool infoInit = false;
+                    try
+                    {
+                        // Open the file. When memory mapping is enabled the
+                        // samples are read directly from the mapped file.
+                        io.open(_fileInfo.getFileName(), FileSystem::FileIO::Mode::Read);
+#if defined(DJV_MMAP)
+                        wavInit = drwav_init_memory(&wav, io.mmapP(), io.getSize());
+#else // DJV_MMAP
+                        wavInit = drwav_init(&wav, readCallback, seekCallback, &io);
+#endif // DJV_MMAP
+                        if (!wavInit || 0 == wav.channels)
+                        {
+                            std::stringstream ss;
+                            ss << DJV_TEXT("error_the_file") << " '" << _fileInfo << "' " <<
+                                DJV_TEXT("error_cannot_be_opened") << ".";
+                            throw FileSystem::Error(ss.str());
+                        }
+
+                        // Get information. Uncompressed samples that match an
+                        // audio type are copied, everything else is converted
+                        // by dr_wav. WAV files are little endian.
+                        Audio::Type type = Audio::Type::S16;
+                        bool raw = false;
+                        switch (wav.translatedFormatTag)
+                        {
+                        case DR_WAVE_FORMAT_PCM:
+                            switch (wav.bitsPerSample)
+                            {
+                            case 16: raw = true; break;
+                            case 24: type = Audio::Type::S32; break;
+                            case 32: type = Audio::Type::S32; raw = true; break;
+                            default: break;
+                            }
+                            break;
+                        case DR_WAVE_FORMAT_IEEE_FLOAT:
+                            type = Audio::Type::F32;
+                            raw = 32 == wav.bitsPerSample;
+                            break;
+                        default: break;
+                        }
+                        const size_t fileChannelCount = wav.channels;
+                        uint8_t channelCount = 2;
+                        switch (fileChannelCount)
+                        {
+                        case 1:
+                        case 2:
+                        case 6:
+                        case 7:
+                        case 8: channelCount = static_cast<uint8_t>(fileChannelCount); break;
+                        default: break;
+                        }
+                        const size_t sampleCount = static_cast<size_t>(wav.totalSampleCount / fileChannelCount);
+                        p.audioInfo = AudioInfo(Audio::Info(channelCount, type, wav.sampleRate, sampleCount));
+                        p.audioInfo.codec = getCodec(wav);
+                        Info info;
+                        info.fileName = std::string(_fileInfo);
+                        info.audio.push_back(p.audioInfo);
+                        p.infoPromise.set_value(info);
+                        infoInit = true;
+
+                        const size_t byteCount = Audio::getByteCount(type);
+                        std::vector<uint8_t> extractData;
+                        while (p.running)
+                        {
+                            bool read = false;
+                            int64_t seek = Frame::invalid;
+                            {
+                                std::unique_lock<std::mutex> lock(_mutex);
+                                if (p.queueCV.wait_for(
+                                    lock,
+                                    Time::getTime(Time::TimerValue::Fast),
+                                    [this]
+                                {
+                                    DJV_PRIVATE_PTR();
+                                    const bool audio = !_audioQueue.isFinished() && _audioQueue.getCount() < _audioQueue.getMax();
+                                    return audio || p.seek != Frame::invalid;
+                                }))
+                                {
+                                    read = true;
+                                    if (p.seek != Frame::invalid)
+                                    {
+                                        seek = p.seek;
+                                        p.seek = Frame::invalid;
+                                        _audioQueue.setFinished(false);
+                                        _audioQueue.clearFrames();
+                                    }
+                                }
+                            }
+
+                            if (seek != Frame::invalid)
+                            {
+                                // Seeking uncompressed data only moves the read
+                                // position. The seek value is a frame.
+                                const drwav_uint64 sample = static_cast<drwav_uint64>(Math::clamp(
+                                    Time::scale(
+                                        seek,
+                                        p.speed.swap(),
+                                        Math::Rational(1, static_cast<int>(wav.sampleRate))),
+                                    static_cast<int64_t>(0),
+                                    static_cast<int64_t>(sampleCount)));
+                                drwav_seek_to_sample(&wav, sample * fileChannelCount);
+                            }
+
+                            if (read)
+                            {
+                                auto data = Audio::Data::create(Audio::Info(channelCount, type, wav.sampleRate, frameSampleCount));
+                                uint8_t* dataP = data->getData();
+                                if (channelCount != fileChannelCount)
+                                {
+                                    extractData.resize(frameSampleCount * fileChannelCount * byteCount);
+                                    dataP = extractData.data();
+                                }
+                                const drwav_uint64 count = frameSampleCount * fileChannelCount;
+                                drwav_uint64 r = 0;
+                                if (raw)
+                                {
+                                    r = drwav_read(&wav, count, dataP);
+                                }
+                                else
+                                {
+                                    switch (type)
+                                    {
+                                    case Audio::Type::S16: r = drwav_read_s16(&wav, count, reinterpret_cast<drwav_int16*>(dataP)); break;
+                                    case Audio::Type::S32: r = drwav_read_s32(&wav, count, reinterpret_cast<drwav_int32*>(dataP)); break;
+                                    case Audio::Type::F32: r = drwav_read_f32(&wav, count, reinterpret_cast<float*>(dataP)); break;
+                                    default: break;
+                                    }
+                                }
+                                const size_t readSampleCount = static_cast<size_t>(r / fileChannelCount);
+                                if (channelCount != fileChannelCount)
+                                {
+                                    switch (type)
+                                    {
+                                    case Audio::Type::S16:
+                                        Audio::Data::extract(
+                                            reinterpret_cast<const Audio::S16_T*>(dataP),
+                                            reinterpret_cast<Audio::S16_T*>(data->getData()),
+                                            readSampleCount,
+                                            fileChannelCount,
+                                            channelCount);
+                                        break;
+                                    case Audio::Type::S32:
+                                        Audio::Data::extract(
+                                            reinterpret_cast<const Audio::S32_T*>(dataP),
+                                            reinterpret_cast<Audio::S32_T*>(data->getData()),
+                                            readSampleCount,
+                                            fileChannelCount,
+                                            channelCount);
+                                        break;
+                                    case Audio::Type::F32:
+                                        Audio::Data::extract(
+                                            reinterpret_cast<const Audio::F32_T*>(dataP),
+                                            reinterpret_cast<Audio::F32_T*>(data->getData()),
+                                            readSampleCount,
+                                            fileChannelCount,
+                                            channelCount);
+                                        break;
+                                    default: break;
+                                    }
+                                }
+                                if (readSampleCount > 0 && readSampleCount < frameSampleCount)
+                                {
+                                    auto tmp = Audio::Data::create(Audio::Info(channelCount, type, wav.sampleRate, readSampleCount));
+                                    memcpy(tmp->getData(), data->getData(), tmp->getByteCount());
+                                    data = tmp;
+                                }
+
+                                std::lock_guard<std::mutex> lock(_mutex);
+                                if (Frame::invalid == p.seek)
+                                {
+                                    if (readSampleCount > 0)
+                                    {
+                                        _audioQueue.addFrame(AudioFrame(data));
+                                    }
+                                    if (readSampleCount < frameSampleCount)
+                                    {
+                                        _audioQueue.setFinished(true);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        if (!infoInit)
+                        {
+                            p.infoPromise.set_value(Info());
+                        }
+                        _logSystem->log("djv::AV::IO::WAV::Read", e.what(), LogLevel::Error);
+                    }
+                    if (wavInit)
+                    {
+                        drwav_uninit(&wav);
+                    }
+                }
+
+                void Read::seek(int64_t value, Direction)
+                {
+                    DJV_PRIVATE_PTR();
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _audioQueue.clearFrames();
+                        _audioQueue.setFinished(false);
+                        p.seek = value;
+                    }
+                    p.queueCV.notify_one();
+                }
+
+            } // namespace WAV
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,522 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/WaveformSystem.h>
+
+#include <djvAV/AudioWaveform.h>
+#include <djvAV/IO.h>
+
+#include <djvCore/Context.h>
+#include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
+#include <djvCore/LogSystem.h>
+#include <djvCore/Memory.h>
+#include <djvCore/ResourceSystem.h>
+#include <djvCore/Timer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            //! \todo Should these be configurable?
+            const size_t cacheMax        = 100;
+            const size_t cacheByteMax    = 64 * Memory::megabyte;
+
+            //! The disk cache file header.
+            const char     diskCacheMagic[]  = "DJVW";
+            const uint32_t diskCacheVersion  = 1;
+
+            struct Request
+            {
+                Request() :
+                    uid(createUID())
+                {}
+
+                Request(Request&& other) noexcept :
+                    uid(other.uid),
+                    fileInfo(other.fileInfo),
+                    promise(std::move(other.promise))
+                {}
+
+                ~Request()
+                {}
+
+                Request& operator = (Request&& other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        uid = other.uid;
+                        fileInfo = other.fileInfo;
+                        promise = std::move(other.promise);
+                    }
+                    return *this;
+                }
+
+                UID uid = 0;
+                FileSystem::FileInfo fileInfo;
+                std::promise<std::shared_ptr<Audio::Waveform> > promise;
+            };
+
+            //! The file size and modification time are part of the key so the
+            //! waveform is rebuilt when the file changes.
+            std::string getCacheKey(const FileSystem::FileInfo& fileInfo)
+            {
+                const FileSystem::FileInfo stat(fileInfo.getPath());
+                std::stringstream ss;
+                ss << fileInfo.getFileName() << "_" << stat.getSize() << "_" << stat.getTime();
+                return ss.str();
+            }
+
+            std::string getDiskCacheFileName(const FileSystem::Path& path, const std::string& key)
+            {
+                std::stringstream ss;
+                ss << std::hex << std::setw(16) << std::setfill('0') << Memory::getStableHash(key);
+                return std::string(FileSystem::Path(path, ss.str() + ".djvw"));
+            }
+
+            //! The key is stored in the file header so that a hash collision or
+            //! a stale file is not mistaken for the waveform.
+            std::shared_ptr<Audio::Waveform> readDiskCache(const std::string& fileName, const std::string& key)
+            {
+                std::shared_ptr<Audio::Waveform> out;
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Read);
+                char magic[4] = { 0, 0, 0, 0 };
+                io.read(magic, 4);
+                uint32_t version = 0;
+                io.readU32(&version);
+                uint32_t size = 0;
+                io.readU32(&size);
+                std::string fileKey;
+                if (0 == memcmp(magic, diskCacheMagic, 4) &&
+                    diskCacheVersion == version &&
+                    size == key.size())
+                {
+                    fileKey.resize(size);
+                    io.read(&fileKey[0], size);
+                }
+                if (fileKey == key)
+                {
+                    out = Audio::Waveform::read(io);
+                }
+                return out;
+            }
+
+            void writeDiskCache(const std::string& fileName, const std::string& key, const std::shared_ptr<Audio::Waveform>& value)
+            {
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Write);
+                io.write(diskCacheMagic, 4);
+                io.writeU32(diskCacheVersion);
+                io.writeU32(static_cast<uint32_t>(key.size()));
+                io.write(key);
+                value->write(io);
+            }
+
+        } // namespace
+
+        WaveformSystem::WaveformFuture::WaveformFuture()
+        {}
+
+        WaveformSystem::WaveformFuture::WaveformFuture(std::future<std::shared_ptr<Audio::Waveform> >& future, UID uid) :
+            future(std::move(future)),
+            uid(uid)
+        {}
+
+        struct WaveformSystem::Private
+        {
+            std::shared_ptr<IO::System> io;
+            FileSystem::Path diskCachePath;
+            std::atomic<bool> diskCache;
+
+            std::map<UID, Request> requests;
+            UID currentUID = 0;
+            std::atomic<bool> cancel;
+            std::condition_variable requestCV;
+            mutable std::mutex requestMutex;
+
+            //! This struct provides a cached waveform. A null waveform records
+            //! a file without audio. The waveforms are kept in least recently
+            //! used order.
+            struct CacheItem
+            {
+                std::shared_ptr<Audio::Waveform> waveform;
+                size_t byteCount = 0;
+                std::list<std::string>::iterator lru;
+            };
+            std::map<std::string, CacheItem> cache;
+            std::list<std::string> cacheLRU;
+            size_t cacheByteCount = 0;
+            std::atomic<float> cachePercentage;
+            std::mutex cacheMutex;
+
+            void cacheAdd(const std::string& key, const std::shared_ptr<Audio::Waveform>&);
+            std::shared_ptr<ValueObserver<bool> > ioOptionsObserver;
+
+            std::thread thread;
+            std::atomic<bool> running;
+        };
+
+        void WaveformSystem::Private::cacheAdd(const std::string& key, const std::shared_ptr<Audio::Waveform>& value)
+        {
+            const auto i = cache.find(key);
+            if (i != cache.end())
+            {
+                cacheByteCount -= i->second.byteCount;
+                cacheLRU.erase(i->second.lru);
+                cache.erase(i);
+            }
+            CacheItem item;
+            item.waveform = value;
+            item.byteCount = value ? value->getByteCount() : 0;
+            item.lru = cacheLRU.insert(cacheLRU.end(), key);
+            cache[key] = item;
+            cacheByteCount += item.byteCount;
+            while ((cache.size() > cacheMax || cacheByteCount > cacheByteMax) && cacheLRU.size() > 1)
+            {
+                const auto j = cache.find(cacheLRU.front());
+                cacheByteCount -= j->second.byteCount;
+                cache.erase(j);
+                cacheLRU.pop_front();
+            }
+            cachePercentage = std::max(
+                cache.size() / static_cast<float>(cacheMax),
+                cacheByteCount / static_cast<float>(cacheByteMax)) * 100.F;
+        }
+
+        void WaveformSystem::_init(const std::shared_ptr<Core::Context>& context)
+        {
+            ISystem::_init("djv::AV::WaveformSystem", context);
+
+            DJV_PRIVATE_PTR();
+
+            auto io = context->getSystemT<IO::System>();
+            addDependency(io);
+
+            p.io = io;
+            p.diskCachePath = FileSystem::Path(
+                _getResourceSystem()->getPath(FileSystem::ResourcePath::Documents),
+                "WaveformCache");
+            p.diskCache = false;
+            p.cancel = false;
+            p.cachePercentage = 0.F;
+
+            // Decoding a whole file is expensive, so the requests are handled
+            // one at a time.
+            p.running = true;
+            p.thread = std::thread(
+                [this]
+                {
+                    _run();
+                });
+
+            auto weak = std::weak_ptr<WaveformSystem>(std::dynamic_pointer_cast<WaveformSystem>(shared_from_this()));
+            p.ioOptionsObserver = ValueObserver<bool>::create(
+                io->observeOptionsChanged(),
+                [weak](bool)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->clearCache();
+                    }
+                });
+        }
+
+        WaveformSystem::WaveformSystem() :
+            _p(new Private)
+        {}
+
+        WaveformSystem::~WaveformSystem()
+        {
+            DJV_PRIVATE_PTR();
+            p.running = false;
+            p.requestCV.notify_all();
+            if (p.thread.joinable())
+            {
+                p.thread.join();
+            }
+        }
+
+        std::shared_ptr<WaveformSystem> WaveformSystem::create(const std::shared_ptr<Core::Context>& context)
+        {
+            auto out = std::shared_ptr<WaveformSystem>(new WaveformSystem);
+            out->_init(context);
+            return out;
+        }
+
+        WaveformSystem::WaveformFuture WaveformSystem::getWaveform(const FileSystem::FileInfo& fileInfo)
+        {
+            DJV_PRIVATE_PTR();
+            Request request;
+            request.fileInfo = fileInfo;
+            auto future = request.promise.get_future();
+            const UID uid = request.uid;
+            {
+                std::unique_lock<std::mutex> lock(p.requestMutex);
+                p.requests.insert(std::make_pair(uid, std::move(request)));
+            }
+            p.requestCV.notify_one();
+            return WaveformFuture(future, uid);
+        }
+
+        void WaveformSystem::cancelWaveform(UID uid)
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            p.requests.erase(uid);
+            if (uid == p.currentUID)
+            {
+                p.cancel = true;
+            }
+        }
+
+        bool WaveformSystem::hasDiskCache() const
+        {
+            return _p->diskCache;
+        }
+
+        void WaveformSystem::setDiskCache(bool value)
+        {
+            _p->diskCache = value;
+        }
+
+        float WaveformSystem::getCachePercentage() const
+        {
+            return _p->cachePercentage;
+        }
+
+        size_t WaveformSystem::getRequestCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.requests.size();
+        }
+
+        void WaveformSystem::clearCache()
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.cacheMutex);
+            p.cache.clear();
+            p.cacheLRU.clear();
+            p.cacheByteCount = 0;
+            p.cachePercentage = 0.F;
+        }
+
+        void WaveformSystem::_run()
+        {
+            DJV_PRIVATE_PTR();
+            const auto timeout = Time::getValue(Time::TimerValue::Medium);
+            while (p.running)
+            {
+                Request request;
+                bool hasRequest = false;
+                {
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    if (p.requestCV.wait_for(
+                        lock,
+                        std::chrono::milliseconds(timeout),
+                        [this]
+                    {
+                        DJV_PRIVATE_PTR();
+                        return p.requests.size() || !p.running;
+                    }))
+                    {
+                        if (p.requests.size())
+                        {
+                            auto i = p.requests.begin();
+                            request = std::move(i->second);
+                            p.requests.erase(i);
+                            p.currentUID = request.uid;
+                            p.cancel = false;
+                            hasRequest = true;
+                        }
+                    }
+                }
+
+                if (hasRequest)
+                {
+                    try
+                    {
+                        request.promise.set_value(_getWaveform(request.fileInfo));
+                    }
+                    catch (const std::exception&)
+                    {
+                        try
+                        {
+                            request.promise.set_exception(std::current_exception());
+                        }
+                        catch (const std::exception& e)
+                        {
+                            _log(e.what(), LogLevel::Error);
+                        }
+                    }
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    p.currentUID = 0;
+                }
+            }
+        }
+
+        std::shared_ptr<Audio::Waveform> WaveformSystem::_getWaveform(const FileSystem::FileInfo& fileInfo)
+        {
+            DJV_PRIVATE_PTR();
+            const auto key = getCacheKey(fileInfo);
+            {
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                const auto i = p.cache.find(key);
+                if (i != p.cache.end())
+                {
+                    p.cacheLRU.splice(p.cacheLRU.end(), p.cacheLRU, i->second.lru);
+                    return i->second.waveform;
+                }
+            }
+            std::shared_ptr<Audio::Waveform> out;
+
+            // Check the disk cache.
+            const bool diskCache = p.diskCache;
+            std::string diskCacheFileName;
+            if (diskCache)
+            {
+                diskCacheFileName = getDiskCacheFileName(p.diskCachePath, key);
+                if (FileSystem::FileInfo(diskCacheFileName).doesExist())
+                {
+                    try
+                    {
+                        out = readDiskCache(diskCacheFileName, key);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _log(e.what(), LogLevel::Warning);
+                    }
+                }
+            }
+
+            // Stream the audio through a reader. Only the audio is decoded.
+            if (!out)
+            {
+                const auto time = std::chrono::steady_clock::now();
+                IO::ReadOptions options;
+                options.video = false;
+                auto read = p.io->read(fileInfo, options);
+                const auto info = read->getInfo().get();
+                if (0 == info.audio.size())
+                {
+                    std::lock_guard<std::mutex> lock(p.cacheMutex);
+                    p.cacheAdd(key, nullptr);
+                    return nullptr;
+                }
+                const auto& audioInfo = info.audio[0].info;
+                out = Audio::Waveform::create(audioInfo.channelCount, audioInfo.sampleRate);
+                bool running = true;
+                while (running)
+                {
+                    if (!p.running || p.cancel)
+                    {
+                        return nullptr;
+                    }
+                    std::shared_ptr<Audio::Data> data;
+                    bool sleep = false;
+                    {
+                        std::lock_guard<std::mutex> lock(read->getMutex());
+                        auto& videoQueue = read->getVideoQueue();
+                        while (!videoQueue.isEmpty())
+                        {
+                            videoQueue.popFrame();
+                        }
+                        auto& audioQueue = read->getAudioQueue();
+                        if (!audioQueue.isEmpty())
+                        {
+                            data = audioQueue.popFrame().audio;
+                        }
+                        else if (audioQueue.isFinished())
+                        {
+                            running = false;
+                        }
+                        else
+                        {
+                            sleep = true;
+                        }
+                    }
+                    if (data)
+                    {
+                        out->add(data);
+                    }
+                    else if (sleep)
+                    {
+                        std::this_thread::sleep_for(Time::getTime(Time::TimerValue::VeryFast));
+                    }
+                }
+                out->finish();
+                {
+                    std::stringstream ss;
+                    ss << fileInfo << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - time).count() << "ms";
+                    _log(ss.str());
+                }
+
+                if (diskCache)
+                {
+                    try
+                    {
+                        if (!FileSystem::FileInfo(p.diskCachePath).doesExist())
+                        {
+                            FileSystem::Path::mkdir(p.diskCachePath);
+                        }
+                        writeDiskCache(diskCacheFileName, key, out);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _log(e.what(), LogLevel::Warning);
+                    }
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                p.cacheAdd(key, out);
+            }
+            return out;
+        }
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <djvCore/ISystem.h>
+#include <djvCore/UID.h>
+
+#include <future>
+
+namespace djv
+{
+    namespace Core
+    {
+        namespace FileSystem
+        {
+            class FileInfo;
+
+        } // namespace FileSystem
+    } // namespace Core
+
+    namespace AV
+    {
+        namespace Audio
+        {
+            class Waveform;
+
+        } // namespace Audio
+
+        //! This class provides a system for generating audio waveform
+        //! overviews.
+        //!
+        //! Requests are handled by a worker thread that streams the audio of
+        //! the whole file through a reader and summarizes it with an
+        //! Audio::Waveform. The results are cached in memory, bounded by count
+        //! and bytes, and optionally on disk keyed by the file name, size, and
+        //! modification time. Files without audio are also cached so they are
+        //! not decoded again.
+        class WaveformSystem : public Core::ISystem
+        {
+            DJV_NON_COPYABLE(WaveformSystem);
+
+        protected:
+            void _init(const std::shared_ptr<Core::Context>&);
+            WaveformSystem();
+
+        public:
+            ~WaveformSystem() override;
+
+            //! Create a new waveform system.
+            static std::shared_ptr<WaveformSystem> create(const std::shared_ptr<Core::Context>&);
+
+            //! This structure provides a waveform for a file.
+            struct WaveformFuture
+            {
+                WaveformFuture();
+                WaveformFuture(std::future<std::shared_ptr<Audio::Waveform> >&, Core::UID);
+                std::future<std::shared_ptr<Audio::Waveform> > future;
+                Core::UID uid = 0;
+            };
+
+            //! Get a waveform for the given file. The result is null if the file
+            //! has no audio.
+            WaveformFuture getWaveform(const Core::FileSystem::FileInfo&);
+
+            //! Cancel a waveform.
+            void cancelWaveform(Core::UID);
+
+            //! Get whether waveforms are cached on disk.
+            bool hasDiskCache() const;
+
+            //! Set whether waveforms are cached on disk.
+            void setDiskCache(bool);
+
+            //! Get the cache percentage used.
+            float getCachePercentage() const;
+
+            //! Get the number of pending waveform requests.
+            size_t getRequestCount() const;
+
+            //! Clear the memory cache.
+            void clearCache();
+
+        private:
+            void _run();
+            std::shared_ptr<Audio::Waveform> _getWaveform(const Core::FileSystem::FileInfo&);
+
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -53,6 +53,67 @@ namespace djv
                 return data[in];
             }
 
+            FileNameTemplate::FileNameTemplate()
+            {}
+
+            FileNameTemplate::FileNameTemplate(
+                const std::string& prefix,
+                const std::string& number,
+                const std::string& suffix,
+                bool               sequence,
+                size_t             pad) :
+                _prefix(prefix),
+                _number(number),
+                _suffix(suffix),
+                _sequence(sequence),
+                _pad(pad)
+            {}
+
+            const std::string& FileNameTemplate::format(Frame::Number frame, std::string& out) const
+            {
+                out.clear();
+                out.append(_prefix);
+                if (_sequence && frame != Frame::invalid)
+                {
+                    const bool negative = frame < 0;
+                    const uint64_t abs = negative ? -frame : frame;
+                    char c[String::cStringLength] = "";
+                    const size_t length = String::intToString(abs, c);
+                    if (negative)
+                    {
+                        out.push_back('-');
+                    }
+                    if (_pad > length)
+                    {
+                        out.append(_pad - length, '0');
+                    }
+                    out.append(c, length);
+                }
+                else
+                {
+                    out.append(_number);
+                }
+                out.append(_suffix);
+                return out;
+            }
+
+            std::string FileNameTemplate::get(Frame::Number frame) const
+            {
+                std::string out;
+                out.reserve(_prefix.size() + _number.size() + _suffix.size());
+                format(frame, out);
+                return out;
+            }
+
+            void FileNameTemplate::get(const std::vector<Frame::Number>& frames, std::vector<std::string>& out) const
+            {
+                out.resize(frames.size());
+                for (size_t i = 0; i < frames.size(); ++i)
+                {
+                    format(frames[i], out[i]);
+                }
+            }
+
             std::string FileInfo::getFileName(Frame::Number frame, bool path) const
             {
                 std::stringstream ss;
@@ -68,11 +129,11 @@ namespace djv
                         ss << _path.getDirectoryName();
                     }
                     ss << _path.getBaseName();
-                    if (FileType::Sequence == _type && _sequence.ranges.size() && frame != Frame::invalid)
+                    if (FileType::Sequence == _type && _sequence.getRanges().size() && frame != Frame::invalid)
                     {
-                        ss << Frame::toString(frame, _sequence.pad);
+                        ss << Frame::toString(frame, _sequence.getPad());
                     }
-                    else if (FileType::Sequence == _type && _sequence.ranges.size())
+                    else if (FileType::Sequence == _type && _sequence.getRanges().size())
                     {
                         ss << _sequence;
                     }
@@ -85,6 +146,38 @@ namespace djv
                 return ss.str();
             }
 
+            FileNameTemplate FileInfo::getFileNameTemplate(bool path) const
+            {
+                std::string prefix;
+                std::string number;
+                std::string suffix;
+                bool sequence = false;
+                const bool isRoot = std::string(1, Path::getCurrentSeparator()) == _path.get();
+                if (isRoot)
+                {
+                    prefix = _path.get();
+                }
+                else
+                {
+                    if (path)
+                    {
+                        prefix = _path.getDirectoryName();
+                    }
+                    prefix += _path.getBaseName();
+                    if (FileType::Sequence == _type && _sequence.getRanges().size())
+                    {
+                        sequence = true;
+                        number = Frame::toString(_sequence);
+                    }
+                    else
+                    {
+                        number = _path.getNumber();
+                    }
+                    suffix = _path.getExtension();
+                }
+                return FileNameTemplate(prefix, number, suffix, sequence, _sequence.getPad());
+            }
+
             void FileInfo::setPath(const Path& value, bool stat)
             {
                 _path           = value;
@@ -152,7 +245,7 @@ namespace djv
                         std::stringstream ss(_path.getNumber());
                         ss.exceptions(std::istream::failbit | std::istream::badbit);
                         ss >> _sequence;
-                        if (_sequence.ranges.size())
+                        if (_sequence.getRanges().size())
                         {
                             _type = FileType::Sequence;
                         }
@@ -34,6 +34,7 @@
 #include <djvCore/PicoJSON.h>
 
 #include <set>
+#include <vector>
 
 #include <sys/types.h>
 
@@ -96,6 +97,40 @@ namespace djv
                 std::string                 filter;
             };
 
+            //! This class provides a template for formatting the file names of a
+            //! file sequence. The path is split once so that formatting a file
+            //! name only appends the frame number.
+            class FileNameTemplate
+            {
+            public:
+                FileNameTemplate();
+                FileNameTemplate(
+                    const std::string& prefix,
+                    const std::string& number,
+                    const std::string& suffix,
+                    bool               sequence,
+                    size_t             pad);
+
+                //! Format the file name for the given frame into the buffer. The
+                //! buffer is not re-allocated when it has enough capacity.
+                //! \param frame Specify a frame number or -1 for the entire sequence.
+                const std::string& format(Frame::Number frame, std::string& buffer) const;
+
+                //! Get the file name for the given frame.
+                std::string get(Frame::Number frame = Frame::invalid) const;
+
+                //! Get the file names for the given frames. The strings in the list
+                //! are re-used.
+                void get(const std::vector<Frame::Number>&, std::vector<std::string>&) const;
+
+            private:
+                std::string _prefix;
+                std::string _number;
+                std::string _suffix;
+                bool        _sequence = false;
+                size_t      _pad      = 0;
+            };
+
             //! This class provides information about files and file sequences.
             //!
             //! A file sequence is a list of file names that share a common name and
@@ -134,6 +169,10 @@ namespace djv
                 //! \param path Include the path in the file name.
                 std::string getFileName(Frame::Number frame = Frame::invalid, bool path = true) const;
 
+                //! Get a template for formatting the file names of a sequence.
+                //! \param path Include the path in the file names.
+                FileNameTemplate getFileNameTemplate(bool path = true) const;
+
                 //! Get whether this file exists.
                 bool doesExist() const;
 
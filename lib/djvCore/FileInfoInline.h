@@ -101,7 +101,7 @@ namespace djv
                 return
                     _type != FileType::Directory &&
                     !_path.getNumber().empty() &&
-                    _sequence.ranges.size();
+                    _sequence.getRanges().size();
             }
 
             inline bool FileInfo::isSequenceWildcard() const
@@ -126,16 +126,16 @@ namespace djv
             {
                 if (isCompatible(value))
                 {
-                    for (const auto& range : value._sequence.ranges)
+                    for (const auto& range : value._sequence.getRanges())
                     {
                         if (!_sequence.merge(range))
                         {
-                            _sequence.ranges.push_back(range);
+                            _sequence.add(range);
                         }
                     }
-                    if (value._sequence.pad > _sequence.pad)
+                    if (value._sequence.getPad() > _sequence.getPad())
                     {
-                        _sequence.pad = value._sequence.pad;
+                        _sequence.setPad(value._sequence.getPad());
                     }
                     _size += value._size;
                     if (value._user > _user)
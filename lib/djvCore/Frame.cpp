@@ -42,47 +42,48 @@ namespace djv
         {
             void Sequence::sort()
             {
-                for (auto & range : ranges)
+                for (auto & range : _ranges)
                 {
                     Frame::sort(range);
                 }
 
-                std::sort(ranges.begin(), ranges.end());
+                std::sort(_ranges.begin(), _ranges.end());
 
-                if (ranges.size())
+                if (_ranges.size())
                 {
                     std::vector<Range> tmp;
-                    tmp.push_back(ranges[0]);
-                    for (size_t i = 1; i < ranges.size(); ++i)
+                    tmp.push_back(_ranges[0]);
+                    for (size_t i = 1; i < _ranges.size(); ++i)
                     {
                         const size_t tmpSize = tmp.size();
                         size_t j = 0;
                         for (; j < tmpSize; ++j)
                         {
-                            if (ranges[i].min == tmp[j].max + 1)
+                            if (_ranges[i].min == tmp[j].max + 1)
                             {
-                                tmp[j].max = ranges[i].max;
+                                tmp[j].max = _ranges[i].max;
                                 break;
                             }
-                            else if (ranges[i].intersects(tmp[j]))
+                            else if (_ranges[i].intersects(tmp[j]))
                             {
-                                tmp[j].expand(ranges[i]);
+                                tmp[j].expand(_ranges[i]);
                                 break;
                             }
                         }
                         if (tmpSize == j)
                         {
-                            tmp.push_back(ranges[i]);
+                            tmp.push_back(_ranges[i]);
                         }
                     }
-                    ranges = tmp;
+                    _ranges = tmp;
                 }
+                _update();
             }
             
             bool Sequence::merge(const Range& value)
             {
                 bool out = false;
-                for (auto& i : ranges)
+                for (auto& i : _ranges)
                 {
                     if (i.intersects(value))
                     {
@@ -104,6 +105,57 @@ namespace djv
                         break;
                     }
                 }
+                if (out)
+                {
+                    _update();
+                }
+                return out;
+            }
+
+            void Sequence::_update()
+            {
+                const std::vector<Range> ranges = std::move(_ranges);
+                _ranges.clear();
+                _offsets.clear();
+                _size = 0;
+                _sorted = true;
+                _ranges.reserve(ranges.size());
+                _offsets.reserve(ranges.size());
+                for (const auto& i : ranges)
+                {
+                    add(i);
+                }
+            }
+
+            Index Sequence::_findRange(Number value) const
+            {
+                Index out = invalidIndex;
+                if (_sorted)
+                {
+                    const auto i = std::lower_bound(
+                        _ranges.begin(),
+                        _ranges.end(),
+                        value,
+                        [](const Range& range, Number value)
+                        {
+                            return range.max < value;
+                        });
+                    if (i != _ranges.end() && i->contains(value))
+                    {
+                        out = i - _ranges.begin();
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < _ranges.size(); ++i)
+                    {
+                        if (_ranges[i].contains(value))
+                        {
+                            out = i;
+                            break;
+                        }
+                    }
+                }
                 return out;
             }
 
@@ -128,17 +180,17 @@ namespace djv
                     {
                         if (frames[i] != prevFrame + 1)
                         {
-                            out.ranges.push_back(Range(rangeStart, prevFrame));
+                            out.add(Range(rangeStart, prevFrame));
                             rangeStart = frames[i];
                         }
                     }
                     if (size > 1)
                     {
-                        out.ranges.push_back(Range(rangeStart, prevFrame));
+                        out.add(Range(rangeStart, prevFrame));
                     }
                     else
                     {
-                        out.ranges.push_back(Range(rangeStart));
+                        out.add(Range(rangeStart));
                     }
                 }
                 return out;
@@ -150,9 +202,9 @@ namespace djv
     std::ostream & operator << (std::ostream & s, const Core::Frame::Sequence & value)
     {
         std::vector<std::string> pieces;
-        for (const auto & range : value.ranges)
+        for (const auto & range : value.getRanges())
         {
-            pieces.push_back(Core::Frame::toString(range, value.pad));
+            pieces.push_back(Core::Frame::toString(range, value.getPad()));
         }
         s << Core::String::join(pieces, ',');
         return s;
@@ -174,8 +226,8 @@ namespace djv
         {
             Core::Frame::Range range;
             Core::Frame::fromString(piece, range, pad);
-            out.ranges.push_back(range);
-            out.pad = std::max(pad, out.pad);
+            out.add(range);
+            out.setPad(std::max(pad, out.getPad()));
         }
         return s;
     }
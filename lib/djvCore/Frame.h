@@ -58,6 +58,10 @@ namespace djv
             
             //! This class provides a sequence of frame numbers. A sequence is
             //! composed of multiple frame number ranges (e.g., 1-10,20-30).
+            //!
+            //! The index of the first frame in each range is cached so that
+            //! converting between frame indices and frame numbers is a binary
+            //! search.
             class Sequence
             {
             public:
@@ -67,8 +71,13 @@ namespace djv
                 explicit Sequence(const Range& range, size_t pad = 0);
                 explicit Sequence(const std::vector<Range>& ranges, size_t pad = 0);
 
-                std::vector<Range> ranges;
-                size_t pad = 0;
+                const std::vector<Range>& getRanges() const;
+                void setRanges(const std::vector<Range>&);
+                size_t getPad() const;
+                void setPad(size_t);
+
+                //! Add a range to the end of the sequence.
+                void add(const Range&);
 
                 bool isValid() const;
                 bool contains(Index) const;
@@ -88,6 +97,16 @@ namespace djv
 
                 bool operator == (const Sequence&) const;
                 bool operator != (const Sequence&) const;
+
+            private:
+                void _update();
+                Index _findRange(Number) const;
+
+                std::vector<Range> _ranges;
+                size_t _pad = 0;
+                std::vector<Index> _offsets;
+                size_t _size = 0;
+                bool _sorted = true;
             };
 
             //! \name Utilities
@@ -29,6 +29,8 @@
 
 #include <djvCore/Math.h>
 
+#include <algorithm>
+
 namespace djv
 {
     namespace Core
@@ -50,74 +52,84 @@ namespace djv
        
             inline Sequence::Sequence(Number number)
             {
-                ranges.push_back(Range(number));
+                add(Range(number));
             }
        
             inline Sequence::Sequence(Number min, Number max, size_t pad) :
-                pad(pad)
+                _pad(pad)
             {
-                ranges.push_back(Range(min, max));
+                add(Range(min, max));
             }
 
             inline Sequence::Sequence(const Range & range, size_t pad) :
-                pad(pad)
+                _pad(pad)
             {
-                ranges.push_back(range);
+                add(range);
             }
 
             inline Sequence::Sequence(const std::vector<Range> & ranges, size_t pad) :
-                ranges(ranges),
-                pad(pad)
-            {}
+                _ranges(ranges),
+                _pad(pad)
+            {
+                _update();
+            }
 
-            inline bool Sequence::isValid() const
+            inline const std::vector<Range>& Sequence::getRanges() const
             {
-                return ranges.size() > 0;
+                return _ranges;
             }
 
-            inline bool Sequence::contains(Index value) const
+            inline void Sequence::setRanges(const std::vector<Range>& value)
             {
-                bool out = false;
-                for (const auto& i : ranges)
+                _ranges = value;
+                _update();
+            }
+
+            inline size_t Sequence::getPad() const
+            {
+                return _pad;
+            }
+
+            inline void Sequence::setPad(size_t value)
+            {
+                _pad = value;
+            }
+
+            inline void Sequence::add(const Range& value)
+            {
+                // Ranges that are reversed, overlapping, or out of order fall
+                // back to a linear search for frame numbers.
+                if (value.min > value.max || (_ranges.size() && value.min <= _ranges.back().max))
                 {
-                    if (i.contains(value))
-                    {
-                        out = true;
-                        break;
-                    }
+                    _sorted = false;
                 }
-                return out;
+                _ranges.push_back(value);
+                _offsets.push_back(_size);
+                _size += (value.min < value.max ? (value.max - value.min) : (value.min - value.max)) + 1;
+            }
+
+            inline bool Sequence::isValid() const
+            {
+                return _ranges.size() > 0;
+            }
+
+            inline bool Sequence::contains(Index value) const
+            {
+                return _findRange(value) != invalidIndex;
             }
 
             inline size_t Sequence::getSize() const
             {
-                size_t out = 0;
-                for (const auto& i : ranges)
-                {
-                    if (i.min < i.max)
-                    {
-                        out += i.max - i.min + 1;
-                    }
-                    else
-                    {
-                        out += i.min - i.max + 1;
-                    }
-                }
-                return out;
+                return _size;
             }
 
             inline Number Sequence::getFrame(Index value) const
             {
                 Number out = invalid;
-                for (const auto& j : ranges)
+                if (value >= 0 && value < static_cast<Index>(_size))
                 {
-                    const size_t size = j.max - j.min + 1;
-                    if (value < size)
-                    {
-                        out = j.min + value;
-                        break;
-                    }
-                    value -= size;
+                    const auto i = std::upper_bound(_offsets.begin(), _offsets.end(), value) - 1;
+                    out = _ranges[i - _offsets.begin()].min + value - *i;
                 }
                 return out;
             }
@@ -125,22 +137,17 @@ namespace djv
             inline Index Sequence::getIndex(Number value) const
             {
                 Index out = invalidIndex;
-                Index tmp = 0;
-                for (const auto& j : ranges)
+                const Index i = _findRange(value);
+                if (i != invalidIndex)
                 {
-                    if (j.contains(value))
-                    {
-                        out = tmp + value - j.min;
-                        break;
-                    }
-                    tmp += j.max - j.min + 1;
+                    out = _offsets[i] + value - _ranges[i].min;
                 }
                 return out;
             }
 
             inline bool Sequence::operator == (const Sequence & value) const
             {
-                return ranges == value.ranges && pad == value.pad;
+                return _ranges == value._ranges && _pad == value._pad;
             }
 
             inline bool Sequence::operator != (const Sequence & value) const
@@ -166,7 +173,7 @@ namespace djv
             inline std::vector<Number> toFrames(const Sequence & value)
             {
                 std::vector<Number> out;
-                for (const auto & range : value.ranges)
+                for (const auto & range : value.getRanges())
                 {
                     for (const auto & i : toFrames(range))
                     {
@@ -256,9 +263,9 @@ namespace djv
             inline std::string toString(const Sequence & value)
             {
                 std::vector<std::string> list;
-                for (const auto & range : value.ranges)
+                for (const auto & range : value.getRanges())
                 {
-                    list.push_back(toString(range, value.pad));
+                    list.push_back(toString(range, value.getPad()));
                 }
                 return String::join(list, ',');
             }
@@ -271,8 +278,8 @@ namespace djv
                     Range range;
                     size_t pad = 0;
                     fromString(piece, range, pad);
-                    out.ranges.push_back(range);
-                    out.pad = std::max(out.pad, pad);
+                    out.add(range);
+                    out.setPad(std::max(out.getPad(), pad));
                 }
             }
 
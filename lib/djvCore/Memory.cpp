@@ -29,6 +29,9 @@
 
 #include <djvCore/Memory.h>
 
+#include <djvCore/Math.h>
+#include <djvCore/OS.h>
+
 #include <algorithm>
 
 namespace djv
@@ -37,6 +40,15 @@ namespace djv
     {
         namespace Memory
         {
+            namespace
+            {
+                //! \todo Should these be configurable?
+                const size_t cacheBudgetReserveMin     = gigabyte / 2;
+                const size_t cacheBudgetReserveDivisor = 10;
+                const float  cacheBudgetPressure       = 10.F;
+
+            } // namespace
+
             std::string getSizeLabel(uint64_t value)
             {
                 const std::vector<std::string> data = { "TB", "GB", "MB", "KB" };
@@ -65,6 +77,69 @@ namespace djv
                 return ss.str();
             }
 
+            void CacheBudget::setRange(size_t min, size_t max)
+            {
+                _min = min;
+                _max = std::max(min, max);
+                _budget = Math::clamp(_budget, _min, _max);
+            }
+
+            bool CacheBudget::update(const OS::MemoryInfo& info, size_t cacheByteCount)
+            {
+                const size_t prev = _budget;
+
+                // Keep some memory free for the rest of the system.
+                const size_t reserve = std::max(info.total / cacheBudgetReserveDivisor, cacheBudgetReserveMin);
+
+                const bool pressure =
+                    info.pressure >= cacheBudgetPressure ||
+                    info.available < reserve / 2;
+                if (pressure)
+                {
+                    if (!_pressure)
+                    {
+                        ++_pressureCount;
+                    }
+
+                    // Release a quarter of the cache, or more if that is not
+                    // enough to get back to the reserve.
+                    const size_t deficit = info.available < reserve ? (reserve - info.available) : 0;
+                    const size_t release = std::max(deficit, cacheByteCount / 4);
+                    _budget = std::min(_budget, cacheByteCount > release ? (cacheByteCount - release) : 0);
+                }
+                else
+                {
+                    const size_t available = info.available > reserve ? (info.available - reserve) : 0;
+                    const size_t target = cacheByteCount + available;
+                    if (!_init || target < _budget)
+                    {
+                        _budget = target;
+                    }
+                    else
+                    {
+                        // Grow gradually so the cache does not race other
+                        // applications for memory.
+                        _budget += (target - _budget) / 2;
+                    }
+                }
+                _budget = Math::clamp(_budget, _min, _max);
+                _pressure = pressure;
+                _init = true;
+                return _budget != prev;
+            }
+
+            uint64_t getStableHash(const std::string& value)
+            {
+                // FNV-1a.
+                uint64_t out = 14695981039346656037ULL;
+                for (const auto i : value)
+                {
+                    out ^= static_cast<uint8_t>(i);
+                    out *= 1099511628211ULL;
+                }
+                return out;
+            }
+
         } // namespace Memory
     } // namespace Core
 
@@ -35,6 +35,12 @@ namespace djv
 {
     namespace Core
     {
+        namespace OS
+        {
+            struct MemoryInfo;
+
+        } // namespace OS
+
         //! This namespace provides memory functionality.
         namespace Memory
         {
@@ -80,6 +86,42 @@ namespace djv
 
             ///@}
 
+            //! This class provides a cache budget that follows the memory
+            //! available on the system.
+            //!
+            //! The budget grows towards the memory used by the cache plus the
+            //! memory available above a reserve. It shrinks right away when the
+            //! available memory drops, and below the memory used by the cache
+            //! when the system is under memory pressure.
+            class CacheBudget
+            {
+            public:
+                CacheBudget();
+
+                size_t getBudget() const;
+                size_t getMin() const;
+                size_t getMax() const;
+
+                //! Get the number of times the system has come under memory
+                //! pressure.
+                size_t getPressureCount() const;
+
+                void setRange(size_t min, size_t max);
+
+                //! Update the budget with the current memory information and
+                //! the number of bytes used by the cache. Returns true if the
+                //! budget has changed.
+                bool update(const OS::MemoryInfo&, size_t cacheByteCount);
+
+            private:
+                size_t _min = 0;
+                size_t _max = 0;
+                size_t _budget = 0;
+                size_t _pressureCount = 0;
+                bool _pressure = false;
+                bool _init = false;
+            };
+
             //! Combine hashes.
             //!
             //! References:
@@ -87,6 +129,13 @@ namespace djv
             template <class T>
             void hashCombine(std::size_t&, const T&);
 
+            //! Get a hash that does not change between builds or platforms,
+            //! unlike std::hash, so it can be stored in files.
+            //!
+            //! References:
+            //! - http://www.isthe.com/chongo/tech/comp/fnv/index.html
+            uint64_t getStableHash(const std::string&);
+
         } // namespace Memory
     } // namespace Core
 
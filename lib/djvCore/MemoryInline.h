@@ -156,6 +156,29 @@ namespace djv
                 }
             }
 
+            inline CacheBudget::CacheBudget()
+            {}
+
+            inline size_t CacheBudget::getBudget() const
+            {
+                return _budget;
+            }
+
+            inline size_t CacheBudget::getMin() const
+            {
+                return _min;
+            }
+
+            inline size_t CacheBudget::getMax() const
+            {
+                return _max;
+            }
+
+            inline size_t CacheBudget::getPressureCount() const
+            {
+                return _pressureCount;
+            }
+
             template <class T>
             inline void hashCombine(std::size_t & seed, const T & v)
             {
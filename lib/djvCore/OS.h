@@ -53,6 +53,21 @@ namespace djv
             //! Get the total amount of RAM available.
             size_t getRAMSize();
 
+            //! This struct provides memory information.
+            struct MemoryInfo
+            {
+                size_t total     = 0; //!< The total amount of RAM in bytes
+                size_t available = 0; //!< The RAM available without swapping in bytes
+                size_t resident  = 0; //!< The RAM used by this process in bytes
+
+                //! The percentage of time tasks were stalled waiting for memory
+                //! over the last ten seconds, or zero if it is not known.
+                float pressure = 0.F;
+            };
+
+            //! Get the current memory information.
+            MemoryInfo getMemoryInfo();
+
             //! Get the current user.
             //! Throws:
             //! - std::exception
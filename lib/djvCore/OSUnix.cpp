@@ -36,8 +36,10 @@
 #include <ApplicationServices/ApplicationServices.h>
 #include <CoreFoundation/CFBundle.h>
 #include <CoreServices/CoreServices.h>
+#include <mach/mach.h>
 #endif // DJV_PLATFORM_OSX
 
+#include <fstream>
 #include <sstream>
 
 #include <sys/ioctl.h>
@@ -94,6 +96,68 @@ namespace djv
                 return out;
             }
 
+            MemoryInfo getMemoryInfo()
+            {
+                MemoryInfo out;
+                out.total = getRAMSize();
+#if defined(DJV_PLATFORM_OSX)
+                vm_size_t pageSize = 0;
+                host_page_size(mach_host_self(), &pageSize);
+                vm_statistics64_data_t vmStats;
+                mach_msg_type_number_t count = HOST_VM_INFO64_COUNT;
+                if (KERN_SUCCESS == host_statistics64(mach_host_self(), HOST_VM_INFO64, reinterpret_cast<host_info64_t>(&vmStats), &count))
+                {
+                    out.available = static_cast<size_t>(vmStats.free_count + vmStats.inactive_count) * pageSize;
+                }
+                mach_task_basic_info_data_t taskInfo;
+                count = MACH_TASK_BASIC_INFO_COUNT;
+                if (KERN_SUCCESS == task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&taskInfo), &count))
+                {
+                    out.resident = taskInfo.resident_size;
+                }
+#else // DJV_PLATFORM_OSX
+                {
+                    std::ifstream file("/proc/meminfo");
+                    std::string name;
+                    size_t value = 0;
+                    std::string unit;
+                    while (file >> name >> value >> unit)
+                    {
+                        if ("MemAvailable:" == name)
+                        {
+                            out.available = value * 1024;
+                            break;
+                        }
+                    }
+                }
+                {
+                    std::ifstream file("/proc/self/statm");
+                    size_t size = 0;
+                    size_t resident = 0;
+                    if (file >> size >> resident)
+                    {
+                        out.resident = resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                    }
+                }
+                {
+                    // Pressure stall information is only available with newer
+                    // kernels.
+                    std::ifstream file("/proc/pressure/memory");
+                    std::string line;
+                    if (std::getline(file, line))
+                    {
+                        const std::string key = "avg10=";
+                        const auto i = line.find(key);
+                        if (i != std::string::npos)
+                        {
+                            out.pressure = std::strtof(line.c_str() + i + key.size(), nullptr);
+                        }
+                    }
+                }
+#endif // DJV_PLATFORM_OSX
+                return out;
+            }
+
             int getTerminalWidth()
             {
                 int out = 80;
@@ -39,6 +39,7 @@
 #define NOMINMAX
 #endif // NOMINMAX
 #include <windows.h>
+#include <psapi.h>
 #include <Shlobj.h>
 #include <shellapi.h>
 #include <stdlib.h>
@@ -121,6 +122,24 @@ namespace djv
                 return statex.ullTotalPhys;
             }
 
+            MemoryInfo getMemoryInfo()
+            {
+                MemoryInfo out;
+                MEMORYSTATUSEX statex;
+                statex.dwLength = sizeof(statex);
+                if (GlobalMemoryStatusEx(&statex))
+                {
+                    out.total = statex.ullTotalPhys;
+                    out.available = statex.ullAvailPhys;
+                }
+                PROCESS_MEMORY_COUNTERS counters;
+                if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+                {
+                    out.resident = counters.WorkingSetSize;
+                }
+                return out;
+            }
+
             std::string getUserName()
             {
                 WCHAR tmp[String::cStringLength] = { 0 };
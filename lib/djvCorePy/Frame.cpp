@@ -68,11 +68,13 @@ void wrapFrame(pybind11::module& m)
         .def(py::init<>())
         .def(py::init<const Frame::Range&, size_t>(), py::arg("range"), py::arg("pad") = 0)
         .def(py::init<const std::vector<Frame::Range>&, size_t>(), py::arg("ranges"), py::arg("pad") = 0)
-        .def_readwrite("ranges", &Frame::Sequence::ranges)
-        .def_readwrite("pad", &Frame::Sequence::pad)
+        .def_property("ranges", &Frame::Sequence::getRanges, &Frame::Sequence::setRanges)
+        .def_property("pad", &Frame::Sequence::getPad, &Frame::Sequence::setPad)
+        .def("add", &Frame::Sequence::add)
         .def("isValid", &Frame::Sequence::isValid)
         .def("getSize", &Frame::Sequence::getSize)
         .def("getFrame", &Frame::Sequence::getFrame)
+        .def("getIndex", &Frame::Sequence::getIndex)
         .def("sort", &Frame::Sequence::sort)
         .def(py::self == py::self)
         .def(py::self != py::self);
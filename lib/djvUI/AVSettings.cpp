@@ -89,6 +89,7 @@ namespace djv
                     Time::FPS defaultSpeed = Time::getDefaultSpeed();
                     djv::AV::Render::ImageFilterOptions imageFilterOptions;
                     bool lcdText = false;
+                    size_t dynamicTextureCacheMax = p.avSystem->observeDynamicTextureCacheMax()->get();
                     for (const auto & i : object)
                     {
                         if ("TimeUnits" == i.first)
@@ -115,12 +116,18 @@ namespace djv
                             std::stringstream ss(i.second.get<std::string>());
                             ss >> lcdText;
                         }
+                        else if ("DynamicTextureCacheMax" == i.first)
+                        {
+                            std::stringstream ss(i.second.get<std::string>());
+                            ss >> dynamicTextureCacheMax;
+                        }
                     }
                     p.avSystem->setTimeUnits(timeUnits);
                     p.avSystem->setAlphaBlend(alphaBlend);
                     p.avSystem->setDefaultSpeed(defaultSpeed);
                     p.avSystem->setImageFilterOptions(imageFilterOptions);
                     p.avSystem->setLCDText(lcdText);
+                    p.avSystem->setDynamicTextureCacheMax(dynamicTextureCacheMax);
                     for (const auto & i : p.ioSystem->getPluginNames())
                     {
                         const auto j = object.find(i);
@@ -161,6 +168,11 @@ namespace djv
                     ss << p.avSystem->observeLCDText()->get();
                     object["LCDText"] = picojson::value(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << p.avSystem->observeDynamicTextureCacheMax()->get();
+                    object["DynamicTextureCacheMax"] = picojson::value(ss.str());
+                }
                 for (const auto & i : p.ioSystem->getPluginNames())
                 {
                     object[i] = p.ioSystem->getOptions(i);
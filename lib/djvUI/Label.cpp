@@ -62,7 +62,7 @@ namespace djv
             std::string sizeString;
             glm::vec2 sizeStringSize = glm::vec2(0.F, 0.F);
             std::future<glm::vec2> sizeStringFuture;
-            std::vector<std::shared_ptr<AV::Font::Glyph> > glyphs;
+            AV::Render::TextRun textRun;
             std::future<std::vector<std::shared_ptr<AV::Font::Glyph> > > glyphsFuture;
         };
 
@@ -212,7 +212,7 @@ namespace djv
         {
             Widget::_paintEvent(event);
             DJV_PRIVATE_PTR();
-            if (p.glyphs.size())
+            if (p.textRun.getGlyphs().size())
             {
                 const auto& style = _getStyle();
                 const BBox2f& g = getMargin().bbox(getGeometry(), style);
@@ -256,7 +256,7 @@ namespace djv
 
                 render->setFillColor(style->getColor(p.textColorRole));
                 //! \bug Why the extra subtract by one here?
-                render->drawText(p.glyphs, glm::vec2(floorf(pos.x), floorf(pos.y + p.fontMetrics.ascender - 1.F)));
+                render->drawText(p.textRun, glm::vec2(floorf(pos.x), floorf(pos.y + p.fontMetrics.ascender - 1.F)));
             }
         }
 
@@ -314,7 +314,7 @@ namespace djv
             {
                 try
                 {
-                    p.glyphs = p.glyphsFuture.get();
+                    p.textRun.setGlyphs(p.glyphsFuture.get());
                     _redraw();
                 }
                 catch (const std::exception & e)
@@ -330,7 +330,7 @@ namespace djv
             p.textSizeFuture = p.fontSystem->measure(p.text, p.fontInfo);
             if (!p.text.size())
             {
-                p.glyphs.clear();
+                p.textRun.setGlyphs({});
             }
             p.glyphsFuture = p.fontSystem->getGlyphs(p.text, p.fontInfo);
         }
@@ -63,6 +63,9 @@ namespace djv
             typedef std::pair<AV::Font::Info, float> TextCacheKey;
             typedef std::pair<std::vector<AV::Font::TextLine>, glm::vec2> TextCacheValue;
             Memory::Cache<TextCacheKey, TextCacheValue> textCache;
+            TextCacheKey textRunsKey;
+            bool textRunsValid = false;
+            std::vector<std::pair<glm::vec2, AV::Render::TextRun> > textRuns;
             BBox2f clipRect;
 
             TextCacheValue textLines(float);
@@ -242,25 +245,39 @@ namespace djv
             const auto& style = _getStyle();
             const BBox2f& g = getMargin().bbox(getGeometry(), style);
             const auto key = std::make_pair(p.fontInfo, g.w());
-            Private::TextCacheValue cacheValue;
-            if (p.textCache.get(key, cacheValue))
+            if (!p.textRunsValid || key != p.textRunsKey)
+            {
+                Private::TextCacheValue cacheValue;
+                if (p.textCache.get(key, cacheValue))
+                {
+                    p.textRuns.clear();
+                    for (const auto& line : cacheValue.first)
+                    {
+                        p.textRuns.push_back(std::make_pair(line.size, AV::Render::TextRun(line.glyphs)));
+                    }
+                    p.textRunsKey = key;
+                    p.textRunsValid = true;
+                }
+            }
+            if (p.textRunsValid)
             {
                 const glm::vec2 c = g.getCenter();
                 glm::vec2 pos = g.min;
                 auto render = _getRender();
                 render->setCurrentFont(p.fontInfo);
                 render->setFillColor(style->getColor(p.textColorRole));
-                for (const auto & line : cacheValue.first)
+                for (auto& line : p.textRuns)
                 {
-                    if (pos.y + line.size.y >= p.clipRect.min.y && pos.y <= p.clipRect.max.y)
+                    const glm::vec2& size = line.first;
+                    if (pos.y + size.y >= p.clipRect.min.y && pos.y <= p.clipRect.max.y)
                     {
                         switch (p.textHAlign)
                         {
                         case TextHAlign::Center:
-                            pos.x = ceilf(c.x - line.size.x / 2.F);
+                            pos.x = ceilf(c.x - size.x / 2.F);
                             break;
                         case TextHAlign::Right:
-                            pos.x = g.max.x - line.size.x;
+                            pos.x = g.max.x - size.x;
                             break;
                         default: break;
                         }
@@ -268,10 +285,10 @@ namespace djv
                         render->setFillColor(style->getColor(p.textColorRole));
                         //! \bug Why the extra subtract by one here?
                         render->drawText(
-                            line.glyphs,
+                            line.second,
                             glm::vec2(floorf(pos.x), floorf(pos.y + p.fontMetrics.ascender - 1.F)));
                     }
-                    pos.y += line.size.y;
+                    pos.y += size.y;
                 }
             }
         }
@@ -311,6 +328,8 @@ namespace djv
             p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
             p.fontSystem->cacheGlyphs(p.text, p.fontInfo);
             p.textCache.clear();
+            p.textRuns.clear();
+            p.textRunsValid = false;
             _resize();
         }
 
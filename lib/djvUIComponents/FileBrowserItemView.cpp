@@ -57,6 +57,17 @@ namespace djv
 
                 const size_t invalid = static_cast<size_t>(-1);
 
+                //! \todo Should this be configurable?
+                const size_t itemMarginRows = 2;
+
+                //! Erase the entries for the items outside of the given range.
+                template<typename T>
+                void eraseItems(std::map<size_t, T>& value, size_t first, size_t last)
+                {
+                    value.erase(value.begin(), value.lower_bound(first));
+                    value.erase(value.lower_bound(last), value.end());
+                }
+
             } // namespace
 
             struct ItemView::Private
@@ -66,7 +77,9 @@ namespace djv
                 std::vector<FileSystem::FileInfo> items;
                 AV::Font::Metrics nameFontMetrics;
                 std::future<AV::Font::Metrics> nameFontMetricsFuture;
-                std::map<size_t, BBox2f> itemGeometry;
+                glm::vec2 itemSize = glm::vec2(0.F, 0.F);
+                float itemSpacing = 0.F;
+                size_t columns = 1;
                 std::map<size_t, std::string> names;
                 std::map<size_t, std::vector<AV::Font::TextLine> > nameLines;
                 std::map<size_t, std::future<std::vector<AV::Font::TextLine> > > nameLinesFutures;
@@ -75,6 +88,7 @@ namespace djv
                 AV::Image::Size thumbnailSize = AV::Image::Size(100, 50);
                 std::map<size_t, std::shared_ptr<AV::Image::Image> > thumbnails;
                 std::map<size_t, AV::ThumbnailSystem::ImageFuture> thumbnailFutures;
+                std::shared_ptr<AV::ThumbnailSystem::Generation> requestGeneration;
                 std::map<size_t, std::chrono::steady_clock::time_point> thumbnailTimers;
                 std::map<FileSystem::FileType, std::shared_ptr<AV::Image::Image> > icons;
                 std::map<FileSystem::FileType, std::future<std::shared_ptr<AV::Image::Image> > > iconsFutures;
@@ -106,6 +120,7 @@ namespace djv
                 setClassName("djv::UI::FileBrowser::ItemView");
 
                 p.fontSystem = context->getSystemT<AV::Font::System>();
+                p.requestGeneration = std::make_shared<AV::ThumbnailSystem::Generation>();
 
                 auto avSystem = context->getSystemT<AV::AVSystem>();
                 auto weak = std::weak_ptr<ItemView>(std::dynamic_pointer_cast<ItemView>(shared_from_this()));
@@ -144,7 +159,11 @@ namespace djv
             {}
 
             ItemView::~ItemView()
-            {}
+            {
+                // Drop any pending requests.
+                DJV_PRIVATE_PTR();
+                p.requestGeneration->set(p.requestGeneration->get() + 1);
+            }
 
             std::shared_ptr<ItemView> ItemView::create(const std::shared_ptr<Context>& context)
             {
@@ -201,28 +220,20 @@ namespace djv
                 if (const size_t itemCount = p.items.size())
                 {
                     const auto& style = _getStyle();
-                    const float m = style->getMetric(MetricsRole::MarginSmall);
                     const float s = style->getMetric(MetricsRole::Spacing);
-                    const float sh = style->getMetric(MetricsRole::Shadow);
+                    const glm::vec2 itemSize = _getItemSize(value);
                     switch (p.viewType)
                     {
                     case ViewType::Tiles:
                     {
-                        size_t columns = 1;
-                        const float itemWidth = p.thumbnailSize.w + sh * 2.F;
-                        float x = s + itemWidth;
-                        while (x < value - itemWidth)
-                        {
-                            ++columns;
-                            x += itemWidth + s;
-                        }
+                        const size_t columns = _getColumns(value);
                         const size_t rows = itemCount / columns + (itemCount % columns ? 1 : 0);
-                        out = (p.thumbnailSize.h + p.nameFontMetrics.lineHeight * 2.F + m * 2.F + sh * 2.F) * rows;
+                        out = itemSize.y * rows;
                         out += s * (rows + 1);
                         break;
                     }
                     case ViewType::List:
-                        out = std::max(static_cast<float>(p.thumbnailSize.h), p.nameFontMetrics.lineHeight + m * 2.F) * itemCount;
+                        out = itemSize.y * itemCount;
                         break;
                     default: break;
                     }
@@ -235,44 +246,9 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 const BBox2f & g = getGeometry();
                 const auto& style = _getStyle();
-                const float m = style->getMetric(MetricsRole::MarginSmall);
-                const float s = style->getMetric(MetricsRole::Spacing);
-                const float sh = style->getMetric(MetricsRole::Shadow);
-                p.itemGeometry.clear();
-                glm::vec2 pos = g.min;
-                auto item = p.items.begin();
-                size_t i = 0;
-                switch (p.viewType)
-                {
-                case ViewType::Tiles:
-                    pos += s;
-                    for (; item != p.items.end(); ++item, ++i)
-                    {
-                        const float itemHeight = p.thumbnailSize.h + p.nameFontMetrics.lineHeight * 2.F + m * 2.F + sh * 2.F;
-                        const float itemWidth = p.thumbnailSize.w + sh * 2.F;
-                        p.itemGeometry[i] = BBox2f(pos.x, pos.y, itemWidth, itemHeight);
-                        pos.x += itemWidth;
-                        if (pos.x > g.max.x - itemWidth)
-                        {
-                            pos.x = g.min.x + s;
-                            pos.y += itemHeight + s;
-                        }
-                        else
-                        {
-                            pos.x += s;
-                        }
-                    }
-                    break;
-                case ViewType::List:
-                    for (; item != p.items.end(); ++item, ++i)
-                    {
-                        const float itemHeight = std::max(static_cast<float>(p.thumbnailSize.h), p.nameFontMetrics.lineHeight + m * 2.F);
-                        p.itemGeometry[i] = BBox2f(pos.x, pos.y, g.w(), itemHeight);
-                        pos.y += itemHeight;
-                    }
-                    break;
-                default: break;
-                }
+                p.itemSize = _getItemSize(g.w());
+                p.itemSpacing = ViewType::Tiles == p.viewType ? style->getMetric(MetricsRole::Spacing) : 0.F;
+                p.columns = _getColumns(g.w());
             }
 
             void ItemView::_clipEvent(Event::Clip & event)
@@ -284,103 +260,128 @@ namespace djv
                 {
                     const auto& style = _getStyle();
                     const auto& clipRect = event.getClipRect();
-                    for (const auto& i : p.itemGeometry)
+                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
+                    auto ioSystem = context->getSystemT<AV::IO::System>();
+
+                    // Only keep the state for the visible items plus a margin.
+                    const auto visible = _getItemRange(clipRect);
+                    const size_t margin = itemMarginRows * p.columns;
+                    const size_t first = visible.first > margin ? (visible.first - margin) : 0;
+                    const size_t last = std::min(visible.second + margin, p.items.size());
+                    eraseItems(p.names, first, last);
+                    eraseItems(p.nameLines, first, last);
+                    eraseItems(p.nameLinesFutures, first, last);
+                    eraseItems(p.ioInfo, first, last);
+                    eraseItems(p.ioInfoFutures, first, last);
+                    eraseItems(p.thumbnails, first, last);
+                    eraseItems(p.thumbnailFutures, first, last);
+                    eraseItems(p.thumbnailTimers, first, last);
+                    eraseItems(p.nameGlyphs, first, last);
+                    eraseItems(p.nameGlyphsFutures, first, last);
+                    eraseItems(p.sizeGlyphs, first, last);
+                    eraseItems(p.sizeGlyphsFutures, first, last);
+                    eraseItems(p.timeGlyphs, first, last);
+                    eraseItems(p.timeGlyphsFutures, first, last);
+
+                    // Requests for the items are made with the next generation
+                    // and prioritized by their order on screen, with the visible
+                    // items first. Pending requests for the items that were
+                    // erased above are left with the current generation so they
+                    // are dropped once the generation is advanced.
+                    AV::ThumbnailSystem::RequestOptions requestOptions;
+                    requestOptions.generation = p.requestGeneration;
+                    requestOptions.generationValue = p.requestGeneration->get() + 1;
+                    auto request = [this, &style, &thumbnailSystem, &ioSystem, &requestOptions](size_t index)
                     {
-                        if (i.first < p.items.size() && i.second.intersects(clipRect))
+                        DJV_PRIVATE_PTR();
+                        const auto& fileInfo = p.items[index];
                         {
-                            const auto& fileInfo = p.items[i.first];
+                            const auto j = p.nameLines.find(index);
+                            if (j == p.nameLines.end())
                             {
-                                const auto j = p.nameLines.find(i.first);
-                                if (j == p.nameLines.end())
+                                const auto k = p.nameLinesFutures.find(index);
+                                if (k == p.nameLinesFutures.end())
                                 {
-                                    const auto k = p.nameLinesFutures.find(i.first);
-                                    if (k == p.nameLinesFutures.end())
-                                    {
-                                        const float m = style->getMetric(MetricsRole::MarginSmall);
-                                        const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                        p.names[i.first] = fileInfo.getFileName(Frame::invalid, false);
-                                        p.nameLinesFutures[i.first] = p.fontSystem->textLines(
-                                            p.names[i.first],
-                                            p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
-                                            fontInfo);
-                                    }
+                                    const float m = style->getMetric(MetricsRole::MarginSmall);
+                                    const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
+                                    p.names[index] = fileInfo.getFileName(Frame::invalid, false);
+                                    p.nameLinesFutures[index] = p.fontSystem->textLines(
+                                        p.names[index],
+                                        p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
+                                        fontInfo);
                                 }
                             }
-                            if (p.ioInfo.find(i.first) == p.ioInfo.end())
+                        }
+                        if (p.ioInfo.find(index) == p.ioInfo.end())
+                        {
+                            const auto j = p.ioInfoFutures.find(index);
+                            if (j != p.ioInfoFutures.end())
                             {
-                                if (p.ioInfoFutures.find(i.first) == p.ioInfoFutures.end())
-                                {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::System>();
-                                    if (thumbnailSystem && ioSystem)
-                                    {
-                                        if (ioSystem->canRead(fileInfo))
-                                        {
-                                            p.ioInfoFutures[i.first] = thumbnailSystem->getInfo(fileInfo);
-                                        }
-                                    }
-                                }
+                                thumbnailSystem->setInfoOptions(j->second.uid, requestOptions);
                             }
-                            if (p.thumbnails.find(i.first) == p.thumbnails.end())
+                            else if (ioSystem->canRead(fileInfo))
                             {
-                                if (p.thumbnailFutures.find(i.first) == p.thumbnailFutures.end())
-                                {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::System>();
-                                    if (thumbnailSystem && ioSystem && ioSystem->canRead(fileInfo))
-                                    {
-                                        p.thumbnailFutures[i.first] = thumbnailSystem->getImage(fileInfo, p.thumbnailSize);
-                                    }
-                                }
+                                p.ioInfoFutures[index] = thumbnailSystem->getInfo(fileInfo, requestOptions);
                             }
-                            if (p.nameGlyphs.find(i.first) == p.nameGlyphs.end())
+                        }
+                        if (p.thumbnails.find(index) == p.thumbnails.end())
+                        {
+                            const auto j = p.thumbnailFutures.find(index);
+                            if (j != p.thumbnailFutures.end())
                             {
-                                if (p.nameGlyphsFutures.find(i.first) == p.nameGlyphsFutures.end())
-                                {
-                                    const std::string& label = fileInfo.getFileName(Frame::invalid, false);
-                                    const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                    p.nameGlyphsFutures[i.first] = p.fontSystem->getGlyphs(label, fontInfo);
-                                }
+                                thumbnailSystem->setImageOptions(j->second.uid, requestOptions);
                             }
-                            if (p.sizeGlyphs.find(i.first) == p.sizeGlyphs.end())
+                            else if (ioSystem->canRead(fileInfo))
                             {
-                                if (p.sizeGlyphsFutures.find(i.first) == p.sizeGlyphsFutures.end())
-                                {
-                                    const std::string& label = Memory::getSizeLabel(fileInfo.getSize());
-                                    const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                    p.sizeGlyphsFutures[i.first] = p.fontSystem->getGlyphs(label, fontInfo);
-                                }
+                                p.thumbnailFutures[index] = thumbnailSystem->getImage(
+                                    fileInfo,
+                                    p.thumbnailSize,
+                                    AV::Image::Type::None,
+                                    requestOptions);
                             }
-                            if (p.timeGlyphs.find(i.first) == p.timeGlyphs.end())
+                        }
+                        ++requestOptions.priority;
+                        if (p.nameGlyphs.find(index) == p.nameGlyphs.end())
+                        {
+                            if (p.nameGlyphsFutures.find(index) == p.nameGlyphsFutures.end())
                             {
-                                if (p.timeGlyphsFutures.find(i.first) == p.timeGlyphsFutures.end())
-                                {
-                                    const std::string& label = Time::getLabel(fileInfo.getTime());
-                                    const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                    p.timeGlyphsFutures[i.first] = p.fontSystem->getGlyphs(label, fontInfo);
-                                }
+                                const std::string& label = fileInfo.getFileName(Frame::invalid, false);
+                                const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
+                                p.nameGlyphsFutures[index] = p.fontSystem->getGlyphs(label, fontInfo);
                             }
                         }
-                        else if (auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>())
+                        if (p.sizeGlyphs.find(index) == p.sizeGlyphs.end())
                         {
+                            if (p.sizeGlyphsFutures.find(index) == p.sizeGlyphsFutures.end())
                             {
-                                const auto j = p.ioInfoFutures.find(i.first);
-                                if (j != p.ioInfoFutures.end())
-                                {
-                                    thumbnailSystem->cancelInfo(j->second.uid);
-                                    p.ioInfoFutures.erase(j);
-                                }
+                                const std::string& label = Memory::getSizeLabel(fileInfo.getSize());
+                                const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
+                                p.sizeGlyphsFutures[index] = p.fontSystem->getGlyphs(label, fontInfo);
                             }
+                        }
+                        if (p.timeGlyphs.find(index) == p.timeGlyphs.end())
+                        {
+                            if (p.timeGlyphsFutures.find(index) == p.timeGlyphsFutures.end())
                             {
-                                const auto j = p.thumbnailFutures.find(i.first);
-                                if (j != p.thumbnailFutures.end())
-                                {
-                                    thumbnailSystem->cancelImage(j->second.uid);
-                                    p.thumbnailFutures.erase(j);
-                                }
+                                const std::string& label = Time::getLabel(fileInfo.getTime());
+                                const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
+                                p.timeGlyphsFutures[index] = p.fontSystem->getGlyphs(label, fontInfo);
                             }
                         }
+                    };
+                    for (size_t i = visible.first; i < visible.second; ++i)
+                    {
+                        request(i);
                     }
+                    for (size_t i = visible.second; i < last; ++i)
+                    {
+                        request(i);
+                    }
+                    for (size_t i = first; i < visible.first; ++i)
+                    {
+                        request(i);
+                    }
+                    p.requestGeneration->set(requestOptions.generationValue);
                 }
             }
 
@@ -394,209 +395,206 @@ namespace djv
 
                 auto render = _getRender();
                 const auto& ut = _getUpdateTime();
-                auto item = p.items.begin();
-                size_t index = 0;
-                for (; item != p.items.end(); ++item, ++index)
+                const auto range = _getItemRange(getClipRect());
+                for (size_t index = range.first; index < range.second; ++index)
                 {
-                    const auto i = p.itemGeometry.find(index);
-                    if (i != p.itemGeometry.end())
-                    {
-                        BBox2f itemGeometry = i->second;
+                    const auto& item = p.items[index];
+                    const BBox2f geometry = _getItemGeometry(index);
+                    BBox2f itemGeometry = geometry;
 
-                        if (ViewType::Tiles == p.viewType)
-                        {
-                            render->setFillColor(style->getColor(ColorRole::Shadow));
-                            render->drawShadow(itemGeometry.margin(0, -sh, 0, 0), sh);
-                            itemGeometry = itemGeometry.margin(-sh);
-                            render->setFillColor(style->getColor(ColorRole::BackgroundBellows));
-                            render->drawRect(itemGeometry);
-                        }
+                    if (ViewType::Tiles == p.viewType)
+                    {
+                        render->setFillColor(style->getColor(ColorRole::Shadow));
+                        render->drawShadow(itemGeometry.margin(0, -sh, 0, 0), sh);
+                        itemGeometry = itemGeometry.margin(-sh);
+                        render->setFillColor(style->getColor(ColorRole::BackgroundBellows));
+                        render->drawRect(itemGeometry);
+                    }
 
-                        if (ViewType::List == p.viewType)
-                        {
-                            render->pushClipRect(BBox2f(
-                                itemGeometry.min.x,
-                                itemGeometry.min.y,
-                                itemGeometry.w() * p.split[0],
-                                itemGeometry.h()));
-                        }
-                        float opacity = 0.F;
+                    if (ViewType::List == p.viewType)
+                    {
+                        render->pushClipRect(BBox2f(
+                            itemGeometry.min.x,
+                            itemGeometry.min.y,
+                            itemGeometry.w() * p.split[0],
+                            itemGeometry.h()));
+                    }
+                    float opacity = 0.F;
+                    {
+                        const auto j = p.thumbnails.find(index);
+                        if (j != p.thumbnails.end())
                         {
-                            const auto j = p.thumbnails.find(index);
-                            if (j != p.thumbnails.end())
+                            if (j->second)
                             {
-                                if (j->second)
+                                opacity = 1.F;
+                                const auto k = p.thumbnailTimers.find(index);
+                                if (k != p.thumbnailTimers.end())
                                 {
-                                    opacity = 1.F;
-                                    const auto k = p.thumbnailTimers.find(index);
-                                    if (k != p.thumbnailTimers.end())
-                                    {
-                                        const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(ut - k->second);
-                                        opacity = std::min(t.count() / static_cast<float>(thumbnailFadeTime), 1.F);
-                                    }
-                                    const uint16_t w = j->second->getWidth();
-                                    const uint16_t h = j->second->getHeight();
-                                    glm::vec2 pos(0.F, 0.F);
-                                    switch (p.viewType)
-                                    {
-                                    case ViewType::Tiles:
-                                        pos.x = floor(i->second.min.x + sh + p.thumbnailSize.w / 2.F - w / 2.F);
-                                        pos.y = floor(i->second.min.y + sh + p.thumbnailSize.h - h);
-                                        break;
-                                    case ViewType::List:
-                                        pos.x = floor(i->second.min.x);
-                                        pos.y = floor(i->second.min.y + i->second.h() / 2.F - h / 2.F);
-                                        break;
-                                    default: break;
-                                    }
-                                    render->setFillColor(AV::Image::Color(1.F, 1.F, 1.F, opacity));
-                                    AV::Render::ImageOptions options;
-                                    options.alphaBlend = p.alphaBlend;
-                                    auto l = p.ocioConfig.fileColorSpaces.find(j->second->getPluginName());
-                                    if (l != p.ocioConfig.fileColorSpaces.end())
-                                    {
-                                        options.colorSpace.input = l->second;
-                                    }
-                                    else
-                                    {
-                                        l = p.ocioConfig.fileColorSpaces.find(std::string());
-                                        if (l != p.ocioConfig.fileColorSpaces.end())
-                                        {
-                                            options.colorSpace.input = l->second;
-                                        }
-                                    }
-                                    options.colorSpace.output = p.outputColorSpace;
-                                    render->drawImage(j->second, pos, options);
+                                    const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(ut - k->second);
+                                    opacity = std::min(t.count() / static_cast<float>(thumbnailFadeTime), 1.F);
                                 }
-                            }
-                        }
-                        if (opacity < 1.F)
-                        {
-                            const auto j = p.icons.find(item->getType());
-                            if (j != p.icons.end())
-                            {
                                 const uint16_t w = j->second->getWidth();
                                 const uint16_t h = j->second->getHeight();
                                 glm::vec2 pos(0.F, 0.F);
                                 switch (p.viewType)
                                 {
                                 case ViewType::Tiles:
-                                    pos.x = floor(i->second.min.x + sh + p.thumbnailSize.w / 2.F - w / 2.F);
-                                    pos.y = floor(i->second.min.y + sh + p.thumbnailSize.h - h);
+                                    pos.x = floor(geometry.min.x + sh + p.thumbnailSize.w / 2.F - w / 2.F);
+                                    pos.y = floor(geometry.min.y + sh + p.thumbnailSize.h - h);
                                     break;
                                 case ViewType::List:
-                                    pos.x = floor(i->second.min.x);
-                                    pos.y = floor(i->second.min.y + i->second.h() / 2.F - h / 2.F);
+                                    pos.x = floor(geometry.min.x);
+                                    pos.y = floor(geometry.min.y + geometry.h() / 2.F - h / 2.F);
                                     break;
                                 default: break;
                                 }
-                                auto c = style->getColor(ColorRole::Button).convert(AV::Image::Type::RGBA_F32);
-                                c.setF32(1.F - opacity, 3);
-                                render->setFillColor(c);
-                                render->drawFilledImage(j->second, pos);
+                                render->setFillColor(AV::Image::Color(1.F, 1.F, 1.F, opacity));
+                                AV::Render::ImageOptions options;
+                                options.alphaBlend = p.alphaBlend;
+                                auto l = p.ocioConfig.fileColorSpaces.find(j->second->getPluginName());
+                                if (l != p.ocioConfig.fileColorSpaces.end())
+                                {
+                                    options.colorSpace.input = l->second;
+                                }
+                                else
+                                {
+                                    l = p.ocioConfig.fileColorSpaces.find(std::string());
+                                    if (l != p.ocioConfig.fileColorSpaces.end())
+                                    {
+                                        options.colorSpace.input = l->second;
+                                    }
+                                }
+                                options.colorSpace.output = p.outputColorSpace;
+                                render->drawImage(j->second, pos, options);
                             }
                         }
+                    }
+                    if (opacity < 1.F)
+                    {
+                        const auto j = p.icons.find(item.getType());
+                        if (j != p.icons.end())
                         {
-                            render->setFillColor(style->getColor(ColorRole::Foreground));
-                            render->setCurrentFont(style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium));
+                            const uint16_t w = j->second->getWidth();
+                            const uint16_t h = j->second->getHeight();
+                            glm::vec2 pos(0.F, 0.F);
                             switch (p.viewType)
                             {
                             case ViewType::Tiles:
-                            {
-                                const auto j = p.names.find(index);
-                                const auto k = p.nameLines.find(index);
-                                if (j != p.names.end() && k != p.nameLines.end())
-                                {
-                                    float x = i->second.min.x + m + sh;
-                                    float y = i->second.max.y - p.nameFontMetrics.lineHeight * std::min(k->second.size(), static_cast<size_t>(2)) - m - sh;
-                                    size_t line = 0;
-                                    for (auto l = k->second.begin(); l != k->second.end() && line < 2; ++l, ++line)
-                                    {
-                                        //! \bug Why the extra subtract by one here?
-                                        render->drawText(
-                                            l->glyphs,
-                                            glm::vec2(
-                                                //floorf(x + p.thumbnailSize.x / 2.F - l->size.x / 2.F),
-                                                floor(x),
-                                                floorf(y + p.nameFontMetrics.ascender - 1.F)));
-                                        y += p.nameFontMetrics.lineHeight;
-                                    }
-                                }
+                                pos.x = floor(geometry.min.x + sh + p.thumbnailSize.w / 2.F - w / 2.F);
+                                pos.y = floor(geometry.min.y + sh + p.thumbnailSize.h - h);
                                 break;
-                            }
                             case ViewType::List:
+                                pos.x = floor(geometry.min.x);
+                                pos.y = floor(geometry.min.y + geometry.h() / 2.F - h / 2.F);
+                                break;
+                            default: break;
+                            }
+                            auto c = style->getColor(ColorRole::Button).convert(AV::Image::Type::RGBA_F32);
+                            c.setF32(1.F - opacity, 3);
+                            render->setFillColor(c);
+                            render->drawFilledImage(j->second, pos);
+                        }
+                    }
+                    {
+                        render->setFillColor(style->getColor(ColorRole::Foreground));
+                        render->setCurrentFont(style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium));
+                        switch (p.viewType)
+                        {
+                        case ViewType::Tiles:
+                        {
+                            const auto j = p.names.find(index);
+                            const auto k = p.nameLines.find(index);
+                            if (j != p.names.end() && k != p.nameLines.end())
                             {
-                                float x = i->second.min.x + p.thumbnailSize.w + s;
-                                float y = i->second.min.y + i->second.h() / 2.F - p.nameFontMetrics.lineHeight / 2.F;
-                                auto j = p.nameGlyphs.find(index);
-                                if (j != p.nameGlyphs.end())
+                                float x = geometry.min.x + m + sh;
+                                float y = geometry.max.y - p.nameFontMetrics.lineHeight * std::min(k->second.size(), static_cast<size_t>(2)) - m - sh;
+                                size_t line = 0;
+                                for (auto l = k->second.begin(); l != k->second.end() && line < 2; ++l, ++line)
                                 {
                                     //! \bug Why the extra subtract by one here?
                                     render->drawText(
-                                        j->second,
+                                        l->glyphs,
                                         glm::vec2(
-                                            floorf(x),
+                                            //floorf(x + p.thumbnailSize.x / 2.F - l->size.x / 2.F),
+                                            floor(x),
                                             floorf(y + p.nameFontMetrics.ascender - 1.F)));
+                                    y += p.nameFontMetrics.lineHeight;
                                 }
+                            }
+                            break;
+                        }
+                        case ViewType::List:
+                        {
+                            float x = geometry.min.x + p.thumbnailSize.w + s;
+                            float y = geometry.min.y + geometry.h() / 2.F - p.nameFontMetrics.lineHeight / 2.F;
+                            auto j = p.nameGlyphs.find(index);
+                            if (j != p.nameGlyphs.end())
+                            {
+                                //! \bug Why the extra subtract by one here?
+                                render->drawText(
+                                    j->second,
+                                    glm::vec2(
+                                        floorf(x),
+                                        floorf(y + p.nameFontMetrics.ascender - 1.F)));
+                            }
 
-                                render->popClipRect();
+                            render->popClipRect();
 
-                                x = i->second.min.x + i->second.w() * p.split[0] + m;
-                                j = p.sizeGlyphs.find(index);
-                                if (j != p.sizeGlyphs.end())
-                                {
-                                    render->pushClipRect(BBox2f(
-                                        itemGeometry.min.x + itemGeometry.w() * p.split[0],
-                                        itemGeometry.min.y,
-                                        itemGeometry.w() * (p.split[1] - p.split[0]),
-                                        itemGeometry.h()));
+                            x = geometry.min.x + geometry.w() * p.split[0] + m;
+                            j = p.sizeGlyphs.find(index);
+                            if (j != p.sizeGlyphs.end())
+                            {
+                                render->pushClipRect(BBox2f(
+                                    itemGeometry.min.x + itemGeometry.w() * p.split[0],
+                                    itemGeometry.min.y,
+                                    itemGeometry.w() * (p.split[1] - p.split[0]),
+                                    itemGeometry.h()));
 
-                                    //! \bug Why the extra subtract by one here?
-                                    render->drawText(
-                                        j->second,
-                                        glm::vec2(
-                                            floorf(x),
-                                            floorf(y + p.nameFontMetrics.ascender - 1.F)));
+                                //! \bug Why the extra subtract by one here?
+                                render->drawText(
+                                    j->second,
+                                    glm::vec2(
+                                        floorf(x),
+                                        floorf(y + p.nameFontMetrics.ascender - 1.F)));
 
-                                    render->popClipRect();
-                                }
+                                render->popClipRect();
+                            }
 
-                                x = i->second.min.x + i->second.w() * p.split[1] + m;
-                                j = p.timeGlyphs.find(index);
-                                if (j != p.timeGlyphs.end())
-                                {
-                                    render->pushClipRect(BBox2f(
-                                        itemGeometry.min.x + itemGeometry.w() * p.split[1],
-                                        itemGeometry.min.y,
-                                        itemGeometry.w() * (p.split[2] - p.split[1]),
-                                        itemGeometry.h()));
+                            x = geometry.min.x + geometry.w() * p.split[1] + m;
+                            j = p.timeGlyphs.find(index);
+                            if (j != p.timeGlyphs.end())
+                            {
+                                render->pushClipRect(BBox2f(
+                                    itemGeometry.min.x + itemGeometry.w() * p.split[1],
+                                    itemGeometry.min.y,
+                                    itemGeometry.w() * (p.split[2] - p.split[1]),
+                                    itemGeometry.h()));
 
-                                    //! \bug Why the extra subtract by one here?
-                                    render->drawText(
-                                        j->second,
-                                        glm::vec2(
-                                            floorf(x),
-                                            floorf(y + p.nameFontMetrics.ascender - 1.F)));
+                                //! \bug Why the extra subtract by one here?
+                                render->drawText(
+                                    j->second,
+                                    glm::vec2(
+                                        floorf(x),
+                                        floorf(y + p.nameFontMetrics.ascender - 1.F)));
 
-                                    render->popClipRect();
-                                }
-                                break;
-                            }
-                            default: break;
+                                render->popClipRect();
                             }
+                            break;
                         }
-
-                        if (p.grab == index)
-                        {
-                            render->setFillColor(style->getColor(ColorRole::Pressed));
-                            render->drawRect(itemGeometry);
-                        }
-                        else if (p.hover == index)
-                        {
-                            render->setFillColor(style->getColor(ColorRole::Hovered));
-                            render->drawRect(itemGeometry);
+                        default: break;
                         }
                     }
+
+                    if (p.grab == index)
+                    {
+                        render->setFillColor(style->getColor(ColorRole::Pressed));
+                        render->drawRect(itemGeometry);
+                    }
+                    else if (p.hover == index)
+                    {
+                        render->setFillColor(style->getColor(ColorRole::Hovered));
+                        render->drawRect(itemGeometry);
+                    }
                 }
             }
 
@@ -605,14 +603,11 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 event.accept();
                 const auto & pointerInfo = event.getPointerInfo();
-                for (const auto & i : p.itemGeometry)
+                const size_t index = _getItem(pointerInfo.pos);
+                if (index != invalid)
                 {
-                    if (i.second.contains(pointerInfo.pos))
-                    {
-                        p.hover = i.first;
-                        _redraw();
-                        break;
-                    }
+                    p.hover = index;
+                    _redraw();
                 }
             }
 
@@ -647,14 +642,11 @@ namespace djv
                 }
                 else
                 {
-                    for (const auto & i : p.itemGeometry)
+                    const size_t index = _getItem(pointerInfo.pos);
+                    if (index != invalid && index != p.hover)
                     {
-                        if (i.second.contains(pointerInfo.pos))
-                        {
-                            p.hover = i.first;
-                            _redraw();
-                            break;
-                        }
+                        p.hover = index;
+                        _redraw();
                     }
                 }
             }
@@ -665,17 +657,14 @@ namespace djv
                 if (p.pressedId)
                     return;
                 const auto & pointerInfo = event.getPointerInfo();
-                for (const auto & i : p.itemGeometry)
+                const size_t index = _getItem(pointerInfo.pos);
+                if (index != invalid)
                 {
-                    if (i.second.contains(pointerInfo.pos))
-                    {
-                        event.accept();
-                        p.grab = i.first;
-                        p.pressedId = pointerInfo.id;
-                        p.pressedPos = pointerInfo.pos;
-                        _redraw();
-                        break;
-                    }
+                    event.accept();
+                    p.grab = index;
+                    p.pressedId = pointerInfo.id;
+                    p.pressedPos = pointerInfo.pos;
+                    _redraw();
                 }
             }
 
@@ -692,15 +681,10 @@ namespace djv
                     const auto i = hover.find(pointerInfo.id);
                     if (p.callback && i != hover.end())
                     {
-                        for (const auto & j : p.itemGeometry)
+                        const size_t index = _getItem(i->second);
+                        if (index != invalid)
                         {
-                            if (j.second.contains(i->second))
-                            {
-                                if (j.first < p.items.size())
-                                {
-                                    p.callback(p.items[j.first]);
-                                }
-                            }
+                            p.callback(p.items[index]);
                         }
                     }
                     _redraw();
@@ -712,24 +696,18 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<ITooltipWidget> out;
                 std::string text;
-                for (const auto & i : p.itemGeometry)
+                const size_t index = _getItem(pos);
+                if (index != invalid)
                 {
-                    if (i.second.contains(pos))
+                    const auto & fileInfo = p.items[index];
+                    const auto j = p.ioInfo.find(index);
+                    if (j != p.ioInfo.end())
                     {
-                        if (i.first < p.items.size())
-                        {
-                            const auto & fileInfo = p.items[i.first];
-                            const auto j = p.ioInfo.find(i.first);
-                            if (j != p.ioInfo.end())
-                            {
-                                text = _getTooltip(fileInfo, j->second);
-                            }
-                            else
-                            {
-                                text = _getTooltip(fileInfo);
-                            }
-                        }
-                        break;
+                        text = _getTooltip(fileInfo, j->second);
+                    }
+                    else
+                    {
+                        text = _getTooltip(fileInfo);
                     }
                 }
                 if (!text.empty())
@@ -1020,6 +998,108 @@ namespace djv
                 return out;
             }
 
+            glm::vec2 ItemView::_getItemSize(float width) const
+            {
+                DJV_PRIVATE_PTR();
+                const auto& style = _getStyle();
+                const float m = style->getMetric(MetricsRole::MarginSmall);
+                const float sh = style->getMetric(MetricsRole::Shadow);
+                glm::vec2 out(0.F, 0.F);
+                switch (p.viewType)
+                {
+                case ViewType::Tiles:
+                    out.x = p.thumbnailSize.w + sh * 2.F;
+                    out.y = p.thumbnailSize.h + p.nameFontMetrics.lineHeight * 2.F + m * 2.F + sh * 2.F;
+                    break;
+                case ViewType::List:
+                    out.x = width;
+                    out.y = std::max(static_cast<float>(p.thumbnailSize.h), p.nameFontMetrics.lineHeight + m * 2.F);
+                    break;
+                default: break;
+                }
+                return out;
+            }
+
+            size_t ItemView::_getColumns(float width) const
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = 1;
+                if (ViewType::Tiles == p.viewType)
+                {
+                    // The first item is always placed, and each following item
+                    // is placed on the same row while the previous one ends
+                    // before the width minus the item width.
+                    const auto& style = _getStyle();
+                    const float s = style->getMetric(MetricsRole::Spacing);
+                    const float itemWidth = _getItemSize(width).x;
+                    const float available = width - itemWidth * 2.F - s;
+                    if (available >= 0.F && itemWidth + s > 0.F)
+                    {
+                        out += static_cast<size_t>(available / (itemWidth + s)) + 1;
+                    }
+                }
+                return out;
+            }
+
+            BBox2f ItemView::_getItemGeometry(size_t index) const
+            {
+                DJV_PRIVATE_PTR();
+                const BBox2f& g = getGeometry();
+                const size_t row = index / p.columns;
+                const size_t column = index % p.columns;
+                return BBox2f(
+                    g.min.x + p.itemSpacing + column * (p.itemSize.x + p.itemSpacing),
+                    g.min.y + p.itemSpacing + row * (p.itemSize.y + p.itemSpacing),
+                    p.itemSize.x,
+                    p.itemSize.y);
+            }
+
+            std::pair<size_t, size_t> ItemView::_getItemRange(const BBox2f& value) const
+            {
+                DJV_PRIVATE_PTR();
+                std::pair<size_t, size_t> out(0, 0);
+                const size_t itemCount = p.items.size();
+                const float rowHeight = p.itemSize.y + p.itemSpacing;
+                if (itemCount && rowHeight > 0.F)
+                {
+                    const BBox2f& g = getGeometry();
+                    const float y0 = value.min.y - g.min.y - p.itemSpacing;
+                    const float y1 = value.max.y - g.min.y - p.itemSpacing;
+                    if (y1 >= 0.F && y1 >= y0)
+                    {
+                        const size_t row0 = y0 > 0.F ? static_cast<size_t>(y0 / rowHeight) : 0;
+                        const size_t row1 = static_cast<size_t>(y1 / rowHeight);
+                        out.first = std::min(row0 * p.columns, itemCount);
+                        out.second = std::min((row1 + 1) * p.columns, itemCount);
+                    }
+                }
+                return out;
+            }
+
+            size_t ItemView::_getItem(const glm::vec2& value) const
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = invalid;
+                const BBox2f& g = getGeometry();
+                const glm::vec2 step = p.itemSize + p.itemSpacing;
+                const float x = value.x - g.min.x - p.itemSpacing;
+                const float y = value.y - g.min.y - p.itemSpacing;
+                if (x >= 0.F && y >= 0.F && step.x > 0.F && step.y > 0.F)
+                {
+                    const size_t column = static_cast<size_t>(x / step.x);
+                    const size_t row = static_cast<size_t>(y / step.y);
+                    const size_t index = row * p.columns + column;
+                    if (column < p.columns &&
+                        x - column * step.x <= p.itemSize.x &&
+                        y - row * step.y <= p.itemSize.y &&
+                        index < p.items.size())
+                    {
+                        out = index;
+                    }
+                }
+                return out;
+            }
+
             void ItemView::_iconsUpdate()
             {
                 DJV_PRIVATE_PTR();
@@ -1047,59 +1127,18 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (auto context = getContext().lock())
                 {
-                    p.thumbnails.clear();
+                    // The thumbnails are requested again by the clip event.
                     auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                    const auto& style = _getStyle();
                     p.names.clear();
                     p.nameLines.clear();
                     p.nameLinesFutures.clear();
-                    for (const auto& i : p.itemGeometry)
+                    p.thumbnails.clear();
+                    for (const auto& i : p.thumbnailFutures)
                     {
-                        const auto j = p.thumbnailFutures.find(i.first);
-                        if (j != p.thumbnailFutures.end())
-                        {
-                            thumbnailSystem->cancelImage(j->second.uid);
-                            p.thumbnailFutures.erase(j);
-                        }
+                        thumbnailSystem->cancelImage(i.second.uid);
                     }
                     p.thumbnailFutures.clear();
-
-                    const auto& clipRect = getClipRect();
-                    for (const auto& i : p.itemGeometry)
-                    {
-                        if (i.first < p.items.size() && i.second.intersects(clipRect))
-                        {
-                            if (p.thumbnails.find(i.first) == p.thumbnails.end())
-                            {
-                                const auto& fileInfo = p.items[i.first];
-                                {
-                                    const auto j = p.nameLines.find(i.first);
-                                    if (j == p.nameLines.end())
-                                    {
-                                        const auto k = p.nameLinesFutures.find(i.first);
-                                        if (k == p.nameLinesFutures.end())
-                                        {
-                                            const float m = style->getMetric(MetricsRole::MarginSmall);
-                                            const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                            p.names[i.first] = fileInfo.getFileName(Frame::invalid, false);
-                                            p.nameLinesFutures[i.first] = p.fontSystem->textLines(
-                                                p.names[i.first],
-                                                p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
-                                                fontInfo);
-                                        }
-                                    }
-                                }
-                                if (p.thumbnailFutures.find(i.first) == p.thumbnailFutures.end())
-                                {
-                                    auto ioSystem = context->getSystemT<AV::IO::System>();
-                                    if (ioSystem && ioSystem->canRead(fileInfo))
-                                    {
-                                        p.thumbnailFutures[i.first] = thumbnailSystem->getImage(fileInfo, p.thumbnailSize);
-                                    }
-                                }
-                            }
-                        }
-                    }
+                    p.thumbnailTimers.clear();
                 }
             }
 
@@ -1117,17 +1156,8 @@ namespace djv
                     p.ioInfo.clear();
                     p.ioInfoFutures.clear();
                     p.thumbnails.clear();
-                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                    for (const auto& i : p.itemGeometry)
-                    {
-                        const auto j = p.thumbnailFutures.find(i.first);
-                        if (j != p.thumbnailFutures.end())
-                        {
-                            thumbnailSystem->cancelImage(j->second.uid);
-                            p.thumbnailFutures.erase(j);
-                        }
-                    }
                     p.thumbnailFutures.clear();
+                    p.requestGeneration->set(p.requestGeneration->get() + 1);
                     p.thumbnailTimers.clear();
                     p.nameGlyphs.clear();
                     p.nameGlyphsFutures.clear();
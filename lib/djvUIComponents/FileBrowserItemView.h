@@ -63,6 +63,10 @@ namespace djv
         {
             //! This class provides a file browser item view.
             //!
+            //! The item geometry is computed from the item index, and text and
+            //! thumbnail state is only kept for the visible items plus a margin,
+            //! so the cost of events does not grow with the number of items.
+            //!
             //! \todo Elide names which are too long.
             //! \todo Show an animated spinner for thumbnails that are loading.
             //! \todo Show an error icon for thumbnails that failed to load.
@@ -105,6 +109,12 @@ namespace djv
             private:
                 std::string _getTooltip(const Core::FileSystem::FileInfo &) const;
                 std::string _getTooltip(const Core::FileSystem::FileInfo &, const AV::IO::Info &) const;
+
+                glm::vec2 _getItemSize(float width) const;
+                size_t _getColumns(float width) const;
+                Core::BBox2f _getItemGeometry(size_t) const;
+                std::pair<size_t, size_t> _getItemRange(const Core::BBox2f&) const;
+                size_t _getItem(const glm::vec2&) const;
                 
                 void _iconsUpdate();
                 void _thumbnailsSizeUpdate();
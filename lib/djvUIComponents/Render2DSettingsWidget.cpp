@@ -49,6 +49,7 @@ namespace djv
         {
             AV::Render::ImageFilterOptions filterOptions;
             std::shared_ptr<UI::ComboBox> filterComboBox[2];
+            std::shared_ptr<UI::CheckBox> mipmapsCheckBox;
             std::shared_ptr<UI::FormLayout> layout;
             std::shared_ptr<ValueObserver<AV::Render::ImageFilterOptions> > filterOptionsObserver;
         };
@@ -62,10 +63,12 @@ namespace djv
 
             p.filterComboBox[0] = UI::ComboBox::create(context);
             p.filterComboBox[1] = UI::ComboBox::create(context);
+            p.mipmapsCheckBox = UI::CheckBox::create(context);
 
             p.layout = UI::FormLayout::create(context);
             p.layout->addChild(p.filterComboBox[0]);
             p.layout->addChild(p.filterComboBox[1]);
+            p.layout->addChild(p.mipmapsCheckBox);
             addChild(p.layout);
 
             auto weak = std::weak_ptr<Render2DImageSettingsWidget>(std::dynamic_pointer_cast<Render2DImageSettingsWidget>(shared_from_this()));
@@ -96,6 +99,19 @@ namespace djv
                         }
                     }
                 });
+            p.mipmapsCheckBox->setCheckedCallback(
+                [weak, contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->filterOptions.mipmaps = value;
+                            auto avSystem = context->getSystemT<AV::AVSystem>();
+                            avSystem->setImageFilterOptions(widget->_p->filterOptions);
+                        }
+                    }
+                });
 
             auto avSystem = context->getSystemT<AV::AVSystem>();
             p.filterOptionsObserver = ValueObserver<AV::Render::ImageFilterOptions>::create(
@@ -142,6 +158,7 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.layout->setText(p.filterComboBox[0], _getText(DJV_TEXT("settings_render2d_minify_filter")) + ":");
             p.layout->setText(p.filterComboBox[1], _getText(DJV_TEXT("settings_render2d_magnify_filter")) + ":");
+            p.mipmapsCheckBox->setText(_getText(DJV_TEXT("settings_render2d_mipmaps")));
             _widgetUpdate();
         }
 
@@ -159,6 +176,7 @@ namespace djv
             }
             p.filterComboBox[0]->setCurrentItem(static_cast<int>(p.filterOptions.min));
             p.filterComboBox[1]->setCurrentItem(static_cast<int>(p.filterOptions.mag));
+            p.mipmapsCheckBox->setChecked(p.filterOptions.mipmaps);
         }
 
         struct Render2DTextSettingsWidget::Private
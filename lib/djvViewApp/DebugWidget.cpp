@@ -48,6 +48,7 @@
 #include <djvAV/ThumbnailSystem.h>
 
 #include <djvCore/Context.h>
+#include <djvCore/Memory.h>
 #include <djvCore/Timer.h>
 
 using namespace djv::Core;
@@ -449,18 +450,54 @@ namespace djv
                 _labels["TextureAtlasValue"]->setFont(AV::Font::familyMono);
                 _thermometerWidgets["TextureAtlas"] = UI::ThermometerWidget::create(context);
 
+                _labels["TextureAtlasPages"] = UI::Label::create(context);
+                _labels["TextureAtlasPagesValue"] = UI::Label::create(context);
+                _labels["TextureAtlasPagesValue"]->setFont(AV::Font::familyMono);
+                const size_t textureAtlasPageCount = _getRender()->getTextureAtlasPageOccupancy().size();
+                for (size_t i = 0; i < textureAtlasPageCount; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "TextureAtlasPage" << i;
+                    _thermometerWidgets[ss.str()] = UI::ThermometerWidget::create(context);
+                }
+
+                _labels["TextureAtlasEvictions"] = UI::Label::create(context);
+                _labels["TextureAtlasEvictionsValue"] = UI::Label::create(context);
+                _labels["TextureAtlasEvictionsValue"]->setFont(AV::Font::familyMono);
+
                 _labels["DynamicTextureCount"] = UI::Label::create(context);
                 _labels["DynamicTextureCountValue"] = UI::Label::create(context);
                 _labels["DynamicTextureCountValue"]->setFont(AV::Font::familyMono);
                 _lineGraphs["DynamicTextureCount"] = UI::LineGraphWidget::create(context);
                 _lineGraphs["DynamicTextureCount"]->setPrecision(0);
 
+                _labels["DynamicTextureCache"] = UI::Label::create(context);
+                _labels["DynamicTextureCacheValue"] = UI::Label::create(context);
+                _labels["DynamicTextureCacheValue"]->setFont(AV::Font::familyMono);
+                _thermometerWidgets["DynamicTextureCache"] = UI::ThermometerWidget::create(context);
+
                 _labels["VBOSize"] = UI::Label::create(context);
                 _labels["VBOSizeValue"] = UI::Label::create(context);
                 _labels["VBOSizeValue"]->setFont(AV::Font::familyMono);
                 _lineGraphs["VBOSize"] = UI::LineGraphWidget::create(context);
                 _lineGraphs["VBOSize"]->setPrecision(0);
 
+                _labels["DrawCalls"] = UI::Label::create(context);
+                _labels["DrawCallsValue"] = UI::Label::create(context);
+                _labels["DrawCallsValue"]->setFont(AV::Font::familyMono);
+                _lineGraphs["DrawCalls"] = UI::LineGraphWidget::create(context);
+                _lineGraphs["DrawCalls"]->setPrecision(0);
+
+                _labels["TextureUploadBandwidth"] = UI::Label::create(context);
+                _labels["TextureUploadBandwidthValue"] = UI::Label::create(context);
+                _labels["TextureUploadBandwidthValue"]->setFont(AV::Font::familyMono);
+                _lineGraphs["TextureUploadBandwidth"] = UI::LineGraphWidget::create(context);
+                _lineGraphs["TextureUploadBandwidth"]->setPrecision(0);
+
+                _labels["TextureUploadStalls"] = UI::Label::create(context);
+                _labels["TextureUploadStallsValue"] = UI::Label::create(context);
+                _labels["TextureUploadStallsValue"]->setFont(AV::Font::familyMono);
+
                 for (auto& i : _labels)
                 {
                     i.second->setTextHAlign(UI::TextHAlign::Left);
@@ -474,15 +511,48 @@ namespace djv
                 _layout->addChild(hLayout);
                 _layout->addChild(_thermometerWidgets["TextureAtlas"]);
                 hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["TextureAtlasPages"]);
+                hLayout->addChild(_labels["TextureAtlasPagesValue"]);
+                _layout->addChild(hLayout);
+                for (size_t i = 0; i < textureAtlasPageCount; ++i)
+                {
+                    std::stringstream ss;
+                    ss << "TextureAtlasPage" << i;
+                    _layout->addChild(_thermometerWidgets[ss.str()]);
+                }
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["TextureAtlasEvictions"]);
+                hLayout->addChild(_labels["TextureAtlasEvictionsValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
                 hLayout->addChild(_labels["DynamicTextureCount"]);
                 hLayout->addChild(_labels["DynamicTextureCountValue"]);
                 _layout->addChild(hLayout);
                 _layout->addChild(_lineGraphs["DynamicTextureCount"]);
                 hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["DynamicTextureCache"]);
+                hLayout->addChild(_labels["DynamicTextureCacheValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_thermometerWidgets["DynamicTextureCache"]);
+                hLayout = UI::HorizontalLayout::create(context);
                 hLayout->addChild(_labels["VBOSize"]);
                 hLayout->addChild(_labels["VBOSizeValue"]);
                 _layout->addChild(hLayout);
                 _layout->addChild(_lineGraphs["VBOSize"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["DrawCalls"]);
+                hLayout->addChild(_labels["DrawCallsValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_lineGraphs["DrawCalls"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["TextureUploadBandwidth"]);
+                hLayout->addChild(_labels["TextureUploadBandwidthValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_lineGraphs["TextureUploadBandwidth"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["TextureUploadStalls"]);
+                hLayout->addChild(_labels["TextureUploadStallsValue"]);
+                _layout->addChild(hLayout);
                 addChild(_layout);
 
                 _timer = Time::Timer::create(context);
@@ -513,12 +583,37 @@ namespace djv
             {
                 auto render = _getRender();
                 const float textureAtlasPercentage = render->getTextureAtlasPercentage();
+                const std::vector<float> textureAtlasPageOccupancy = render->getTextureAtlasPageOccupancy();
+                const size_t textureAtlasEvictionCount = render->getTextureAtlasEvictionCount();
+                const size_t textureAtlasCompactionCount = render->getTextureAtlasCompactionCount();
                 const size_t dynamicTextureCount = render->getDynamicTextureCount();
+                const size_t dynamicTextureCacheByteCount = render->getDynamicTextureCacheByteCount();
+                const size_t dynamicTextureCacheMax = render->getDynamicTextureCacheMax();
                 const size_t vboSize = render->getVBOSize();
+                const size_t primitiveCount = render->getPrimitiveCount();
+                const size_t drawCallCount = render->getDrawCallCount();
+                const size_t stateChangeCount = render->getStateChangeCount();
+                const size_t textureUploadBandwidth = render->getTextureUploadBandwidth() / Memory::megabyte;
+                const size_t textureUploadStalls = render->getTextureUploadStallCount();
 
                 _thermometerWidgets["TextureAtlas"]->setPercentage(textureAtlasPercentage);
+                for (size_t i = 0; i < textureAtlasPageOccupancy.size(); ++i)
+                {
+                    std::stringstream ss;
+                    ss << "TextureAtlasPage" << i;
+                    const auto j = _thermometerWidgets.find(ss.str());
+                    if (j != _thermometerWidgets.end())
+                    {
+                        j->second->setPercentage(textureAtlasPageOccupancy[i]);
+                    }
+                }
                 _lineGraphs["DynamicTextureCount"]->addSample(dynamicTextureCount);
+                _thermometerWidgets["DynamicTextureCache"]->setPercentage(dynamicTextureCacheMax > 0 ?
+                    (dynamicTextureCacheByteCount / static_cast<float>(dynamicTextureCacheMax) * 100.F) :
+                    0.F);
                 _lineGraphs["VBOSize"]->addSample(vboSize);
+                _lineGraphs["DrawCalls"]->addSample(drawCallCount);
+                _lineGraphs["TextureUploadBandwidth"]->addSample(textureUploadBandwidth);
 
                 {
                     std::stringstream ss;
@@ -531,6 +626,35 @@ namespace djv
                     ss << std::fixed << textureAtlasPercentage << "%";
                     _labels["TextureAtlasValue"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_atlas_pages")) << ":";
+                    _labels["TextureAtlasPages"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(0);
+                    ss << std::fixed;
+                    for (size_t i = 0; i < textureAtlasPageOccupancy.size(); ++i)
+                    {
+                        if (i > 0)
+                        {
+                            ss << " ";
+                        }
+                        ss << textureAtlasPageOccupancy[i] << "%";
+                    }
+                    _labels["TextureAtlasPagesValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_atlas_evictions")) << ":";
+                    _labels["TextureAtlasEvictions"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << textureAtlasEvictionCount << "/" << textureAtlasCompactionCount;
+                    _labels["TextureAtlasEvictionsValue"]->setText(ss.str());
+                }
                 {
                     std::stringstream ss;
                     ss << _getText(DJV_TEXT("debug_render_dynamic_texture_count")) << ":";
@@ -541,6 +665,17 @@ namespace djv
                     ss << dynamicTextureCount;
                     _labels["DynamicTextureCountValue"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_dynamic_texture_cache")) << ":";
+                    _labels["DynamicTextureCache"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << dynamicTextureCacheByteCount / Memory::megabyte << "/" <<
+                        dynamicTextureCacheMax / Memory::megabyte << "MB";
+                    _labels["DynamicTextureCacheValue"]->setText(ss.str());
+                }
                 {
                     std::stringstream ss;
                     ss << _getText(DJV_TEXT("debug_render_vbo_size")) << ":";
@@ -551,6 +686,36 @@ namespace djv
                     ss << vboSize;
                     _labels["VBOSizeValue"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_draw_calls")) << ":";
+                    _labels["DrawCalls"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << drawCallCount << "/" << primitiveCount << "/" << stateChangeCount;
+                    _labels["DrawCallsValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_upload_bandwidth")) << ":";
+                    _labels["TextureUploadBandwidth"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << textureUploadBandwidth << "MB/s";
+                    _labels["TextureUploadBandwidthValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_upload_stalls")) << ":";
+                    _labels["TextureUploadStalls"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << textureUploadStalls;
+                    _labels["TextureUploadStallsValue"]->setText(ss.str());
+                }
             }
 
             class MediaDebugWidget : public UI::Widget
@@ -579,6 +744,11 @@ namespace djv
                 size_t _videoQueueCount = 0;
                 size_t _audioQueueMax = 0;
                 size_t _audioQueueCount = 0;
+                size_t _audioUnderrunCount = 0;
+                AV::PresentationStats _presentationStats;
+                float _clockDrift = 1.F;
+                AV::IO::ThreadControllerState _threadControllerState;
+                AV::IO::CacheCompressionStats _cacheCompressionStats;
                 std::map<std::string, std::shared_ptr<UI::Label> > _labels;
                 std::map<std::string, std::shared_ptr<UI::LineGraphWidget> > _lineGraphs;
                 std::shared_ptr<UI::VerticalLayout> _layout;
@@ -589,6 +759,11 @@ namespace djv
                 std::shared_ptr<ValueObserver<size_t> > _videoQueueCountObserver;
                 std::shared_ptr<ValueObserver<size_t> > _audioQueueMaxObserver;
                 std::shared_ptr<ValueObserver<size_t> > _audioQueueCountObserver;
+                std::shared_ptr<ValueObserver<size_t> > _audioUnderrunCountObserver;
+                std::shared_ptr<ValueObserver<AV::PresentationStats> > _presentationStatsObserver;
+                std::shared_ptr<ValueObserver<float> > _clockDriftObserver;
+                std::shared_ptr<ValueObserver<AV::IO::ThreadControllerState> > _threadControllerStateObserver;
+                std::shared_ptr<ValueObserver<AV::IO::CacheCompressionStats> > _cacheCompressionStatsObserver;
             };
 
             void MediaDebugWidget::_init(const std::shared_ptr<Context>& context)
@@ -609,6 +784,46 @@ namespace djv
                 _lineGraphs["AudioQueue"] = UI::LineGraphWidget::create(context);
                 _lineGraphs["AudioQueue"]->setPrecision(0);
 
+                _labels["AudioUnderruns"] = UI::Label::create(context);
+                _labels["AudioUnderrunsValue"] = UI::Label::create(context);
+                _labels["AudioUnderrunsValue"]->setFont(AV::Font::familyMono);
+
+                _labels["Presentation"] = UI::Label::create(context);
+                _labels["PresentationValue"] = UI::Label::create(context);
+                _labels["PresentationValue"]->setFont(AV::Font::familyMono);
+
+                _labels["ClockDrift"] = UI::Label::create(context);
+                _labels["ClockDriftValue"] = UI::Label::create(context);
+                _labels["ClockDriftValue"]->setFont(AV::Font::familyMono);
+
+                _labels["Threads"] = UI::Label::create(context);
+                _labels["ThreadsValue"] = UI::Label::create(context);
+                _labels["ThreadsValue"]->setFont(AV::Font::familyMono);
+
+                _labels["DecodeTime"] = UI::Label::create(context);
+                _labels["DecodeTimeValue"] = UI::Label::create(context);
+                _labels["DecodeTimeValue"]->setFont(AV::Font::familyMono);
+
+                _labels["DecodeWait"] = UI::Label::create(context);
+                _labels["DecodeWaitValue"] = UI::Label::create(context);
+                _labels["DecodeWaitValue"]->setFont(AV::Font::familyMono);
+
+                _labels["QueueStarved"] = UI::Label::create(context);
+                _labels["QueueStarvedValue"] = UI::Label::create(context);
+                _labels["QueueStarvedValue"]->setFont(AV::Font::familyMono);
+
+                _labels["CacheCompression"] = UI::Label::create(context);
+                _labels["CacheCompressionValue"] = UI::Label::create(context);
+                _labels["CacheCompressionValue"]->setFont(AV::Font::familyMono);
+
+                _labels["CacheCompressTime"] = UI::Label::create(context);
+                _labels["CacheCompressTimeValue"] = UI::Label::create(context);
+                _labels["CacheCompressTimeValue"]->setFont(AV::Font::familyMono);
+
+                _labels["CacheDecompressTime"] = UI::Label::create(context);
+                _labels["CacheDecompressTimeValue"] = UI::Label::create(context);
+                _labels["CacheDecompressTimeValue"]->setFont(AV::Font::familyMono);
+
                 for (auto& i : _labels)
                 {
                     i.second->setTextHAlign(UI::TextHAlign::Left);
@@ -624,6 +839,46 @@ namespace djv
                 _layout->addChild(_lineGraphs["VideoQueue"]);
                 _layout->addChild(_labels["AudioQueue"]);
                 _layout->addChild(_lineGraphs["AudioQueue"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["AudioUnderruns"]);
+                hLayout->addChild(_labels["AudioUnderrunsValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["Presentation"]);
+                hLayout->addChild(_labels["PresentationValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["ClockDrift"]);
+                hLayout->addChild(_labels["ClockDriftValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["Threads"]);
+                hLayout->addChild(_labels["ThreadsValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["DecodeTime"]);
+                hLayout->addChild(_labels["DecodeTimeValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["DecodeWait"]);
+                hLayout->addChild(_labels["DecodeWaitValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["QueueStarved"]);
+                hLayout->addChild(_labels["QueueStarvedValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["CacheCompression"]);
+                hLayout->addChild(_labels["CacheCompressionValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["CacheCompressTime"]);
+                hLayout->addChild(_labels["CacheCompressTimeValue"]);
+                _layout->addChild(hLayout);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["CacheDecompressTime"]);
+                hLayout->addChild(_labels["CacheDecompressTimeValue"]);
+                _layout->addChild(hLayout);
                 addChild(_layout);
 
                 auto weak = std::weak_ptr<MediaDebugWidget>(std::dynamic_pointer_cast<MediaDebugWidget>(shared_from_this()));
@@ -704,6 +959,56 @@ namespace djv
                                         widget->_widgetUpdate();
                                     }
                                 });
+                                widget->_audioUnderrunCountObserver = ValueObserver<size_t>::create(
+                                    value->observeAudioUnderrunCount(),
+                                    [weak](size_t value)
+                                {
+                                    if (auto widget = weak.lock())
+                                    {
+                                        widget->_audioUnderrunCount = value;
+                                        widget->_widgetUpdate();
+                                    }
+                                });
+                                widget->_presentationStatsObserver = ValueObserver<AV::PresentationStats>::create(
+                                    value->observePresentationStats(),
+                                    [weak](const AV::PresentationStats& value)
+                                {
+                                    if (auto widget = weak.lock())
+                                    {
+                                        widget->_presentationStats = value;
+                                        widget->_widgetUpdate();
+                                    }
+                                });
+                                widget->_clockDriftObserver = ValueObserver<float>::create(
+                                    value->observeClockDrift(),
+                                    [weak](float value)
+                                {
+                                    if (auto widget = weak.lock())
+                                    {
+                                        widget->_clockDrift = value;
+                                        widget->_widgetUpdate();
+                                    }
+                                });
+                                widget->_threadControllerStateObserver = ValueObserver<AV::IO::ThreadControllerState>::create(
+                                    value->observeThreadControllerState(),
+                                    [weak](const AV::IO::ThreadControllerState& value)
+                                {
+                                    if (auto widget = weak.lock())
+                                    {
+                                        widget->_threadControllerState = value;
+                                        widget->_widgetUpdate();
+                                    }
+                                });
+                                widget->_cacheCompressionStatsObserver = ValueObserver<AV::IO::CacheCompressionStats>::create(
+                                    value->observeCacheCompressionStats(),
+                                    [weak](const AV::IO::CacheCompressionStats& value)
+                                {
+                                    if (auto widget = weak.lock())
+                                    {
+                                        widget->_cacheCompressionStats = value;
+                                        widget->_widgetUpdate();
+                                    }
+                                });
                             }
                             else
                             {
@@ -713,12 +1018,22 @@ namespace djv
                                 widget->_videoQueueCount = 0;
                                 widget->_audioQueueMax = 0;
                                 widget->_audioQueueCount = 0;
+                                widget->_audioUnderrunCount = 0;
+                                widget->_presentationStats = AV::PresentationStats();
+                                widget->_clockDrift = 1.F;
+                                widget->_threadControllerState = AV::IO::ThreadControllerState();
+                                widget->_cacheCompressionStats = AV::IO::CacheCompressionStats();
                                 widget->_sequenceObserver.reset();
                                 widget->_currentFrameObserver.reset();
                                 widget->_videoQueueMaxObserver.reset();
                                 widget->_videoQueueCountObserver.reset();
                                 widget->_audioQueueMaxObserver.reset();
                                 widget->_audioQueueCountObserver.reset();
+                                widget->_audioUnderrunCountObserver.reset();
+                                widget->_presentationStatsObserver.reset();
+                                widget->_clockDriftObserver.reset();
+                                widget->_threadControllerStateObserver.reset();
+                                widget->_cacheCompressionStatsObserver.reset();
                                 widget->_widgetUpdate();
                             }
                         }
@@ -774,6 +1089,112 @@ namespace djv
                     ss << _currentFrame << " / " << _sequence.getSize();
                     _labels["CurrentFrameValue"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_audio_underruns")) << ":";
+                    _labels["AudioUnderruns"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _audioUnderrunCount;
+                    _labels["AudioUnderrunsValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_presentation")) << ":";
+                    _labels["Presentation"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _presentationStats.early << " / " << _presentationStats.onTime << " / " <<
+                        _presentationStats.late << " / " << _presentationStats.dropped;
+                    _labels["PresentationValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_clock_drift")) << ":";
+                    _labels["ClockDrift"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(4);
+                    ss << std::fixed << _clockDrift;
+                    _labels["ClockDriftValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_threads")) << ":";
+                    _labels["Threads"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _threadControllerState.threadCount << " / " << _threadControllerState.queueSize;
+                    _labels["ThreadsValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_decode_time")) << ":";
+                    _labels["DecodeTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed << _threadControllerState.decodeTime * 1000.F << "ms";
+                    _labels["DecodeTimeValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_decode_wait")) << ":";
+                    _labels["DecodeWait"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << static_cast<int>(_threadControllerState.waitTime * 100.F) << "%";
+                    _labels["DecodeWaitValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_queue_starved")) << ":";
+                    _labels["QueueStarved"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _threadControllerState.starvedCount;
+                    _labels["QueueStarvedValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_cache_compression")) << ":";
+                    _labels["CacheCompression"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << _cacheCompressionStats.frameCount << " / " << std::fixed << _cacheCompressionStats.getRatio() << "x";
+                    _labels["CacheCompressionValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_cache_compress_time")) << ":";
+                    _labels["CacheCompressTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed << _cacheCompressionStats.compressTime * 1000.F << "ms";
+                    _labels["CacheCompressTimeValue"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_cache_decompress_time")) << ":";
+                    _labels["CacheDecompressTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed << _cacheCompressionStats.decompressTime * 1000.F << "ms";
+                    _labels["CacheDecompressTimeValue"]->setText(ss.str());
+                }
             }
 
         } // namespace
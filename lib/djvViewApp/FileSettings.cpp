@@ -51,6 +51,8 @@ namespace djv
             std::shared_ptr<ValueSubject<bool> > autoDetectSequences;
             std::shared_ptr<ValueSubject<bool> > cacheEnabled;
             std::shared_ptr<ValueSubject<int> > cacheMaxGB;
+            std::shared_ptr<ValueSubject<bool> > cacheAuto;
+            std::shared_ptr<ValueSubject<bool> > cacheCompression;
             std::map<std::string, BBox2f> widgetGeom;
         };
 
@@ -63,6 +65,8 @@ namespace djv
             p.autoDetectSequences = ValueSubject<bool>::create(true);
             p.cacheEnabled = ValueSubject<bool>::create(true);
             p.cacheMaxGB = ValueSubject<int>::create(4);
+            p.cacheAuto = ValueSubject<bool>::create(false);
+            p.cacheCompression = ValueSubject<bool>::create(false);
             _load();
         }
 
@@ -120,6 +124,16 @@ namespace djv
             return _p->cacheMaxGB;
         }
 
+        std::shared_ptr<IValueSubject<bool> > FileSettings::observeCacheAuto() const
+        {
+            return _p->cacheAuto;
+        }
+
+        std::shared_ptr<IValueSubject<bool> > FileSettings::observeCacheCompression() const
+        {
+            return _p->cacheCompression;
+        }
+
         void FileSettings::setCacheEnabled(bool value)
         {
             _p->cacheEnabled->setIfChanged(value);
@@ -130,6 +144,16 @@ namespace djv
             _p->cacheMaxGB->setIfChanged(value);
         }
 
+        void FileSettings::setCacheAuto(bool value)
+        {
+            _p->cacheAuto->setIfChanged(value);
+        }
+
+        void FileSettings::setCacheCompression(bool value)
+        {
+            _p->cacheCompression->setIfChanged(value);
+        }
+
         const std::map<std::string, BBox2f>& FileSettings::getWidgetGeom() const
         {
             return _p->widgetGeom;
@@ -151,6 +175,8 @@ namespace djv
                 UI::Settings::read("AutoDetectSequences", object, p.autoDetectSequences);
                 UI::Settings::read("CacheEnabled", object, p.cacheEnabled);
                 UI::Settings::read("CacheMax", object, p.cacheMaxGB);
+                UI::Settings::read("CacheAuto", object, p.cacheAuto);
+                UI::Settings::read("CacheCompression", object, p.cacheCompression);
                 UI::Settings::read("WidgetGeom", object, p.widgetGeom);
             }
         }
@@ -165,6 +191,8 @@ namespace djv
             UI::Settings::write("AutoDetectSequences", p.autoDetectSequences->get(), object);
             UI::Settings::write("CacheEnabled", p.cacheEnabled->get(), object);
             UI::Settings::write("CacheMax", p.cacheMaxGB->get(), object);
+            UI::Settings::write("CacheAuto", p.cacheAuto->get(), object);
+            UI::Settings::write("CacheCompression", p.cacheCompression->get(), object);
             UI::Settings::write("WidgetGeom", p.widgetGeom, object);
             return out;
         }
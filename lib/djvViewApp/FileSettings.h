@@ -74,8 +74,12 @@ namespace djv
 
             std::shared_ptr<Core::IValueSubject<bool> > observeCacheEnabled() const;
             std::shared_ptr<Core::IValueSubject<int> > observeCacheMaxGB() const;
+            std::shared_ptr<Core::IValueSubject<bool> > observeCacheAuto() const;
+            std::shared_ptr<Core::IValueSubject<bool> > observeCacheCompression() const;
             void setCacheEnabled(bool);
             void setCacheMaxGB(int);
+            void setCacheAuto(bool);
+            void setCacheCompression(bool);
 
             const std::map<std::string, Core::BBox2f>& getWidgetGeom() const;
             void setWidgetGeom(const std::map<std::string, Core::BBox2f>&);
@@ -48,6 +48,8 @@
 
 #include <djvCore/Context.h>
 #include <djvCore/FileInfo.h>
+#include <djvCore/Memory.h>
+#include <djvCore/OS.h>
 #include <djvCore/RecentFilesModel.h>
 #include <djvCore/TextSystem.h>
 #include <djvCore/Timer.h>
@@ -70,6 +72,10 @@ namespace djv
             std::shared_ptr<ListSubject<std::shared_ptr<Media> > > media;
             std::shared_ptr<ValueSubject<std::shared_ptr<Media> > > currentMedia;
             std::shared_ptr<ValueSubject<float> > cachePercentage;
+            std::shared_ptr<ValueSubject<size_t> > cacheBudget;
+            std::shared_ptr<ValueSubject<size_t> > residentByteCount;
+            std::shared_ptr<ValueSubject<size_t> > pressureCount;
+            Memory::CacheBudget memoryCacheBudget;
             std::map<std::string, std::shared_ptr<UI::Action> > actions;
             std::shared_ptr<UI::Menu> menu;
             std::shared_ptr<UI::FileBrowser::Dialog> fileBrowserDialog;
@@ -82,6 +88,11 @@ namespace djv
             std::shared_ptr<ValueObserver<size_t> > threadCountObserver;
             std::shared_ptr<ValueObserver<bool> > cacheEnabledObserver;
             std::shared_ptr<ValueObserver<int> > cacheMaxGBObserver;
+            std::shared_ptr<ValueObserver<bool> > cacheAutoObserver;
+            std::shared_ptr<ValueObserver<bool> > cacheCompressionObserver;
+            std::shared_ptr<ValueObserver<bool> > preservePitchObserver;
+            std::shared_ptr<ValueObserver<bool> > prerollObserver;
+            std::shared_ptr<ValueObserver<size_t> > prerollSecondsObserver;
             std::map<std::string, std::shared_ptr<ValueObserver<bool> > > actionObservers;
             std::shared_ptr<Time::Timer> cacheTimer;
         };
@@ -101,6 +112,13 @@ namespace djv
             p.media = ListSubject<std::shared_ptr<Media> >::create();
             p.currentMedia = ValueSubject<std::shared_ptr<Media> >::create();
             p.cachePercentage = ValueSubject<float>::create();
+            p.cacheBudget = ValueSubject<size_t>::create(0);
+            p.residentByteCount = ValueSubject<size_t>::create(0);
+            p.pressureCount = ValueSubject<size_t>::create(0);
+
+            const auto memoryInfo = OS::getMemoryInfo();
+            p.memoryCacheBudget.setRange(Memory::gigabyte / 4, memoryInfo.total / 4 * 3);
+            p.memoryCacheBudget.update(memoryInfo, 0);
 
             p.actions["Open"] = UI::Action::create();
             p.actions["Open"]->setIcon("djvIconFileOpen");
@@ -386,6 +404,26 @@ namespace djv
                     }
                 });
 
+            p.cacheAutoObserver = ValueObserver<bool>::create(
+                p.settings->observeCacheAuto(),
+                [weak](bool value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_cacheUpdate();
+                    }
+                });
+
+            p.cacheCompressionObserver = ValueObserver<bool>::create(
+                p.settings->observeCacheCompression(),
+                [weak](bool value)
+                {
+                    if (auto system = weak.lock())
+                    {
+                        system->_cacheUpdate();
+                    }
+                });
+
             p.actionObservers["Exit"] = ValueObserver<bool>::create(
                 p.actions["Exit"]->observeClicked(),
                 [weak, contextWeak](bool value)
@@ -416,6 +454,48 @@ namespace djv
                     }
                 });
 
+            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+            {
+                p.preservePitchObserver = ValueObserver<bool>::create(
+                    playbackSettings->observePreservePitch(),
+                    [weak](bool value)
+                    {
+                        if (auto system = weak.lock())
+                        {
+                            for (const auto& i : system->_p->media->get())
+                            {
+                                i->setPreservePitch(value);
+                            }
+                        }
+                    });
+
+                p.prerollObserver = ValueObserver<bool>::create(
+                    playbackSettings->observePreroll(),
+                    [weak](bool value)
+                    {
+                        if (auto system = weak.lock())
+                        {
+                            for (const auto& i : system->_p->media->get())
+                            {
+                                i->setPreroll(value);
+                            }
+                        }
+                    });
+
+                p.prerollSecondsObserver = ValueObserver<size_t>::create(
+                    playbackSettings->observePrerollSeconds(),
+                    [weak](size_t value)
+                    {
+                        if (auto system = weak.lock())
+                        {
+                            for (const auto& i : system->_p->media->get())
+                            {
+                                i->setPrerollSeconds(value);
+                            }
+                        }
+                    });
+            }
+
             p.cacheTimer = Time::Timer::create(context);
             p.cacheTimer->setRepeating(true);
             p.cacheTimer->start(
@@ -438,6 +518,17 @@ namespace djv
                             (cacheByteCount / static_cast<float>(cacheMaxByteCount) * 100.F) :
                             0.F;
                         system->_p->cachePercentage->setIfChanged(percentage);
+
+                        const auto memoryInfo = OS::getMemoryInfo();
+                        system->_p->residentByteCount->setIfChanged(memoryInfo.resident);
+                        auto& memoryCacheBudget = system->_p->memoryCacheBudget;
+                        memoryCacheBudget.setRange(Memory::gigabyte / 4, memoryInfo.total / 4 * 3);
+                        if (memoryCacheBudget.update(memoryInfo, cacheByteCount) &&
+                            system->_p->settings->observeCacheAuto()->get())
+                        {
+                            system->_cacheUpdate();
+                        }
+                        system->_p->pressureCount->setIfChanged(memoryCacheBudget.getPressureCount());
                     }
                 });
         }
@@ -498,6 +589,21 @@ namespace djv
             return _p->cachePercentage;
         }
 
+        std::shared_ptr<IValueSubject<size_t> > FileSystem::observeCacheBudget() const
+        {
+            return _p->cacheBudget;
+        }
+
+        std::shared_ptr<IValueSubject<size_t> > FileSystem::observeResidentByteCount() const
+        {
+            return _p->residentByteCount;
+        }
+
+        std::shared_ptr<IValueSubject<size_t> > FileSystem::observePressureCount() const
+        {
+            return _p->pressureCount;
+        }
+
         void FileSystem::open()
         {
             _showFileBrowserDialog();
@@ -646,12 +752,17 @@ namespace djv
                 }
             }
             const bool cacheEnabled = p.settings->observeCacheEnabled()->get();
-            const size_t cacheMaxByteCount = p.settings->observeCacheMaxGB()->get() * Memory::gigabyte;
+            const bool cacheCompression = p.settings->observeCacheCompression()->get();
+            const size_t cacheMaxByteCount = p.settings->observeCacheAuto()->get() ?
+                p.memoryCacheBudget.getBudget() :
+                (p.settings->observeCacheMaxGB()->get() * Memory::gigabyte);
+            p.cacheBudget->setIfChanged(cacheMaxByteCount);
             const size_t mediaCacheSizeByteCount = cacheCount > 0 ? (cacheMaxByteCount / cacheCount) : 0;
             for (const auto& i : media)
             {
                 i->setCacheEnabled(cacheEnabled);
                 i->setCacheMaxByteCount(mediaCacheSizeByteCount);
+                i->setCacheCompression(cacheCompression);
             }
         }
 
@@ -666,6 +777,9 @@ namespace djv
                 {
                     value->setPlayEveryFrame(playbackSettings->observePlayEveryFrame()->get());
                     value->setPlaybackMode(playbackSettings->observePlaybackMode()->get());
+                    value->setPreservePitch(playbackSettings->observePreservePitch()->get());
+                    value->setPreroll(playbackSettings->observePreroll()->get());
+                    value->setPrerollSeconds(playbackSettings->observePrerollSeconds()->get());
                     if (playbackSettings->observeStartPlayback()->get())
                     {
                         value->setPlayback(Playback::Forward);
@@ -71,6 +71,9 @@ namespace djv
             std::shared_ptr<Core::IListSubject<std::shared_ptr<Media> > > observeMedia() const;
             std::shared_ptr<Core::IValueSubject<std::shared_ptr<Media> > > observeCurrentMedia() const;
             std::shared_ptr<Core::IValueSubject<float> > observeCachePercentage() const;
+            std::shared_ptr<Core::IValueSubject<size_t> > observeCacheBudget() const;
+            std::shared_ptr<Core::IValueSubject<size_t> > observeResidentByteCount() const;
+            std::shared_ptr<Core::IValueSubject<size_t> > observePressureCount() const;
 
             void open();
             void open(const Core::FileSystem::FileInfo&);
@@ -41,6 +41,7 @@
 #include <djvAV/Image.h>
 #include <djvAV/OCIOSystem.h>
 #include <djvAV/Render2D.h>
+#include <djvAV/TiledImage.h>
 
 #include <djvCore/Animation.h>
 #include <djvCore/Context.h>
@@ -76,6 +77,9 @@ namespace djv
         {
             std::shared_ptr<AV::Font::System> fontSystem;
             std::shared_ptr<ValueSubject<std::shared_ptr<AV::Image::Image> > > image;
+            std::vector<std::shared_ptr<AV::Image::Image> > upcomingImages;
+            std::shared_ptr<AV::Image::TiledImage> tiledImage;
+            size_t tileReadCount = 0;
             std::shared_ptr<ValueSubject<AV::Render::ImageOptions> > imageOptions;
             AV::OCIO::Config ocioConfig;
             std::string outputColorSpace;
@@ -104,6 +108,7 @@ namespace djv
             float textWidthMax = 0.F;
             std::shared_ptr<ValueObserver<ImageViewLock> > lockObserver;
             std::shared_ptr<ValueObserver<AV::OCIO::Config> > ocioConfigObserver;
+            std::shared_ptr<ValueObserver<size_t> > colorSpacesReadyObserver;
             std::shared_ptr<Animation::Animation> zoomAnimation;
         };
 
@@ -165,7 +170,21 @@ namespace djv
                         }
                     }
                 });
-                
+
+            auto render = context->getSystemT<AV::Render::Render2D>();
+            p.colorSpacesReadyObserver = ValueObserver<size_t>::create(
+                render->observeColorSpacesReady(),
+                [weak](size_t value)
+                {
+                    if (value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_redraw();
+                        }
+                    }
+                });
+
             p.zoomAnimation = Animation::Animation::create(context);
             p.zoomAnimation->setType(Animation::Type::SmoothStep);
         }
@@ -199,6 +218,22 @@ namespace djv
             }
         }
 
+        void ImageView::setUpcomingImages(const std::vector<std::shared_ptr<AV::Image::Image> >& value)
+        {
+            _p->upcomingImages = value;
+        }
+
+        void ImageView::setTiledImage(const std::shared_ptr<AV::Image::TiledImage>& value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value == p.tiledImage)
+                return;
+            p.tiledImage = value;
+            p.tileReadCount = p.tiledImage ? p.tiledImage->getTileReadCount() : 0;
+            _resize();
+            _textUpdate();
+        }
+
         std::shared_ptr<IValueSubject<AV::Render::ImageOptions> > ImageView::observeImageOptions() const
         {
             return _p->imageOptions;
@@ -302,7 +337,7 @@ namespace djv
         void ImageView::imageFill(bool animate)
         {
             DJV_PRIVATE_PTR();
-            if (p.image->get())
+            if (p.image->get() || p.tiledImage)
             {
                 const BBox2f& g = getGeometry();
                 const auto pts = _getImagePoints();
@@ -330,7 +365,7 @@ namespace djv
         void ImageView::imageFrame(bool animate)
         {
             DJV_PRIVATE_PTR();
-            if (p.image->get())
+            if (p.image->get() || p.tiledImage)
             {
                 const BBox2f& g = getGeometry();
                 const auto pts = _getImagePoints();
@@ -353,7 +388,7 @@ namespace djv
         void ImageView::imageCenter(bool animate)
         {
             DJV_PRIVATE_PTR();
-            if (p.image->get())
+            if (p.image->get() || p.tiledImage)
             {
                 const BBox2f& g = getGeometry();
                 const glm::vec2 c = _getCenter(_getImagePoints());
@@ -441,7 +476,10 @@ namespace djv
 
             const float zoom = p.imageZoom->get();
             const glm::vec2& pos = p.imagePos->get();
-            if (auto image = p.image->get())
+            glm::vec2 imageSize(0.F, 0.F);
+            float pixelAspectRatio = 1.F;
+            std::string pluginName;
+            if (_getImageInfo(imageSize, pixelAspectRatio, pluginName))
             {
                 render->setFillColor(AV::Image::Color(1.F, 1.F, 1.F));
 
@@ -449,11 +487,11 @@ namespace djv
                 m = glm::translate(m, g.min + pos);
                 m = glm::rotate(m, Math::deg2rad(UI::getImageRotate(p.imageRotate->get())));
                 m = glm::scale(m, glm::vec2(
-                    zoom * UI::getPixelAspectRatio(p.imageAspectRatio->get(), image->getInfo().pixelAspectRatio),
-                    zoom * UI::getAspectRatioScale(p.imageAspectRatio->get(), image->getAspectRatio())));
+                    zoom * UI::getPixelAspectRatio(p.imageAspectRatio->get(), pixelAspectRatio),
+                    zoom * UI::getAspectRatioScale(p.imageAspectRatio->get(), imageSize.x / imageSize.y)));
                 render->pushTransform(m);
                 AV::Render::ImageOptions options(p.imageOptions->get());
-                auto i = p.ocioConfig.fileColorSpaces.find(image->getPluginName());
+                auto i = p.ocioConfig.fileColorSpaces.find(pluginName);
                 if (i != p.ocioConfig.fileColorSpaces.end())
                 {
                     options.colorSpace.input = i->second;
@@ -468,7 +506,15 @@ namespace djv
                 }
                 options.colorSpace.output = p.outputColorSpace;
                 options.cache = AV::Render::ImageCache::Dynamic;
-                render->drawImage(image, glm::vec2(0.F, 0.F), options);
+                if (auto image = p.image->get())
+                {
+                    render->drawImage(image, glm::vec2(0.F, 0.F), options);
+                    render->streamImages(p.upcomingImages);
+                }
+                else
+                {
+                    render->drawTiledImage(p.tiledImage, glm::vec2(0.F, 0.F), options);
+                }
                 render->popTransform();
             }
             
@@ -502,6 +548,17 @@ namespace djv
         {
             Widget::_updateEvent(event);
             DJV_PRIVATE_PTR();
+            if (p.tiledImage)
+            {
+                // Tiles are read in the background, draw again when new tiles
+                // are ready.
+                const size_t tileReadCount = p.tiledImage->getTileReadCount();
+                if (tileReadCount != p.tileReadCount)
+                {
+                    p.tileReadCount = tileReadCount;
+                    _redraw();
+                }
+            }
             if (p.fontMetricsFuture.valid() &&
                 p.fontMetricsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
             {
@@ -573,26 +630,28 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             std::vector<glm::vec3> out;
-            if (auto image = p.image->get())
+            glm::vec2 imageSize(0.F, 0.F);
+            float pixelAspectRatio = 1.F;
+            std::string pluginName;
+            if (_getImageInfo(imageSize, pixelAspectRatio, pluginName))
             {
-                const AV::Image::Size& imageSize = image->getSize();
                 glm::mat3x3 m(1.F);
                 m = glm::rotate(m, Math::deg2rad(UI::getImageRotate(p.imageRotate->get())));
                 m = glm::scale(m, glm::vec2(
-                    getPixelAspectRatio(p.imageAspectRatio->get(), image->getInfo().pixelAspectRatio),
-                    getAspectRatioScale(p.imageAspectRatio->get(), image->getAspectRatio())));
+                    getPixelAspectRatio(p.imageAspectRatio->get(), pixelAspectRatio),
+                    getAspectRatioScale(p.imageAspectRatio->get(), imageSize.x / imageSize.y)));
                 out.resize(4);
                 out[0].x = 0.F;
                 out[0].y = 0.F;
                 out[0].z = 1.F;
-                out[1].x = 0.F + imageSize.w;
+                out[1].x = 0.F + imageSize.x;
                 out[1].y = 0.F;
                 out[1].z = 1.F;
-                out[2].x = 0.F + imageSize.w;
-                out[2].y = 0.F + imageSize.h;
+                out[2].x = 0.F + imageSize.x;
+                out[2].y = 0.F + imageSize.y;
                 out[2].z = 1.F;
                 out[3].x = 0.F;
-                out[3].y = 0.F + imageSize.h;
+                out[3].y = 0.F + imageSize.y;
                 out[3].z = 1.F;
                 for (auto& i : out)
                 {
@@ -602,6 +661,29 @@ namespace djv
             return out;
         }
 
+        bool ImageView::_getImageInfo(glm::vec2& size, float& pixelAspectRatio, std::string& pluginName) const
+        {
+            DJV_PRIVATE_PTR();
+            bool out = false;
+            if (auto image = p.image->get())
+            {
+                const AV::Image::Size& imageSize = image->getSize();
+                size = glm::vec2(imageSize.w, imageSize.h);
+                pixelAspectRatio = image->getInfo().pixelAspectRatio;
+                pluginName = image->getPluginName();
+                out = imageSize.w > 0 && imageSize.h > 0;
+            }
+            else if (p.tiledImage)
+            {
+                const auto& info = p.tiledImage->getInfo();
+                size = glm::vec2(info.width, info.height);
+                pixelAspectRatio = info.pixelAspectRatio;
+                pluginName = p.tiledImage->getPluginName();
+                out = info.width > 0 && info.height > 0;
+            }
+            return out;
+        }
+
         glm::vec2 ImageView::_getCenter(const std::vector<glm::vec3>& value)
         {
             glm::vec2 out(0.F, 0.F);
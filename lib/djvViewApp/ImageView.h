@@ -45,6 +45,7 @@ namespace djv
         namespace Image
         {
             class Image;
+            class TiledImage;
     
         } // namespace Image
 
@@ -91,6 +92,13 @@ namespace djv
             std::shared_ptr<Core::IValueSubject<std::shared_ptr<AV::Image::Image> > > observeImage() const;
             void setImage(const std::shared_ptr<AV::Image::Image>&);
 
+            //! Set the images that will be displayed next so their textures can
+            //! be uploaded ahead of time.
+            void setUpcomingImages(const std::vector<std::shared_ptr<AV::Image::Image> >&);
+
+            //! Set a tiled image to display when there is no image.
+            void setTiledImage(const std::shared_ptr<AV::Image::TiledImage>&);
+
             std::shared_ptr<Core::IValueSubject<AV::Render::ImageOptions> > observeImageOptions() const;
             void setImageOptions(const AV::Render::ImageOptions&);
 
@@ -129,6 +137,7 @@ namespace djv
             void _updateEvent(Core::Event::Update&) override;
 
         private:
+            bool _getImageInfo(glm::vec2& size, float& pixelAspectRatio, std::string& pluginName) const;
             std::vector<glm::vec3> _getImagePoints() const;
             static glm::vec2 _getCenter(const std::vector<glm::vec3>&);
             static Core::BBox2f _getBBox(const std::vector<glm::vec3>&);
@@ -32,6 +32,9 @@
 #include <djvViewApp/Annotate.h>
 
 #include <djvAV/AVSystem.h>
+#include <djvAV/AudioResampler.h>
+#include <djvAV/AudioRingBuffer.h>
+#include <djvAV/PlaybackClock.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/LogSystem.h>
@@ -39,6 +42,11 @@
 
 #include <RtAudio.h>
 
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
 using namespace djv::Core;
 
 namespace djv
@@ -49,7 +57,13 @@ namespace djv
         {
             //! \todo Should this be configurable?
             const size_t audioBufferFrameCount = 256;
+            const float  audioRingBufferTime   = .5F;
             const size_t videoQueueSize        = 10;
+            const size_t upcomingImagesMax     = 4;
+            const float  prerollTimeout        = 1.F;
+
+            //! Single images larger than this are opened as tiled images.
+            const uint32_t tiledImageSizeMin   = 8192;
             
         } // namespace
 
@@ -70,12 +84,21 @@ namespace djv
             std::shared_ptr<ValueSubject<Frame::Sequence> > sequence;
             std::shared_ptr<ValueSubject<Frame::Index> > currentFrame;
             std::shared_ptr<ValueSubject<std::shared_ptr<AV::Image::Image> > > currentImage;
+            std::shared_ptr<ListSubject<std::shared_ptr<AV::Image::Image> > > upcomingImages;
+            std::shared_ptr<ValueSubject<std::shared_ptr<AV::Image::TiledImage> > > tiledImage;
             std::shared_ptr<ValueSubject<Playback> > playback;
             std::shared_ptr<ValueSubject<PlaybackMode> > playbackMode;
             std::shared_ptr<ValueSubject<AV::IO::InOutPoints> > inOutPoints;
+            std::shared_ptr<ValueSubject<bool> > preroll;
+            std::shared_ptr<ValueSubject<size_t> > prerollSeconds;
+            std::shared_ptr<ValueSubject<bool> > prerolling;
+            std::shared_ptr<ValueSubject<float> > prerollProgress;
+            std::shared_ptr<ValueSubject<float> > decodeThroughput;
+            std::shared_ptr<ValueSubject<bool> > realtimeWarning;
             std::shared_ptr<ValueSubject<bool> > audioEnabled;
             std::shared_ptr<ValueSubject<float> > volume;
             std::shared_ptr<ValueSubject<bool> > mute;
+            std::shared_ptr<ValueSubject<bool> > preservePitch;
             std::shared_ptr<ValueSubject<size_t> > threadCount;
             std::shared_ptr<ValueSubject<Frame::Sequence> > cacheSequence;
             std::shared_ptr<ValueSubject<Frame::Sequence> > cachedFrames;
@@ -85,19 +108,32 @@ namespace djv
             std::shared_ptr<ValueSubject<size_t> > videoQueueCount;
             std::shared_ptr<ValueSubject<size_t> > audioQueueMax;
             std::shared_ptr<ValueSubject<size_t> > audioQueueCount;
+            std::shared_ptr<ValueSubject<size_t> > audioUnderrunCount;
+            std::shared_ptr<ValueSubject<AV::PresentationStats> > presentationStats;
+            std::shared_ptr<ValueSubject<float> > clockDrift;
+            std::shared_ptr<ValueSubject<AV::IO::ThreadControllerState> > threadControllerState;
+            std::shared_ptr<ValueSubject<AV::IO::CacheCompressionStats> > cacheCompressionStats;
             std::shared_ptr<AV::IO::IRead> read;
 
             AV::IO::Direction ioDirection = AV::IO::Direction::Forward;
             std::unique_ptr<RtAudio> rtAudio;
+            std::shared_ptr<AV::Audio::Resampler> audioResampler;
+            std::shared_ptr<AV::Audio::RingBuffer> audioRingBuffer;
             std::shared_ptr<AV::Audio::Data> audioData;
             size_t audioDataSamplesOffset = 0;
-            size_t audioDataSamplesCount = 0;
-            Time::Unit audioDataSamplesTime = Time::Unit::zero();
+            std::atomic<size_t> audioDataSamplesCount{ 0 };
+            std::atomic<size_t> audioUnderruns{ 0 };
+            std::atomic<std::chrono::steady_clock::rep> audioCallbackTime{ 0 };
+            size_t audioLatency = 0;
+            std::shared_ptr<AV::PlaybackClock> clock;
             Frame::Index frameOffset = 0;
-            Time::Unit currentTime = Time::Unit::zero();
+            Frame::Index presentedFrame = Frame::invalid;
             size_t realSpeedFrameCount = 0;
             Time::Unit playEveryFrameTime = Time::Unit::zero();
+            bool prerollSkip = false;
+            std::chrono::steady_clock::time_point prerollTime;
             std::shared_ptr<Time::Timer> playbackTimer;
+            std::shared_ptr<Time::Timer> prerollTimer;
             std::shared_ptr<Time::Timer> queueTimer;
             std::shared_ptr<Time::Timer> realSpeedTimer;
             std::shared_ptr<Time::Timer> cacheTimer;
@@ -122,12 +158,21 @@ namespace djv
             p.sequence = ValueSubject<Frame::Sequence>::create();
             p.currentFrame = ValueSubject<Frame::Index>::create(Frame::invalid);
             p.currentImage = ValueSubject<std::shared_ptr<AV::Image::Image> >::create();
+            p.upcomingImages = ListSubject<std::shared_ptr<AV::Image::Image> >::create();
+            p.tiledImage = ValueSubject<std::shared_ptr<AV::Image::TiledImage> >::create();
             p.playback = ValueSubject<Playback>::create(Playback::First);
             p.playbackMode = ValueSubject<PlaybackMode>::create(PlaybackMode::First);
             p.inOutPoints = ValueSubject<AV::IO::InOutPoints>::create();
+            p.preroll = ValueSubject<bool>::create(false);
+            p.prerollSeconds = ValueSubject<size_t>::create(2);
+            p.prerolling = ValueSubject<bool>::create(false);
+            p.prerollProgress = ValueSubject<float>::create(0.F);
+            p.decodeThroughput = ValueSubject<float>::create(0.F);
+            p.realtimeWarning = ValueSubject<bool>::create(false);
             p.volume = ValueSubject<float>::create(1.F);
             p.audioEnabled = ValueSubject<bool>::create(false);
             p.mute = ValueSubject<bool>::create(false);
+            p.preservePitch = ValueSubject<bool>::create(false);
             p.threadCount = ValueSubject<size_t>::create(4);
             p.cacheSequence = ValueSubject<Frame::Sequence>::create();
             p.cachedFrames = ValueSubject<Frame::Sequence>::create();
@@ -137,9 +182,18 @@ namespace djv
             p.audioQueueMax = ValueSubject<size_t>::create();
             p.videoQueueCount = ValueSubject<size_t>::create();
             p.audioQueueCount = ValueSubject<size_t>::create();
+            p.audioUnderrunCount = ValueSubject<size_t>::create();
+            p.presentationStats = ValueSubject<AV::PresentationStats>::create();
+            p.clockDrift = ValueSubject<float>::create(1.F);
+            p.threadControllerState = ValueSubject<AV::IO::ThreadControllerState>::create();
+            p.cacheCompressionStats = ValueSubject<AV::IO::CacheCompressionStats>::create();
+
+            p.clock = AV::PlaybackClock::create();
 
             p.playbackTimer = Time::Timer::create(context);
             p.playbackTimer->setRepeating(true);
+            p.prerollTimer = Time::Timer::create(context);
+            p.prerollTimer->setRepeating(true);
             p.queueTimer = Time::Timer::create(context);
             p.queueTimer->setRepeating(true);
             p.realSpeedTimer = Time::Timer::create(context);
@@ -262,6 +316,16 @@ namespace djv
             return _p->currentImage;
         }
 
+        std::shared_ptr<IListSubject<std::shared_ptr<AV::Image::Image> > > Media::observeUpcomingImages() const
+        {
+            return _p->upcomingImages;
+        }
+
+        std::shared_ptr<IValueSubject<std::shared_ptr<AV::Image::TiledImage> > > Media::observeTiledImage() const
+        {
+            return _p->tiledImage;
+        }
+
         std::shared_ptr<IValueSubject<Time::Speed> > Media::observeSpeed() const
         {
             return _p->speed;
@@ -307,6 +371,11 @@ namespace djv
             return _p->inOutPoints;
         }
 
+        double Media::getPlaybackTime() const
+        {
+            return _p->clock->getTime(std::chrono::steady_clock::now());
+        }
+
         void Media::setSpeed(const Time::Speed& value)
         {
             DJV_PRIVATE_PTR();
@@ -506,6 +575,59 @@ namespace djv
             setInOutPoints(AV::IO::InOutPoints(enabled, value.getIn(), size > 0 ? (static_cast<Frame::Index>(size) - 1) : 0));
         }
 
+        std::shared_ptr<IValueSubject<bool> > Media::observePreroll() const
+        {
+            return _p->preroll;
+        }
+
+        std::shared_ptr<IValueSubject<size_t> > Media::observePrerollSeconds() const
+        {
+            return _p->prerollSeconds;
+        }
+
+        std::shared_ptr<IValueSubject<bool> > Media::observePrerolling() const
+        {
+            return _p->prerolling;
+        }
+
+        std::shared_ptr<IValueSubject<float> > Media::observePrerollProgress() const
+        {
+            return _p->prerollProgress;
+        }
+
+        std::shared_ptr<IValueSubject<float> > Media::observeDecodeThroughput() const
+        {
+            return _p->decodeThroughput;
+        }
+
+        std::shared_ptr<IValueSubject<bool> > Media::observeRealtimeWarning() const
+        {
+            return _p->realtimeWarning;
+        }
+
+        void Media::setPreroll(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.preroll->setIfChanged(value))
+            {
+                if (!value && p.prerolling->get())
+                {
+                    p.prerollTimer->stop();
+                    p.prerolling->setIfChanged(false);
+                    if (p.read)
+                    {
+                        p.read->setPlayback(true);
+                    }
+                    _playbackStart();
+                }
+            }
+        }
+
+        void Media::setPrerollSeconds(size_t value)
+        {
+            _p->prerollSeconds->setIfChanged(value);
+        }
+
         std::shared_ptr<IValueSubject<bool> > Media::observeAudioEnabled() const
         {
             return _p->audioEnabled;
@@ -526,11 +648,29 @@ namespace djv
             _p->volume->setIfChanged(Math::clamp(value, 0.F, 1.F));
         }
 
+        std::shared_ptr<IValueSubject<bool> > Media::observePreservePitch() const
+        {
+            return _p->preservePitch;
+        }
+
         void Media::setMute(bool value)
         {
             _p->mute->setIfChanged(value);
         }
 
+        void Media::setPreservePitch(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.preservePitch->setIfChanged(value))
+            {
+                _seek(p.currentFrame->get());
+                if (_hasAudioSyncPlayback())
+                {
+                    _startAudioStream();
+                }
+            }
+        }
+
         std::shared_ptr<IValueSubject<size_t> > Media::observeThreadCount() const
         {
             return _p->threadCount;
@@ -592,6 +732,19 @@ namespace djv
             {
                 p.read->setCacheMaxByteCount(value);
             }
+            if (auto tiledImage = p.tiledImage->get())
+            {
+                tiledImage->setTileCacheMax(value);
+            }
+        }
+
+        void Media::setCacheCompression(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.read)
+            {
+                p.read->setCacheCompression(value);
+            }
         }
             
         std::shared_ptr<Core::IListSubject<std::shared_ptr<AnnotatePrimitive> > > Media::observeAnnotations() const
@@ -629,6 +782,31 @@ namespace djv
             return _p->audioQueueCount;
         }
 
+        std::shared_ptr<IValueSubject<size_t> > Media::observeAudioUnderrunCount() const
+        {
+            return _p->audioUnderrunCount;
+        }
+
+        std::shared_ptr<IValueSubject<AV::PresentationStats> > Media::observePresentationStats() const
+        {
+            return _p->presentationStats;
+        }
+
+        std::shared_ptr<IValueSubject<float> > Media::observeClockDrift() const
+        {
+            return _p->clockDrift;
+        }
+
+        std::shared_ptr<IValueSubject<AV::IO::ThreadControllerState> > Media::observeThreadControllerState() const
+        {
+            return _p->threadControllerState;
+        }
+
+        std::shared_ptr<IValueSubject<AV::IO::CacheCompressionStats> > Media::observeCacheCompressionStats() const
+        {
+            return _p->cacheCompressionStats;
+        }
+
         bool Media::_hasAudio() const
         {
             DJV_PRIVATE_PTR();
@@ -638,11 +816,20 @@ namespace djv
         bool Media::_isAudioEnabled() const
         {
             DJV_PRIVATE_PTR();
+            const float audioSpeed = _getAudioSpeed();
             return _hasAudio() &&
-                p.speed->get() == p.defaultSpeed->get() &&
+                audioSpeed >= AV::Audio::resamplerSpeedMin &&
+                audioSpeed <= AV::Audio::resamplerSpeedMax &&
                 !p.playEveryFrame->get();
         }
 
+        float Media::_getAudioSpeed() const
+        {
+            DJV_PRIVATE_PTR();
+            const float defaultSpeed = p.defaultSpeed->get().toFloat();
+            return defaultSpeed > 0.F ? (p.speed->get().toFloat() / defaultSpeed) : 0.F;
+        }
+
         bool Media::_hasAudioSyncPlayback() const
         {
             DJV_PRIVATE_PTR();
@@ -661,10 +848,52 @@ namespace djv
                     options.layer = p.layer->get();
                     options.videoQueueSize = videoQueueSize;
                     auto io = context->getSystemT<AV::IO::System>();
-                    p.read = io->read(p.fileInfo, options);
-                    p.read->setThreadCount(p.threadCount->get());
-                    
-                    const auto info = p.read->getInfo().get();
+
+                    // Large single images are opened as tiled images so that
+                    // only the visible tiles are read.
+                    std::shared_ptr<AV::Image::TiledImage> tiledImage;
+                    if (!p.fileInfo.isSequenceValid())
+                    {
+                        try
+                        {
+                            tiledImage = io->readTiled(p.fileInfo, options);
+                        }
+                        catch (const std::exception&)
+                        {}
+                        if (tiledImage &&
+                            tiledImage->getInfo().width < tiledImageSizeMin &&
+                            tiledImage->getInfo().height < tiledImageSizeMin)
+                        {
+                            tiledImage.reset();
+                        }
+                    }
+
+                    p.decodeThroughput->setIfChanged(0.F);
+                    p.realtimeWarning->setIfChanged(false);
+
+                    AV::IO::Info info;
+                    if (tiledImage)
+                    {
+                        p.read.reset();
+                        const auto& tiledInfo = tiledImage->getInfo();
+                        AV::Image::Info imageInfo(
+                            static_cast<uint16_t>(std::min(tiledInfo.width, static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()))),
+                            static_cast<uint16_t>(std::min(tiledInfo.height, static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()))),
+                            tiledInfo.type,
+                            tiledInfo.layout);
+                        imageInfo.name = tiledInfo.name;
+                        imageInfo.pixelAspectRatio = tiledInfo.pixelAspectRatio;
+                        info.fileName = p.fileInfo.getFileName();
+                        info.video.push_back(AV::IO::VideoInfo(imageInfo));
+                        info.tags = tiledImage->getTags();
+                    }
+                    else
+                    {
+                        p.read = io->read(p.fileInfo, options);
+                        p.read->setThreadCount(p.threadCount->get());
+                        info = p.read->getInfo().get();
+                    }
+                    p.tiledImage->setIfChanged(tiledImage);
                     p.info->setIfChanged(info);
                     Time::Speed speed;
                     Frame::Sequence sequence;
@@ -712,6 +941,13 @@ namespace djv
                         RtAudio::StreamParameters rtParameters;
                         rtParameters.deviceId = p.rtAudio->getDefaultOutputDevice();
                         rtParameters.nChannels = p.audioInfo.info.channelCount;
+                        p.audioResampler = AV::Audio::Resampler::create(
+                            p.audioInfo.info.channelCount,
+                            p.audioInfo.info.type);
+                        p.audioRingBuffer = AV::Audio::RingBuffer::create(
+                            p.audioInfo.info.channelCount,
+                            p.audioInfo.info.type,
+                            static_cast<size_t>(p.audioInfo.info.sampleRate * audioRingBufferTime));
                         unsigned int rtBufferFrames = audioBufferFrameCount;
                         try
                         {
@@ -725,6 +961,7 @@ namespace djv
                                 this,
                                 nullptr,
                                 _rtAudioErrorCallback);
+                            p.audioLatency = p.rtAudio->getStreamLatency();
                         }
                         catch (const std::exception& e)
                         {
@@ -786,6 +1023,11 @@ namespace djv
                                         media->_p->audioQueueMax->setAlways(audioQueueMax);
                                         media->_p->audioQueueCount->setAlways(audioQueueCount);
                                     }
+                                    media->_p->audioUnderrunCount->setIfChanged(media->_p->audioUnderruns.load());
+                                    media->_p->presentationStats->setIfChanged(media->_p->clock->getPresentationStats());
+                                    media->_p->clockDrift->setIfChanged(media->_p->clock->getDrift());
+                                    media->_p->threadControllerState->setIfChanged(media->_p->read->getThreadControllerState());
+                                    media->_p->cacheCompressionStats->setIfChanged(media->_p->read->getCacheCompressionStats());
                                 }
                             }
                         });
@@ -822,15 +1064,19 @@ namespace djv
                         break;
                     case PlaybackMode::Loop:
                     {
+                        p.prerollSkip = true;
                         setPlayback(Playback::Stop);
                         setCurrentFrame(range.min);
                         setPlayback(Playback::Forward);
+                        p.prerollSkip = false;
                         break;
                     }
                     case PlaybackMode::PingPong:
                     {
+                        p.prerollSkip = true;
                         setPlayback(Playback::Stop);
                         setPlayback(Playback::Reverse);
+                        p.prerollSkip = false;
                         break;
                     }
                     default: break;
@@ -856,15 +1102,19 @@ namespace djv
                         break;
                     case PlaybackMode::Loop:
                     {
+                        p.prerollSkip = true;
                         setPlayback(Playback::Stop);
                         setCurrentFrame(range.max);
                         setPlayback(Playback::Reverse);
+                        p.prerollSkip = false;
                         break;
                     }
                     case PlaybackMode::PingPong:
                     {
+                        p.prerollSkip = true;
                         setPlayback(Playback::Stop);
                         setPlayback(Playback::Forward);
+                        p.prerollSkip = false;
                         break;
                     }
                     default: break;
@@ -896,12 +1146,19 @@ namespace djv
                 p.audioData.reset();
                 p.audioDataSamplesOffset = 0;
                 p.audioDataSamplesCount = 0;
-                p.audioDataSamplesTime = Time::Unit::zero();
                 p.frameOffset = p.currentFrame->get();
-                p.currentTime = Time::Unit::zero();
                 p.realSpeedFrameCount = 0;
                 p.playEveryFrameTime = Time::Unit::zero();
                 _stopAudioStream();
+                if (p.audioResampler)
+                {
+                    p.audioResampler->reset();
+                }
+                if (p.audioRingBuffer)
+                {
+                    p.audioRingBuffer->clear();
+                }
+                p.clock->start(std::chrono::steady_clock::now());
             }
         }
 
@@ -921,54 +1178,27 @@ namespace djv
                     _stopAudioStream();
                     p.playbackTimer->stop();
                     p.realSpeedTimer->stop();
+                    p.prerollTimer->stop();
+                    p.prerolling->setIfChanged(false);
                     _seek(p.currentFrame->get());
                     break;
                 case Playback::Forward:
                     forward = true;
                 case Playback::Reverse: // Forward or reverse.
                 {
-                    if (p.read)
-                    {
-                        p.read->setPlayback(true);
-                    }
                     p.ioDirection = forward ? AV::IO::Direction::Forward : AV::IO::Direction::Reverse;
-                    _seek(p.currentFrame->get());
-                    p.audioData.reset();
-                    p.audioDataSamplesOffset = 0;
-                    p.audioDataSamplesCount = 0;
-                    p.audioDataSamplesTime = Time::Unit::zero();
-                    p.frameOffset = p.currentFrame->get();
-                    p.currentTime = Time::Unit::zero();
-                    p.realSpeedFrameCount = 0;
-                    p.playEveryFrameTime = Time::Unit::zero();
-                    if (_hasAudioSyncPlayback())
+                    if (_isPrerollEnabled())
                     {
-                        _startAudioStream();
+                        _prerollStart();
                     }
-                    auto weak = std::weak_ptr<Media>(std::dynamic_pointer_cast<Media>(shared_from_this()));
-                    p.playbackTimer->start(
-                        Time::getTime(Time::TimerValue::VeryFast),
-                        [weak](const std::chrono::steady_clock::time_point&, const Time::Unit& dt)
+                    else
                     {
-                        if (auto media = weak.lock())
+                        if (p.read)
                         {
-                            media->_p->currentTime += dt;
-                            media->_p->playEveryFrameTime += dt;
-                            media->_playbackTick();
+                            p.read->setPlayback(true);
                         }
-                    });
-                    p.realSpeedTimer->start(
-                        Time::getTime(Time::TimerValue::Slow),
-                        [weak](const std::chrono::steady_clock::time_point&, const Time::Unit& dt)
-                        {
-                            if (auto media = weak.lock())
-                            {
-                                const auto delta = std::chrono::duration<float>(dt).count();
-                                media->_p->realSpeed->setIfChanged(delta > 0.F ? (media->_p->realSpeedFrameCount / delta) : 0.F);
-                                //std::cout << dt.count() << ", " << media->_p->realSpeedFrameCount << std::endl;
-                                media->_p->realSpeedFrameCount = 0;
-                            }
-                        });
+                        _playbackStart();
+                    }
                     break;
                 }
                 default: break;
@@ -976,6 +1206,47 @@ namespace djv
             }
         }
 
+        void Media::_playbackStart()
+        {
+            DJV_PRIVATE_PTR();
+            _seek(p.currentFrame->get());
+            p.audioData.reset();
+            p.audioDataSamplesOffset = 0;
+            p.audioDataSamplesCount = 0;
+            p.frameOffset = p.currentFrame->get();
+            p.realSpeedFrameCount = 0;
+            p.playEveryFrameTime = Time::Unit::zero();
+            p.clock->start(std::chrono::steady_clock::now());
+            p.clock->resetPresentationStats();
+            if (_hasAudioSyncPlayback())
+            {
+                _startAudioStream();
+            }
+            auto weak = std::weak_ptr<Media>(std::dynamic_pointer_cast<Media>(shared_from_this()));
+            p.playbackTimer->start(
+                Time::getTime(Time::TimerValue::VeryFast),
+                [weak](const std::chrono::steady_clock::time_point&, const Time::Unit& dt)
+            {
+                if (auto media = weak.lock())
+                {
+                    media->_p->playEveryFrameTime += dt;
+                    media->_playbackTick();
+                }
+            });
+            p.realSpeedTimer->start(
+                Time::getTime(Time::TimerValue::Slow),
+                [weak](const std::chrono::steady_clock::time_point&, const Time::Unit& dt)
+                {
+                    if (auto media = weak.lock())
+                    {
+                        const auto delta = std::chrono::duration<float>(dt).count();
+                        media->_p->realSpeed->setIfChanged(delta > 0.F ? (media->_p->realSpeedFrameCount / delta) : 0.F);
+                        //std::cout << dt.count() << ", " << media->_p->realSpeedFrameCount << std::endl;
+                        media->_p->realSpeedFrameCount = 0;
+                    }
+                });
+        }
+
         void Media::_playbackTick()
         {
             DJV_PRIVATE_PTR();
@@ -986,16 +1257,19 @@ namespace djv
             case Playback::Reverse:
             {
                 const auto& speed = p.speed->get();
+                const auto now = std::chrono::steady_clock::now();
                 if (_hasAudioSyncPlayback())
                 {
-                    if (p.audioDataSamplesCount)
+                    p.clock->setAudio(p.audioInfo.info.sampleRate, p.audioLatency);
+                    const size_t samples = p.audioDataSamplesCount;
+                    if (samples)
                     {
-                        Frame::Index frame = p.frameOffset +
-                            Time::scale(
-                                p.audioDataSamplesCount,
-                                Math::Rational(1, static_cast<int>(p.audioInfo.info.sampleRate)),
-                                speed.swap()) +
-                            std::chrono::duration<float>(p.audioDataSamplesTime).count() * speed.toFloat();
+                        // The callback time is stored before the sample count, so
+                        // it is never older than the count.
+                        p.clock->setAudioSamples(
+                            samples,
+                            std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(p.audioCallbackTime.load())));
+                        const Frame::Index frame = p.frameOffset + p.clock->getTime(now) * speed.toFloat();
                         _setCurrentFrame(frame);
                     }
                 }
@@ -1004,7 +1278,8 @@ namespace djv
                 }
                 else
                 {
-                    Frame::Index elapsed = std::chrono::duration<float>(p.currentTime).count() * speed.toFloat();
+                    p.clock->setAudio(0, 0);
+                    const Frame::Index elapsed = p.clock->getTime(now) * speed.toFloat();
                     Frame::Index frame = Frame::invalid;
                     switch (playback)
                     {
@@ -1020,6 +1295,129 @@ namespace djv
             }
         }
 
+        bool Media::_isPrerollEnabled() const
+        {
+            DJV_PRIVATE_PTR();
+            return p.preroll->get() &&
+                !p.prerollSkip &&
+                p.read &&
+                p.read->hasCache() &&
+                p.read->isCacheEnabled();
+        }
+
+        void Media::_prerollStart()
+        {
+            DJV_PRIVATE_PTR();
+
+            // Let the cache use all of the threads while playback is waiting.
+            p.read->setPlayback(false);
+            _seek(p.currentFrame->get());
+            p.prerollTime = std::chrono::steady_clock::now();
+            p.decodeThroughput->setIfChanged(0.F);
+            p.prerollProgress->setIfChanged(0.F);
+            p.prerolling->setIfChanged(true);
+            _prerollTick();
+            if (p.prerolling->get())
+            {
+                auto weak = std::weak_ptr<Media>(std::dynamic_pointer_cast<Media>(shared_from_this()));
+                p.prerollTimer->start(
+                    Time::getTime(Time::TimerValue::Fast),
+                    [weak](const std::chrono::steady_clock::time_point&, const Time::Unit&)
+                    {
+                        if (auto media = weak.lock())
+                        {
+                            media->_prerollTick();
+                        }
+                    });
+            }
+        }
+
+        void Media::_prerollTick()
+        {
+            DJV_PRIVATE_PTR();
+            const auto now = std::chrono::steady_clock::now();
+            const float elapsed = std::chrono::duration<float>(now - p.prerollTime).count();
+            const float speed = p.speed->get().toFloat();
+            const size_t sequenceSize = p.sequence->get().getSize();
+            const auto range = p.inOutPoints->get().getRange(sequenceSize);
+            const size_t rangeSize = range.max >= range.min ? static_cast<size_t>(range.max - range.min + 1) : 0;
+            const size_t targetMax = std::min(
+                rangeSize,
+                static_cast<size_t>(std::max(std::ceil(p.prerollSeconds->get() * speed), 1.F)));
+
+            // Walk from the current frame in the playback direction, stopping
+            // at the end of the frames the cache can hold.
+            const Frame::Sequence cacheSequence = p.read ? p.read->getCacheSequence() : Frame::Sequence();
+            const Frame::Sequence cachedFrames = p.read ? p.read->getCachedFrames() : Frame::Sequence();
+            size_t targetCount = 0;
+            size_t cachedCount = 0;
+            Frame::Index frame = p.currentFrame->get();
+            for (; targetCount < targetMax && cacheSequence.contains(frame); ++targetCount)
+            {
+                if (cachedFrames.contains(frame))
+                {
+                    ++cachedCount;
+                }
+                frame += AV::IO::Direction::Forward == p.ioDirection ? 1 : -1;
+                if (frame > range.max)
+                {
+                    frame = range.min;
+                }
+                else if (frame < range.min)
+                {
+                    frame = range.max;
+                }
+            }
+
+            // The pre-roll uses all of the threads, so the rate the cache
+            // fills is higher than playback can sustain. The throughput is
+            // measured instead from the decode time of a frame and the number
+            // of threads the reader uses during playback.
+            if (p.read)
+            {
+                const auto state = p.read->getThreadControllerState();
+                if (state.decodeTime > 0.F)
+                {
+                    p.decodeThroughput->setIfChanged(state.threadMax / state.decodeTime);
+                }
+            }
+            p.prerollProgress->setIfChanged(targetCount > 0 ? (cachedCount / static_cast<float>(targetCount)) : 0.F);
+
+            // The cache sequence is not known until the read thread has run,
+            // so an empty target only finishes the pre-roll after a timeout.
+            const bool done =
+                (targetCount > 0 && cachedCount >= targetCount) ||
+                (0 == targetCount && elapsed > prerollTimeout) ||
+                !p.read;
+            if (done)
+            {
+                // Realtime playback is not guaranteed when the in/out range
+                // does not fit in the cache and decoding is slower than the
+                // playback speed.
+                const bool rangeCached = targetCount > 0 && targetCount == rangeSize;
+                const float throughput = p.decodeThroughput->get();
+                const bool realtimeWarning = !rangeCached && throughput > 0.F && throughput < speed;
+                if (p.realtimeWarning->setIfChanged(realtimeWarning) && realtimeWarning)
+                {
+                    if (auto context = p.context.lock())
+                    {
+                        std::stringstream ss;
+                        ss << p.fileInfo.getFileName() << ": " << DJV_TEXT("playback_realtime_warning") <<
+                            " (" << std::fixed << std::setprecision(2) << throughput << "/" << speed << ")";
+                        auto logSystem = context->getSystemT<LogSystem>();
+                        logSystem->log("djv::ViewApp::Media", ss.str(), LogLevel::Warning);
+                    }
+                }
+                p.prerollTimer->stop();
+                p.prerolling->setIfChanged(false);
+                if (p.read)
+                {
+                    p.read->setPlayback(true);
+                }
+                _playbackStart();
+            }
+        }
+
         void Media::_startAudioStream()
         {
             DJV_PRIVATE_PTR();
@@ -1075,6 +1473,7 @@ namespace djv
                 const Frame::Index currentFrame = p.currentFrame->get();
                 AV::IO::VideoFrame frame;
                 bool gotFrame = false;
+                std::vector<std::shared_ptr<AV::Image::Image> > upcomingImages;
                 {
                     std::lock_guard<std::mutex> lock(p.read->getMutex());
                     auto& queue = p.read->getVideoQueue();
@@ -1095,6 +1494,12 @@ namespace djv
                                 (queue.getFrame().frame < currentFrame) :
                                 (queue.getFrame().frame > currentFrame)))
                         {
+                            // Only the frames that are skipped over are
+                            // dropped, the last frame popped is shown.
+                            if (gotFrame && playback != Playback::Stop && frame.frame != p.presentedFrame)
+                            {
+                                p.clock->addDropped();
+                            }
                             frame = queue.popFrame();
                             gotFrame = true;
                             p.realSpeedFrameCount = p.realSpeedFrameCount + 1;
@@ -1104,10 +1509,33 @@ namespace djv
                     {
                         frame = queue.getFrame();
                     }
+                    for (const auto& i : queue.getFrames(upcomingImagesMax + 1))
+                    {
+                        if (i.image && i.image != frame.image && upcomingImages.size() < upcomingImagesMax)
+                        {
+                            upcomingImages.push_back(i.image);
+                        }
+                    }
                 }
+                p.upcomingImages->setIfChanged(upcomingImages);
                 if (frame.image)
                 {
-                    p.currentImage->setIfChanged(frame.image);
+                    if (p.currentImage->setIfChanged(frame.image))
+                    {
+                        p.presentedFrame = frame.frame;
+                        if (playback != Playback::Stop && !p.playEveryFrame->get())
+                        {
+                            // Compare the presentation time with when the frame
+                            // was due on the playback clock.
+                            const float speed = p.speed->get().toFloat();
+                            const Frame::Index frames = Playback::Forward == playback ?
+                                (frame.frame - p.frameOffset) :
+                                (p.frameOffset - frame.frame);
+                            p.clock->addPresentation(
+                                p.clock->getTime(std::chrono::steady_clock::now()) - frames / speed,
+                                1.0 / speed);
+                        }
+                    }
                     if (p.playEveryFrame->get())
                     {
                         _setCurrentFrame(frame.frame);
@@ -1115,7 +1543,11 @@ namespace djv
                 }
 
                 // Update the audio queue.
-                if (_hasAudio() && !_hasAudioSyncPlayback())
+                if (_hasAudioSyncPlayback())
+                {
+                    _audioUpdate();
+                }
+                else if (_hasAudio())
                 {
                     std::lock_guard<std::mutex> lock(p.read->getMutex());
                     auto& queue = p.read->getAudioQueue();
@@ -1126,6 +1558,50 @@ namespace djv
                 }
             }
         }
+
+        void Media::_audioUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (!p.audioRingBuffer)
+                return;
+
+            // Move the audio from the read queue to the ring buffer. The frames
+            // are released here instead of in the audio callback. When the
+            // playback speed is different from the default speed the audio is
+            // resampled on the way.
+            const size_t sampleByteCount = p.audioInfo.info.channelCount * AV::Audio::getByteCount(p.audioInfo.info.type);
+            const float audioSpeed = _getAudioSpeed();
+            while (p.audioRingBuffer->getWriteAvailable() > 0)
+            {
+                if (!p.audioData)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(p.read->getMutex());
+                        auto& queue = p.read->getAudioQueue();
+                        if (queue.isEmpty())
+                            break;
+                        p.audioData = queue.popFrame().audio;
+                    }
+                    p.audioDataSamplesOffset = 0;
+                    if (!p.audioData)
+                        continue;
+                    if (audioSpeed != 1.F && p.audioResampler)
+                    {
+                        p.audioResampler->setSpeed(audioSpeed);
+                        p.audioResampler->setPreservePitch(p.preservePitch->get());
+                        p.audioData = p.audioResampler->process(p.audioData);
+                    }
+                }
+                p.audioDataSamplesOffset += p.audioRingBuffer->write(
+                    p.audioData->getData() + p.audioDataSamplesOffset * sampleByteCount,
+                    p.audioData->getSampleCount() - p.audioDataSamplesOffset);
+                if (p.audioDataSamplesOffset >= p.audioData->getSampleCount())
+                {
+                    p.audioData.reset();
+                    p.audioDataSamplesOffset = 0;
+                }
+            }
+        }
         
         int Media::_rtAudioCallback(
             void* outputBuffer,
@@ -1135,92 +1611,32 @@ namespace djv
             RtAudioStreamStatus status,
             void* userData)
         {
+            // This function runs on the real-time audio thread, so it only copies
+            // from the ring buffer and does not lock or allocate.
             Media* media = reinterpret_cast<Media*>(userData);
             const auto& info = media->_p->audioInfo;
-
-            size_t outputSampleCount = static_cast<size_t>(nFrames);
-            size_t sampleCount = 0;
             const size_t sampleByteCount = info.info.channelCount * AV::Audio::getByteCount(info.info.type);
             const float volume = !media->_p->mute->get() ? media->_p->volume->get() : 0.F;
 
-            if (media->_p->audioData)
+            uint8_t* p = reinterpret_cast<uint8_t*>(outputBuffer);
+            size_t sampleCount = 0;
+            if (media->_p->audioRingBuffer)
             {
-                sampleCount += media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset;
+                sampleCount = media->_p->audioRingBuffer->read(p, nFrames, volume);
             }
-
-            // Get audio frames from the read queue.
-            std::vector<AV::IO::AudioFrame> frames;
+            media->_p->audioCallbackTime = std::chrono::steady_clock::now().time_since_epoch().count();
+            if (sampleCount < nFrames)
             {
-                std::lock_guard<std::mutex> lock(media->_p->read->getMutex());
-                auto& queue = media->_p->read->getAudioQueue();
-                while (!queue.isEmpty() && sampleCount < outputSampleCount)
-                {
-                    auto frame = queue.getFrame();
-                    frames.push_back(frame);
-                    queue.popFrame();
-                    sampleCount += frame.audio->getSampleCount();
-                }
-            }
+                //! \todo Is this the correct way to clear the audio data?
+                memset(p + sampleCount * sampleByteCount, 0, (nFrames - sampleCount) * sampleByteCount);
 
-            // Use the remaining data from the frame.
-            uint8_t* p = reinterpret_cast<uint8_t*>(outputBuffer);
-            if (media->_p->audioData)
-            {
-                const size_t size = std::min(
-                    media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset,
-                    outputSampleCount);
-                //memcpy(
-                //    p,
-                //    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                //    size * sampleByteCount);
-                AV::Audio::Data::volume(
-                    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                    p,
-                    volume,
-                    size,
-                    info.info.channelCount,
-                    info.info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset += size;
-                media->_p->audioDataSamplesCount += size;
-                media->_p->audioDataSamplesTime = Time::Unit::zero();
-                outputSampleCount -= size;
-                if (media->_p->audioDataSamplesOffset >= media->_p->audioData->getSampleCount())
+                // Don't count the start of playback before any audio is ready.
+                if (media->_p->audioDataSamplesCount > 0)
                 {
-                    media->_p->audioData.reset();
-                    media->_p->audioDataSamplesOffset = 0;
+                    ++media->_p->audioUnderruns;
                 }
             }
-
-            // Process the frames.
-            for (const auto& i : frames)
-            {
-                media->_p->audioData = i.audio;
-                size_t size = std::min(i.audio->getSampleCount(), outputSampleCount);
-                //memcpy(
-                //    p,
-                //    i.audio->getData(),
-                //    size * sampleByteCount);
-                AV::Audio::Data::volume(
-                    i.audio->getData(),
-                    p,
-                    volume,
-                    size,
-                    info.info.channelCount,
-                    info.info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset = size;
-                media->_p->audioDataSamplesCount += size;
-                media->_p->audioDataSamplesTime = Time::Unit::zero();
-                outputSampleCount -= size;
-            }
-
-            const size_t zero = (nFrames * sampleByteCount) - (p - reinterpret_cast<uint8_t*>(outputBuffer));
-            if (zero)
-            {
-                //! \todo Is this the correct way to clear the audio data?
-                memset(p, 0, zero);
-            }
+            media->_p->audioDataSamplesCount += sampleCount;
 
             return 0;
         }
@@ -32,6 +32,7 @@
 #include <djvViewApp/Enum.h>
 
 #include <djvAV/IO.h>
+#include <djvAV/PlaybackClock.h>
 
 #include <djvCore/ListObserver.h>
 #include <djvCore/ValueObserver.h>
@@ -102,6 +103,13 @@ namespace djv
 
             std::shared_ptr<Core::IValueSubject<std::shared_ptr<AV::Image::Image> > > observeCurrentImage() const;
 
+            //! Observe the images that will be displayed after the current image.
+            std::shared_ptr<Core::IListSubject<std::shared_ptr<AV::Image::Image> > > observeUpcomingImages() const;
+
+            //! Observe the tiled image. Large single images are opened as
+            //! tiled images instead of being read in full.
+            std::shared_ptr<Core::IValueSubject<std::shared_ptr<AV::Image::TiledImage> > > observeTiledImage() const;
+
             ///@}
 
             //! \name Playback
@@ -117,6 +125,10 @@ namespace djv
             std::shared_ptr<Core::IValueSubject<PlaybackMode> > observePlaybackMode() const;
             std::shared_ptr<Core::IValueSubject<AV::IO::InOutPoints> > observeInOutPoints() const;
 
+            //! Get the playback clock time in seconds since playback started
+            //! or the last seek. This can be queried when the view is drawn.
+            double getPlaybackTime() const;
+
             void setSpeed(const Core::Time::Speed&);
             void setPlayEveryFrame(bool);
             void setCurrentFrame(Core::Frame::Index, bool inOutPoints = true);
@@ -136,16 +148,49 @@ namespace djv
 
             ///@}
 
+            //! \name Pre-roll
+            ///@{
+
+            std::shared_ptr<Core::IValueSubject<bool> > observePreroll() const;
+            std::shared_ptr<Core::IValueSubject<size_t> > observePrerollSeconds() const;
+            std::shared_ptr<Core::IValueSubject<bool> > observePrerolling() const;
+
+            //! Observe the pre-roll progress (0.0 - 1.0).
+            std::shared_ptr<Core::IValueSubject<float> > observePrerollProgress() const;
+
+            //! Observe the decode throughput in frames per second that playback
+            //! can sustain, measured while pre-rolling. It is reset when
+            //! pre-rolling starts and when the file is opened.
+            std::shared_ptr<Core::IValueSubject<float> > observeDecodeThroughput() const;
+
+            //! Observe whether decoding is too slow to maintain realtime
+            //! playback.
+            std::shared_ptr<Core::IValueSubject<bool> > observeRealtimeWarning() const;
+
+            //! Set whether playback waits for the memory cache to fill before
+            //! starting.
+            void setPreroll(bool);
+
+            //! Set the number of seconds to cache before playback starts.
+            void setPrerollSeconds(size_t);
+
+            ///@}
+
             //! \name Audio
             ///@{
 
             std::shared_ptr<Core::IValueSubject<bool> > observeAudioEnabled() const;
             std::shared_ptr<Core::IValueSubject<float> > observeVolume() const;
             std::shared_ptr<Core::IValueSubject<bool> > observeMute() const;
+            std::shared_ptr<Core::IValueSubject<bool> > observePreservePitch() const;
 
             void setVolume(float);
             void setMute(bool);
 
+            //! Set whether the audio pitch is preserved when the playback speed
+            //! is different from the default speed.
+            void setPreservePitch(bool);
+
             ///@}
 
             //! \name I/O
@@ -168,6 +213,7 @@ namespace djv
 
             void setCacheEnabled(bool);
             void setCacheMaxByteCount(size_t);
+            void setCacheCompression(bool);
 
             ///@}
 
@@ -188,21 +234,32 @@ namespace djv
             std::shared_ptr<Core::IValueSubject<size_t> > observeAudioQueueMax() const;
             std::shared_ptr<Core::IValueSubject<size_t> > observeVideoQueueCount() const;
             std::shared_ptr<Core::IValueSubject<size_t> > observeAudioQueueCount() const;
+            std::shared_ptr<Core::IValueSubject<size_t> > observeAudioUnderrunCount() const;
+            std::shared_ptr<Core::IValueSubject<AV::PresentationStats> > observePresentationStats() const;
+            std::shared_ptr<Core::IValueSubject<float> > observeClockDrift() const;
+            std::shared_ptr<Core::IValueSubject<AV::IO::ThreadControllerState> > observeThreadControllerState() const;
+            std::shared_ptr<Core::IValueSubject<AV::IO::CacheCompressionStats> > observeCacheCompressionStats() const;
 
             ///@}
 
         private:
             bool _hasAudio() const;
+            float _getAudioSpeed() const;
             bool _isAudioEnabled() const;
             bool _hasAudioSyncPlayback() const;
             void _open();
             void _setCurrentFrame(Core::Frame::Index);
             void _seek(Core::Frame::Index);
             void _playbackUpdate();
+            void _playbackStart();
             void _playbackTick();
+            bool _isPrerollEnabled() const;
+            void _prerollStart();
+            void _prerollTick();
             void _startAudioStream();
             void _stopAudioStream();
             void _queueUpdate();
+            void _audioUpdate();
 
             static int _rtAudioCallback(
                 void* outputBuffer,
@@ -105,6 +105,9 @@ namespace djv
             Time::Speed defaultSpeed;
             Time::Speed speed;
             float realSpeed = 0.F;
+            bool prerolling = false;
+            float prerollProgress = 0.F;
+            bool realtimeWarning = false;
             bool playEveryFrame = false;
             PlaybackMode playbackMode = PlaybackMode::First;
             Frame::Sequence sequence;
@@ -162,9 +165,14 @@ namespace djv
             std::shared_ptr<ValueObserver<bool> > currentFrameChangeObserver;
             std::shared_ptr<ValueObserver<AV::TimeUnits> > timeUnitsObserver;
             std::shared_ptr<ValueObserver<std::shared_ptr<AV::Image::Image> > > imageObserver;
+            std::shared_ptr<ListObserver<std::shared_ptr<AV::Image::Image> > > upcomingImagesObserver;
+            std::shared_ptr<ValueObserver<std::shared_ptr<AV::Image::TiledImage> > > tiledImageObserver;
             std::shared_ptr<ValueObserver<Time::Speed> > speedObserver;
             std::shared_ptr<ValueObserver<Time::Speed> > defaultSpeedObserver;
             std::shared_ptr<ValueObserver<float> > realSpeedObserver;
+            std::shared_ptr<ValueObserver<bool> > prerollingObserver;
+            std::shared_ptr<ValueObserver<float> > prerollProgressObserver;
+            std::shared_ptr<ValueObserver<bool> > realtimeWarningObserver;
             std::shared_ptr<ValueObserver<bool> > playEveryFrameObserver;
             std::shared_ptr<ValueObserver<PlaybackMode> > playbackModeObserver;
             std::shared_ptr<ValueObserver<Frame::Sequence> > sequenceObserver;
@@ -806,6 +814,26 @@ namespace djv
                     }
                 });
 
+            p.upcomingImagesObserver = ListObserver<std::shared_ptr<AV::Image::Image> >::create(
+                p.media->observeUpcomingImages(),
+                [weak](const std::vector<std::shared_ptr<AV::Image::Image> >& value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->imageView->setUpcomingImages(value);
+                    }
+                });
+
+            p.tiledImageObserver = ValueObserver<std::shared_ptr<AV::Image::TiledImage> >::create(
+                p.media->observeTiledImage(),
+                [weak](const std::shared_ptr<AV::Image::TiledImage>& value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->imageView->setTiledImage(value);
+                    }
+                });
+
             p.speedObserver = ValueObserver<Time::Speed>::create(
                 p.media->observeSpeed(),
                 [weak](const Time::Speed& value)
@@ -841,6 +869,39 @@ namespace djv
                     }
                 });
 
+            p.prerollingObserver = ValueObserver<bool>::create(
+                p.media->observePrerolling(),
+                [weak](bool value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->prerolling = value;
+                        widget->_realSpeedUpdate();
+                    }
+                });
+
+            p.prerollProgressObserver = ValueObserver<float>::create(
+                p.media->observePrerollProgress(),
+                [weak](float value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->prerollProgress = value;
+                        widget->_realSpeedUpdate();
+                    }
+                });
+
+            p.realtimeWarningObserver = ValueObserver<bool>::create(
+                p.media->observeRealtimeWarning(),
+                [weak](bool value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->realtimeWarning = value;
+                        widget->_realSpeedUpdate();
+                    }
+                });
+
             p.playEveryFrameObserver = ValueObserver<bool>::create(
                 p.media->observePlayEveryFrame(),
                 [weak](bool value)
@@ -1262,7 +1323,7 @@ namespace djv
             p.closeButton->setTooltip(_getText(DJV_TEXT("widget_media_close_tooltip")));
 
             p.speedPopupWidget->setTooltip(_getText(DJV_TEXT("playback_speed_popup_tooltip")));
-            p.realSpeedLabel->setTooltip(_getText(DJV_TEXT("playback_real_speed_tooltip")));
+            _realSpeedUpdate();
             p.currentFrameWidget->setTooltip(_getText(DJV_TEXT("playback_current_frame_tooltip")));
             p.inPointWidget->setTooltip(_getText(DJV_TEXT("playback_in_point_tooltip")));
             p.inPointSetButton->setTooltip(_getText(DJV_TEXT("playback_set_in_point_tooltip")));
@@ -1372,9 +1433,27 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             std::stringstream ss;
-            ss.precision(2);
-            ss << std::fixed << p.realSpeed;
+            if (p.prerolling)
+            {
+                ss << _getText(DJV_TEXT("playback_preroll")) << ": " <<
+                    static_cast<int>(p.prerollProgress * 100.F) << "%";
+            }
+            else
+            {
+                ss.precision(2);
+                ss << std::fixed << p.realSpeed;
+                if (p.realtimeWarning)
+                {
+                    ss << " !";
+                }
+            }
             p.realSpeedLabel->setText(ss.str());
+            std::string tooltip = _getText(DJV_TEXT("playback_real_speed_tooltip"));
+            if (p.realtimeWarning)
+            {
+                tooltip += "\n" + _getText(DJV_TEXT("playback_realtime_warning"));
+            }
+            p.realSpeedLabel->setTooltip(tooltip);
         }
 
         void MediaWidget::_audioUpdate()
@@ -39,6 +39,7 @@
 #include <djvUI/SettingsSystem.h>
 
 #include <djvCore/Context.h>
+#include <djvCore/Memory.h>
 #include <djvCore/OS.h>
 
 using namespace djv::Core;
@@ -50,18 +51,34 @@ namespace djv
         struct MemoryCacheWidget::Private
         {
             float percentageUsed = 0.F;
+            size_t cacheBudget = 0;
+            size_t residentByteCount = 0;
+            size_t pressureCount = 0;
 
             std::shared_ptr<UI::Label> titleLabel;
             std::shared_ptr<UI::CheckBox> enabledCheckBox;
+            std::shared_ptr<UI::CheckBox> autoCheckBox;
+            std::shared_ptr<UI::CheckBox> compressionCheckBox;
             std::shared_ptr<UI::IntSlider> maxGBSlider;
             std::shared_ptr<UI::Label> maxGBLabel;
             std::shared_ptr<UI::Label> percentageLabel;
             std::shared_ptr<UI::Label> percentageLabel2;
+            std::shared_ptr<UI::Label> budgetLabel;
+            std::shared_ptr<UI::Label> budgetLabel2;
+            std::shared_ptr<UI::Label> residentLabel;
+            std::shared_ptr<UI::Label> residentLabel2;
+            std::shared_ptr<UI::Label> pressureLabel;
+            std::shared_ptr<UI::Label> pressureLabel2;
             std::shared_ptr<UI::VerticalLayout> layout;
 
             std::shared_ptr<ValueObserver<bool> > enabledObserver;
             std::shared_ptr<ValueObserver<int> > maxGBObserver;
+            std::shared_ptr<ValueObserver<bool> > autoObserver;
+            std::shared_ptr<ValueObserver<bool> > compressionObserver;
             std::shared_ptr<ValueObserver<float> > percentageObserver;
+            std::shared_ptr<ValueObserver<size_t> > cacheBudgetObserver;
+            std::shared_ptr<ValueObserver<size_t> > residentByteCountObserver;
+            std::shared_ptr<ValueObserver<size_t> > pressureCountObserver;
         };
 
         void MemoryCacheWidget::_init(const std::shared_ptr<Core::Context>& context)
@@ -76,6 +93,8 @@ namespace djv
             p.titleLabel->setBackgroundRole(UI::ColorRole::Trough);
 
             p.enabledCheckBox = UI::CheckBox::create(context);
+            p.autoCheckBox = UI::CheckBox::create(context);
+            p.compressionCheckBox = UI::CheckBox::create(context);
 
             p.maxGBSlider = UI::IntSlider::create(context);
             p.maxGBSlider->setRange(IntRange(1, OS::getRAMSize() / Memory::gigabyte));
@@ -86,6 +105,18 @@ namespace djv
             p.percentageLabel->setTextHAlign(UI::TextHAlign::Left);
             p.percentageLabel2 = UI::Label::create(context);
             p.percentageLabel2->setFont(AV::Font::familyMono);
+            p.budgetLabel = UI::Label::create(context);
+            p.budgetLabel->setTextHAlign(UI::TextHAlign::Left);
+            p.budgetLabel2 = UI::Label::create(context);
+            p.budgetLabel2->setFont(AV::Font::familyMono);
+            p.residentLabel = UI::Label::create(context);
+            p.residentLabel->setTextHAlign(UI::TextHAlign::Left);
+            p.residentLabel2 = UI::Label::create(context);
+            p.residentLabel2->setFont(AV::Font::familyMono);
+            p.pressureLabel = UI::Label::create(context);
+            p.pressureLabel->setTextHAlign(UI::TextHAlign::Left);
+            p.pressureLabel2 = UI::Label::create(context);
+            p.pressureLabel2->setFont(AV::Font::familyMono);
 
             p.layout = UI::VerticalLayout::create(context);
             p.layout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::None));
@@ -94,6 +125,8 @@ namespace djv
             auto vLayout = UI::VerticalLayout::create(context);
             vLayout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::None));
             vLayout->addChild(p.enabledCheckBox);
+            vLayout->addChild(p.autoCheckBox);
+            vLayout->addChild(p.compressionCheckBox);
             auto hLayout = UI::HorizontalLayout::create(context);
             hLayout->setMargin(UI::Layout::Margin(UI::MetricsRole::MarginSmall));
             hLayout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::SpacingSmall));
@@ -107,6 +140,24 @@ namespace djv
             hLayout->addChild(p.percentageLabel);
             hLayout->addChild(p.percentageLabel2);
             vLayout->addChild(hLayout);
+            hLayout = UI::HorizontalLayout::create(context);
+            hLayout->setMargin(UI::Layout::Margin(UI::MetricsRole::MarginSmall));
+            hLayout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::SpacingSmall));
+            hLayout->addChild(p.budgetLabel);
+            hLayout->addChild(p.budgetLabel2);
+            vLayout->addChild(hLayout);
+            hLayout = UI::HorizontalLayout::create(context);
+            hLayout->setMargin(UI::Layout::Margin(UI::MetricsRole::MarginSmall));
+            hLayout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::SpacingSmall));
+            hLayout->addChild(p.residentLabel);
+            hLayout->addChild(p.residentLabel2);
+            vLayout->addChild(hLayout);
+            hLayout = UI::HorizontalLayout::create(context);
+            hLayout->setMargin(UI::Layout::Margin(UI::MetricsRole::MarginSmall));
+            hLayout->setSpacing(UI::Layout::Spacing(UI::MetricsRole::SpacingSmall));
+            hLayout->addChild(p.pressureLabel);
+            hLayout->addChild(p.pressureLabel2);
+            vLayout->addChild(hLayout);
             p.layout->addChild(vLayout);
             addChild(p.layout);
 
@@ -123,6 +174,30 @@ namespace djv
                         }
                     }
                 });
+            p.autoCheckBox->setCheckedCallback(
+                [contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                        if (auto fileSettings = settingsSystem->getSettingsT<FileSettings>())
+                        {
+                            fileSettings->setCacheAuto(value);
+                        }
+                    }
+                });
+            p.compressionCheckBox->setCheckedCallback(
+                [contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                        if (auto fileSettings = settingsSystem->getSettingsT<FileSettings>())
+                        {
+                            fileSettings->setCacheCompression(value);
+                        }
+                    }
+                });
             p.maxGBSlider->setValueCallback(
                 [contextWeak](int value)
                 {
@@ -160,6 +235,27 @@ namespace djv
                             widget->_p->maxGBSlider->setValue(value);
                         }
                     });
+
+                p.autoObserver = ValueObserver<bool>::create(
+                    fileSettings->observeCacheAuto(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->autoCheckBox->setChecked(value);
+                            widget->_p->maxGBSlider->setEnabled(!value);
+                        }
+                    });
+
+                p.compressionObserver = ValueObserver<bool>::create(
+                    fileSettings->observeCacheCompression(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->compressionCheckBox->setChecked(value);
+                        }
+                    });
             }
 
             if (auto fileSystem = context->getSystemT<FileSystem>())
@@ -174,6 +270,39 @@ namespace djv
                             widget->_widgetUpdate();
                         }
                     });
+
+                p.cacheBudgetObserver = ValueObserver<size_t>::create(
+                    fileSystem->observeCacheBudget(),
+                    [weak](size_t value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->cacheBudget = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
+
+                p.residentByteCountObserver = ValueObserver<size_t>::create(
+                    fileSystem->observeResidentByteCount(),
+                    [weak](size_t value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->residentByteCount = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
+
+                p.pressureCountObserver = ValueObserver<size_t>::create(
+                    fileSystem->observePressureCount(),
+                    [weak](size_t value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->pressureCount = value;
+                            widget->_widgetUpdate();
+                        }
+                    });
             }
         }
 
@@ -214,11 +343,19 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.titleLabel->setText(_getText(DJV_TEXT("memory_cache")));
             p.enabledCheckBox->setText(_getText(DJV_TEXT("memory_cache_enable")));
+            p.autoCheckBox->setText(_getText(DJV_TEXT("memory_cache_automatic")));
+            p.compressionCheckBox->setText(_getText(DJV_TEXT("memory_cache_compress")));
             p.maxGBLabel->setText(_getText(DJV_TEXT("memory_cache_gigabytes_label")));
             p.percentageLabel->setText(_getText(DJV_TEXT("memory_cache_used")) + ":");
             std::stringstream ss;
             ss << static_cast<int>(p.percentageUsed) << "%";
             p.percentageLabel2->setText(ss.str());
+            p.budgetLabel->setText(_getText(DJV_TEXT("memory_cache_budget")) + ":");
+            p.budgetLabel2->setText(Memory::getSizeLabel(p.cacheBudget));
+            p.residentLabel->setText(_getText(DJV_TEXT("memory_cache_resident")) + ":");
+            p.residentLabel2->setText(Memory::getSizeLabel(p.residentByteCount));
+            p.pressureLabel->setText(_getText(DJV_TEXT("memory_cache_pressure_events")) + ":");
+            p.pressureLabel2->setText(std::to_string(p.pressureCount));
         }
 
     } // namespace ViewApp
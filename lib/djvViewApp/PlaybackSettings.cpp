@@ -46,7 +46,12 @@ namespace djv
             std::shared_ptr<ValueSubject<bool> > startPlayback;
             std::shared_ptr<ValueSubject<bool> > playEveryFrame;
             std::shared_ptr<ValueSubject<PlaybackMode> > playbackMode;
+            std::shared_ptr<ValueSubject<bool> > preservePitch;
+            std::shared_ptr<ValueSubject<bool> > preroll;
+            std::shared_ptr<ValueSubject<size_t> > prerollSeconds;
             std::shared_ptr<ValueSubject<bool> > pip;
+            std::shared_ptr<ValueSubject<bool> > waveform;
+            std::shared_ptr<ValueSubject<bool> > waveformDiskCache;
         };
 
         void PlaybackSettings::_init(const std::shared_ptr<Core::Context>& context)
@@ -57,7 +62,12 @@ namespace djv
             p.startPlayback = ValueSubject<bool>::create(false);
             p.playEveryFrame = ValueSubject<bool>::create(false);
             p.playbackMode = ValueSubject<PlaybackMode>::create(PlaybackMode::Loop);
+            p.preservePitch = ValueSubject<bool>::create(false);
+            p.preroll = ValueSubject<bool>::create(false);
+            p.prerollSeconds = ValueSubject<size_t>::create(2);
             p.pip = ValueSubject<bool>::create(true);
+            p.waveform = ValueSubject<bool>::create(true);
+            p.waveformDiskCache = ValueSubject<bool>::create(false);
             _load();
         }
 
@@ -102,6 +112,36 @@ namespace djv
             _p->playbackMode->setIfChanged(value);
         }
 
+        std::shared_ptr<IValueSubject<bool> > PlaybackSettings::observePreservePitch() const
+        {
+            return _p->preservePitch;
+        }
+
+        void PlaybackSettings::setPreservePitch(bool value)
+        {
+            _p->preservePitch->setIfChanged(value);
+        }
+
+        std::shared_ptr<IValueSubject<bool> > PlaybackSettings::observePreroll() const
+        {
+            return _p->preroll;
+        }
+
+        void PlaybackSettings::setPreroll(bool value)
+        {
+            _p->preroll->setIfChanged(value);
+        }
+
+        std::shared_ptr<IValueSubject<size_t> > PlaybackSettings::observePrerollSeconds() const
+        {
+            return _p->prerollSeconds;
+        }
+
+        void PlaybackSettings::setPrerollSeconds(size_t value)
+        {
+            _p->prerollSeconds->setIfChanged(value);
+        }
+
         std::shared_ptr<IValueSubject<bool> > PlaybackSettings::observePIP() const
         {
             return _p->pip;
@@ -112,6 +152,26 @@ namespace djv
             _p->pip->setIfChanged(value);
         }
 
+        std::shared_ptr<IValueSubject<bool> > PlaybackSettings::observeWaveform() const
+        {
+            return _p->waveform;
+        }
+
+        void PlaybackSettings::setWaveform(bool value)
+        {
+            _p->waveform->setIfChanged(value);
+        }
+
+        std::shared_ptr<IValueSubject<bool> > PlaybackSettings::observeWaveformDiskCache() const
+        {
+            return _p->waveformDiskCache;
+        }
+
+        void PlaybackSettings::setWaveformDiskCache(bool value)
+        {
+            _p->waveformDiskCache->setIfChanged(value);
+        }
+
         void PlaybackSettings::load(const picojson::value & value)
         {
             if (value.is<picojson::object>())
@@ -121,7 +181,12 @@ namespace djv
                 UI::Settings::read("StartPlayback", object, p.startPlayback);
                 UI::Settings::read("PlayEveryFrame", object, p.playEveryFrame);
                 UI::Settings::read("PlaybackMode", object, p.playbackMode);
+                UI::Settings::read("PreservePitch", object, p.preservePitch);
+                UI::Settings::read("Preroll", object, p.preroll);
+                UI::Settings::read("PrerollSeconds", object, p.prerollSeconds);
                 UI::Settings::read("PIP", object, p.pip);
+                UI::Settings::read("Waveform", object, p.waveform);
+                UI::Settings::read("WaveformDiskCache", object, p.waveformDiskCache);
             }
         }
 
@@ -133,7 +198,12 @@ namespace djv
             UI::Settings::write("StartPlayback", p.startPlayback->get(), object);
             UI::Settings::write("PlayEveryFrame", p.playEveryFrame->get(), object);
             UI::Settings::write("PlaybackMode", p.playbackMode->get(), object);
+            UI::Settings::write("PreservePitch", p.preservePitch->get(), object);
+            UI::Settings::write("Preroll", p.preroll->get(), object);
+            UI::Settings::write("PrerollSeconds", p.prerollSeconds->get(), object);
             UI::Settings::write("PIP", p.pip->get(), object);
+            UI::Settings::write("Waveform", p.waveform->get(), object);
+            UI::Settings::write("WaveformDiskCache", p.waveformDiskCache->get(), object);
             return out;
         }
 
@@ -61,9 +61,24 @@ namespace djv
             std::shared_ptr<Core::IValueSubject<PlaybackMode> > observePlaybackMode() const;
             void setPlaybackMode(PlaybackMode);
 
+            std::shared_ptr<Core::IValueSubject<bool> > observePreservePitch() const;
+            void setPreservePitch(bool);
+
+            std::shared_ptr<Core::IValueSubject<bool> > observePreroll() const;
+            void setPreroll(bool);
+
+            std::shared_ptr<Core::IValueSubject<size_t> > observePrerollSeconds() const;
+            void setPrerollSeconds(size_t);
+
             std::shared_ptr<Core::IValueSubject<bool> > observePIP() const;
             void setPIP(bool);
 
+            std::shared_ptr<Core::IValueSubject<bool> > observeWaveform() const;
+            void setWaveform(bool);
+
+            std::shared_ptr<Core::IValueSubject<bool> > observeWaveformDiskCache() const;
+            void setWaveformDiskCache(bool);
+
             void load(const picojson::value &) override;
             picojson::value save() override;
 
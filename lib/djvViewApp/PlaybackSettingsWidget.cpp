@@ -33,6 +33,7 @@
 
 #include <djvUI/CheckBox.h>
 #include <djvUI/FormLayout.h>
+#include <djvUI/IntSlider.h>
 #include <djvUI/RowLayout.h>
 #include <djvUI/SettingsSystem.h>
 
@@ -50,8 +51,15 @@ namespace djv
         struct PlaybackSettingsWidget::Private
         {
             std::shared_ptr<UI::CheckBox> startPlaybackButton;
+            std::shared_ptr<UI::CheckBox> preservePitchButton;
+            std::shared_ptr<UI::CheckBox> prerollButton;
+            std::shared_ptr<UI::IntSlider> prerollSecondsSlider;
+            std::shared_ptr<UI::FormLayout> prerollLayout;
             std::shared_ptr<UI::VerticalLayout> layout;
             std::shared_ptr<ValueObserver<bool> > startPlaybackObserver;
+            std::shared_ptr<ValueObserver<bool> > preservePitchObserver;
+            std::shared_ptr<ValueObserver<bool> > prerollObserver;
+            std::shared_ptr<ValueObserver<size_t> > prerollSecondsObserver;
         };
 
         void PlaybackSettingsWidget::_init(const std::shared_ptr<Context>& context)
@@ -62,9 +70,18 @@ namespace djv
             setClassName("djv::ViewApp::PlaybackSettingsWidget");
 
             p.startPlaybackButton = UI::CheckBox::create(context);
+            p.preservePitchButton = UI::CheckBox::create(context);
+            p.prerollButton = UI::CheckBox::create(context);
+            p.prerollSecondsSlider = UI::IntSlider::create(context);
+            p.prerollSecondsSlider->setRange(IntRange(1, 30));
 
             p.layout = UI::VerticalLayout::create(context);
             p.layout->addChild(p.startPlaybackButton);
+            p.layout->addChild(p.preservePitchButton);
+            p.layout->addChild(p.prerollButton);
+            p.prerollLayout = UI::FormLayout::create(context);
+            p.prerollLayout->addChild(p.prerollSecondsSlider);
+            p.layout->addChild(p.prerollLayout);
             addChild(p.layout);
 
             auto weak = std::weak_ptr<PlaybackSettingsWidget>(std::dynamic_pointer_cast<PlaybackSettingsWidget>(shared_from_this()));
@@ -85,6 +102,54 @@ namespace djv
                     }
                 });
 
+            p.preservePitchButton->setCheckedCallback(
+                [weak, contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+                            {
+                                playbackSettings->setPreservePitch(value);
+                            }
+                        }
+                    }
+                });
+
+            p.prerollButton->setCheckedCallback(
+                [weak, contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+                            {
+                                playbackSettings->setPreroll(value);
+                            }
+                        }
+                    }
+                });
+
+            p.prerollSecondsSlider->setValueCallback(
+                [weak, contextWeak](int value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+                            {
+                                playbackSettings->setPrerollSeconds(static_cast<size_t>(value));
+                            }
+                        }
+                    }
+                });
+
             auto settingsSystem = context->getSystemT<UI::Settings::System>();
             if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
             {
@@ -97,6 +162,37 @@ namespace djv
                             widget->_p->startPlaybackButton->setChecked(value);
                         }
                     });
+
+                p.preservePitchObserver = ValueObserver<bool>::create(
+                    playbackSettings->observePreservePitch(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->preservePitchButton->setChecked(value);
+                        }
+                    });
+
+                p.prerollObserver = ValueObserver<bool>::create(
+                    playbackSettings->observePreroll(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->prerollButton->setChecked(value);
+                            widget->_p->prerollSecondsSlider->setEnabled(value);
+                        }
+                    });
+
+                p.prerollSecondsObserver = ValueObserver<size_t>::create(
+                    playbackSettings->observePrerollSeconds(),
+                    [weak](size_t value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->prerollSecondsSlider->setValue(static_cast<int>(value));
+                        }
+                    });
             }
         }
 
@@ -131,13 +227,20 @@ namespace djv
             ISettingsWidget::_initEvent(event);
             DJV_PRIVATE_PTR();
             p.startPlaybackButton->setText(_getText(DJV_TEXT("automatically_start_playback")));
+            p.preservePitchButton->setText(_getText(DJV_TEXT("settings_playback_preserve_audio_pitch")));
+            p.prerollButton->setText(_getText(DJV_TEXT("settings_playback_preroll")));
+            p.prerollLayout->setText(p.prerollSecondsSlider, _getText(DJV_TEXT("settings_playback_preroll_seconds")) + ":");
         }
 
         struct TimelineSettingsWidget::Private
         {
             std::shared_ptr<UI::CheckBox> pipButton;
+            std::shared_ptr<UI::CheckBox> waveformButton;
+            std::shared_ptr<UI::CheckBox> waveformDiskCacheButton;
             std::shared_ptr<UI::VerticalLayout> layout;
             std::shared_ptr<ValueObserver<bool> > pipObserver;
+            std::shared_ptr<ValueObserver<bool> > waveformObserver;
+            std::shared_ptr<ValueObserver<bool> > waveformDiskCacheObserver;
         };
 
         void TimelineSettingsWidget::_init(const std::shared_ptr<Context>& context)
@@ -148,9 +251,13 @@ namespace djv
             setClassName("djv::ViewApp::TimelineSettingsWidget");
 
             p.pipButton = UI::CheckBox::create(context);
+            p.waveformButton = UI::CheckBox::create(context);
+            p.waveformDiskCacheButton = UI::CheckBox::create(context);
 
             p.layout = UI::VerticalLayout::create(context);
             p.layout->addChild(p.pipButton);
+            p.layout->addChild(p.waveformButton);
+            p.layout->addChild(p.waveformDiskCacheButton);
             addChild(p.layout);
 
             auto weak = std::weak_ptr<TimelineSettingsWidget>(std::dynamic_pointer_cast<TimelineSettingsWidget>(shared_from_this()));
@@ -171,6 +278,38 @@ namespace djv
                     }
                 });
 
+            p.waveformButton->setCheckedCallback(
+                [weak, contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+                            {
+                                playbackSettings->setWaveform(value);
+                            }
+                        }
+                    }
+                });
+
+            p.waveformDiskCacheButton->setCheckedCallback(
+                [weak, contextWeak](bool value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto settingsSystem = context->getSystemT<UI::Settings::System>();
+                            if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
+                            {
+                                playbackSettings->setWaveformDiskCache(value);
+                            }
+                        }
+                    }
+                });
+
             auto settingsSystem = context->getSystemT<UI::Settings::System>();
             if (auto playbackSettings = settingsSystem->getSettingsT<PlaybackSettings>())
             {
@@ -183,6 +322,26 @@ namespace djv
                             widget->_p->pipButton->setChecked(value);
                         }
                     });
+
+                p.waveformObserver = ValueObserver<bool>::create(
+                    playbackSettings->observeWaveform(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->waveformButton->setChecked(value);
+                        }
+                    });
+
+                p.waveformDiskCacheObserver = ValueObserver<bool>::create(
+                    playbackSettings->observeWaveformDiskCache(),
+                    [weak](bool value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->waveformDiskCacheButton->setChecked(value);
+                        }
+                    });
             }
         }
 
@@ -217,6 +376,8 @@ namespace djv
             ISettingsWidget::_initEvent(event);
             DJV_PRIVATE_PTR();
             p.pipButton->setText(_getText(DJV_TEXT("show_pip_picture_in_picture")));
+            p.waveformButton->setText(_getText(DJV_TEXT("settings_playback_show_audio_waveform")));
+            p.waveformDiskCacheButton->setText(_getText(DJV_TEXT("settings_playback_cache_audio_waveforms_on_disk")));
         }
 
     } // namespace ViewApp
@@ -44,6 +44,8 @@
 #include <djvUI/Style.h>
 #include <djvUI/UISystem.h>
 
+#include <djvAV/WaveformSystem.h>
+
 #include <djvCore/Context.h>
 #include <djvCore/TextSystem.h>
 
@@ -84,6 +86,7 @@ namespace djv
             std::shared_ptr<ValueObserver<std::shared_ptr<MediaWidget> > > activeWidgetObserver;
             std::shared_ptr<ValueObserver<PointerData> > hoverObserver;
             std::shared_ptr<ValueObserver<PointerData> > dragObserver;
+            std::shared_ptr<ValueObserver<bool> > waveformDiskCacheObserver;
         };
 
         void PlaybackSystem::_init(const std::shared_ptr<Core::Context>& context)
@@ -674,6 +677,14 @@ namespace djv
                         }
                     });
             }
+
+            auto waveformSystem = context->getSystemT<AV::WaveformSystem>();
+            p.waveformDiskCacheObserver = ValueObserver<bool>::create(
+                p.settings->observeWaveformDiskCache(),
+                [waveformSystem](bool value)
+                {
+                    waveformSystem->setDiskCache(value);
+                });
         }
 
         PlaybackSystem::PlaybackSystem() :
@@ -42,9 +42,11 @@
 #include <djvUI/Window.h>
 
 #include <djvAV/AVSystem.h>
+#include <djvAV/AudioWaveform.h>
 #include <djvAV/FontSystem.h>
 #include <djvAV/IO.h>
 #include <djvAV/Render2D.h>
+#include <djvAV/WaveformSystem.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/Math.h>
@@ -64,6 +66,7 @@ namespace djv
         struct TimelineSlider::Private
         {
             std::shared_ptr<AV::Font::System> fontSystem;
+            std::shared_ptr<AV::WaveformSystem> waveformSystem;
             std::shared_ptr<Media> media;
             Time::Speed speed;
             Frame::Sequence sequence;
@@ -86,6 +89,9 @@ namespace djv
             std::future<glm::vec2> maxFrameSizeFuture;
             uint32_t pressedID = Event::invalidID;
             bool pip = true;
+            bool waveformEnabled = true;
+            std::shared_ptr<AV::Audio::Waveform> waveform;
+            AV::WaveformSystem::WaveformFuture waveformFuture;
             AV::TimeUnits timeUnits = AV::TimeUnits::First;
             std::shared_ptr<TimelinePIPWidget> pipWidget;
             std::shared_ptr<UI::Layout::Overlay> overlay;
@@ -96,6 +102,7 @@ namespace djv
             std::shared_ptr<ValueObserver<Frame::Sequence> > sequenceObserver;
             std::shared_ptr<ValueObserver<Frame::Index> > currentFrameObserver;
             std::shared_ptr<ValueObserver<bool> > pipObserver;
+            std::shared_ptr<ValueObserver<bool> > waveformObserver;
             std::shared_ptr<ValueObserver<AV::TimeUnits> > timeUnitsObserver;
             glm::vec2 sizePrev = glm::vec2(0.F, 0.F);
             struct TimeTick
@@ -118,6 +125,7 @@ namespace djv
             setClassName("djv::ViewApp::TimelineSlider");
 
             p.fontSystem = context->getSystemT<AV::Font::System>();
+            p.waveformSystem = context->getSystemT<AV::WaveformSystem>();
 
             p.pipWidget = TimelinePIPWidget::create(context);
             p.overlay = UI::Layout::Overlay::create(context);
@@ -139,6 +147,17 @@ namespace djv
                         widget->_p->pip = value;
                     }
                 });
+
+                p.waveformObserver = ValueObserver<bool>::create(
+                    playbackSettings->observeWaveform(),
+                    [weak](bool value)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_p->waveformEnabled = value;
+                        widget->_waveformUpdate();
+                    }
+                });
             }
 
             auto avSystem = context->getSystemT<AV::AVSystem>();
@@ -160,7 +179,13 @@ namespace djv
         {}
 
         TimelineSlider::~TimelineSlider()
-        {}
+        {
+            DJV_PRIVATE_PTR();
+            if (p.waveformFuture.future.valid())
+            {
+                p.waveformSystem->cancelWaveform(p.waveformFuture.uid);
+            }
+        }
 
         std::shared_ptr<TimelineSlider> TimelineSlider::create(const std::shared_ptr<Context>& context)
         {
@@ -240,6 +265,7 @@ namespace djv
             }
             _textUpdate();
             _currentFrameUpdate();
+            _waveformUpdate();
         }
 
         void TimelineSlider::setInOutPointsEnabled(bool value)
@@ -411,11 +437,57 @@ namespace djv
                 const float m = style->getMetric(UI::MetricsRole::MarginSmall);
                 const float b = style->getMetric(UI::MetricsRole::Border);
                 const BBox2f& hg = _getHandleGeometry();
+                auto render = _getRender();
+
+                // Draw the audio waveform. The channels are combined and each
+                // pixel column is drawn from a single waveform bin.
+                const size_t sequenceSize = p.sequence.getSize();
+                const float speedF = p.speed.toFloat();
+                if (p.waveform && p.waveform->getSampleCount() && sequenceSize && speedF > 0.F)
+                {
+                    const float x0 = floorf(_frameToPos(0));
+                    const size_t width = static_cast<size_t>(ceilf(_frameToPos(sequenceSize) - x0));
+                    const size_t sampleCount = static_cast<size_t>(sequenceSize / speedF * p.waveform->getSampleRate());
+                    std::vector<AV::Audio::Waveform::Bin> bins(width);
+                    for (uint8_t c = 0; c < p.waveform->getChannelCount(); ++c)
+                    {
+                        const auto channelBins = p.waveform->getBins(c, 0, sampleCount, width);
+                        for (size_t i = 0; i < width; ++i)
+                        {
+                            auto& bin = bins[i];
+                            bin.min = std::min(bin.min, channelBins[i].min);
+                            bin.max = std::max(bin.max, channelBins[i].max);
+                            bin.rms = std::max(bin.rms, channelBins[i].rms);
+                        }
+                    }
+                    const float h = (g.h() - m * 2.F) / 2.F;
+                    const float y = g.min.y + m + h;
+                    std::vector<BBox2f> peakBoxes;
+                    std::vector<BBox2f> rmsBoxes;
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        const auto& bin = bins[i];
+                        const float y0 = floorf(y - bin.max * h);
+                        const float y1 = ceilf(y - bin.min * h);
+                        peakBoxes.push_back(BBox2f(x0 + i, y0, 1.F, std::max(y1 - y0, 1.F)));
+                        const float r = ceilf(bin.rms * h);
+                        if (r > 0.F)
+                        {
+                            rmsBoxes.push_back(BBox2f(x0 + i, y - r, 1.F, r * 2.F));
+                        }
+                    }
+                    auto color = style->getColor(UI::ColorRole::Foreground);
+                    color.setF32(color.getF32(3) * .15F, 3);
+                    render->setFillColor(color);
+                    render->drawRects(peakBoxes);
+                    color.setF32(color.getF32(3) * 2.F, 3);
+                    render->setFillColor(color);
+                    render->drawRects(rmsBoxes);
+                }
 
                 // Draw the time ticks.
                 auto color = style->getColor(UI::ColorRole::Foreground);
                 color.setF32(color.getF32(3) * .4F, 3);
-                auto render = _getRender();
                 render->setFillColor(color);
                 render->setCurrentFont(p.fontInfo);
                 std::vector<BBox2f> boxes;
@@ -455,7 +527,7 @@ namespace djv
                     color = style->getColor(UI::ColorRole::Checked);
                     render->setFillColor(color);
                     boxes.clear();
-                    for (const auto& i : p.cacheSequence.ranges)
+                    for (const auto& i : p.cacheSequence.getRanges())
                     {
                         const float x0 = _frameToPos(i.min);
                         const float x1 = _frameToPos(i.max + 1);
@@ -469,7 +541,7 @@ namespace djv
                     color = style->getColor(UI::ColorRole::Cached);
                     render->setFillColor(color);
                     boxes.clear();
-                    for (const auto& i : p.cachedFrames.ranges)
+                    for (const auto& i : p.cachedFrames.getRanges())
                     {
                         const float x0 = _frameToPos(i.min);
                         const float x1 = _frameToPos(i.max + 1);
@@ -483,7 +555,6 @@ namespace djv
                 }
 
                 // Draw the frame ticks.
-                const size_t sequenceSize = p.sequence.getSize();
                 if (_getFrameLength() > b * 2.F)
                 {
                     auto color = style->getColor(UI::ColorRole::Foreground);
@@ -677,6 +748,19 @@ namespace djv
                     _log(e.what(), LogLevel::Error);
                 }
             }
+            if (p.waveformFuture.future.valid() &&
+                p.waveformFuture.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                try
+                {
+                    p.waveform = p.waveformFuture.future.get();
+                    _redraw();
+                }
+                catch (const std::exception & e)
+                {
+                    _log(e.what(), LogLevel::Error);
+                }
+            }
             for (const auto& i : p.timeTicks)
             {
                 if (i->glyphsFuture.valid() &&
@@ -782,10 +866,10 @@ namespace djv
                     break;
                 case AV::TimeUnits::Frames:
                 {
-                    const size_t rangesSize = p.sequence.ranges.size();
+                    const size_t rangesSize = p.sequence.getRanges().size();
                     if (rangesSize > 0)
                     {
-                        maxFrameText = std::string(Math::getNumDigits(p.sequence.ranges[rangesSize - 1].max), '0');
+                        maxFrameText = std::string(Math::getNumDigits(p.sequence.getRanges()[rangesSize - 1].max), '0');
                     }
                     break;
                 }
@@ -809,6 +893,22 @@ namespace djv
             }
         }
 
+        void TimelineSlider::_waveformUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.waveformFuture.future.valid())
+            {
+                p.waveformSystem->cancelWaveform(p.waveformFuture.uid);
+                p.waveformFuture = AV::WaveformSystem::WaveformFuture();
+            }
+            p.waveform.reset();
+            if (p.media && p.waveformEnabled)
+            {
+                p.waveformFuture = p.waveformSystem->getWaveform(p.media->getFileInfo());
+            }
+            _redraw();
+        }
+
         void TimelineSlider::_doCurrentFrameCallback()
         {
             DJV_PRIVATE_PTR();
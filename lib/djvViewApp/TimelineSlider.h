@@ -102,6 +102,7 @@ namespace djv
             Core::BBox2f _getHandleGeometry() const;
             void _textUpdate();
             void _currentFrameUpdate();
+            void _waveformUpdate();
 
             void _doCurrentFrameCallback();
             void _doCurrentFrameDragCallback(bool);
@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/AudioData.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+using namespace djv;
+
+// One second of stereo audio, about the size of a few callback buffers worth
+// of frames from the reader.
+const size_t sampleCount = 48000;
+const uint8_t channelCount = 2;
+const size_t iterations = 200;
+
+namespace
+{
+    double run(const std::function<void(void)>& value)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            value();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        return ns / static_cast<double>(iterations * sampleCount * channelCount);
+    }
+
+    void compare(const std::string& name, const std::function<void(void)>& value)
+    {
+        AV::Audio::setSIMDEnabled(false);
+        const double scalar = run(value);
+        AV::Audio::setSIMDEnabled(true);
+        const double simd = run(value);
+        std::cout << name << ": " << scalar << "ns scalar, " << simd << "ns SIMD, " <<
+            (simd > 0.0 ? (scalar / simd) : 0.0) << "x" << std::endl;
+    }
+
+    std::shared_ptr<AV::Audio::Data> createData(AV::Audio::Type type)
+    {
+        auto f32 = AV::Audio::Data::create(AV::Audio::Info(channelCount, AV::Audio::Type::F32, 48000, sampleCount));
+        auto p = reinterpret_cast<AV::Audio::F32_T*>(f32->getData());
+        for (size_t i = 0; i < sampleCount * channelCount; ++i)
+        {
+            p[i] = (static_cast<int>(i * 7919 % 2001) - 1000) / 1000.F;
+        }
+        return AV::Audio::Data::convert(f32, type);
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    std::cout << "SIMD: " << AV::Audio::hasSIMD() << std::endl;
+    std::cout << "Samples: " << sampleCount << " x " << static_cast<int>(channelCount) << std::endl;
+
+    const std::vector<AV::Audio::Type> types = { AV::Audio::Type::S16, AV::Audio::Type::S32, AV::Audio::Type::F32 };
+    for (auto i : types)
+    {
+        auto in = createData(i);
+        for (auto j : types)
+        {
+            if (i == j)
+                continue;
+            auto out = AV::Audio::Data::create(AV::Audio::Info(channelCount, j, 48000, sampleCount));
+            std::stringstream ss;
+            ss << "convert " << i << " to " << j;
+            compare(
+                ss.str(),
+                [in, out, i, j]
+                {
+                    AV::Audio::Data::convert(in->getData(), i, out->getData(), j, sampleCount, channelCount);
+                });
+            ss << " (allocating)";
+            compare(
+                ss.str(),
+                [in, j]
+                {
+                    AV::Audio::Data::convert(in, j);
+                });
+        }
+    }
+
+    for (auto i : types)
+    {
+        auto in = createData(i);
+        auto out = AV::Audio::Data::create(in->getInfo());
+        std::stringstream ss;
+        ss << "volume " << i;
+        compare(
+            ss.str(),
+            [in, out, i]
+            {
+                AV::Audio::Data::volume(in->getData(), out->getData(), .5F, sampleCount, channelCount, i);
+            });
+    }
+
+    {
+        auto in = createData(AV::Audio::Type::S16);
+        auto out = AV::Audio::Data::create(in->getInfo());
+        const AV::Audio::S16_T* planes[] =
+        {
+            reinterpret_cast<const AV::Audio::S16_T*>(in->getData()),
+            reinterpret_cast<const AV::Audio::S16_T*>(in->getData()) + sampleCount
+        };
+        compare(
+            "planarInterleave S16",
+            [&planes, out]
+            {
+                AV::Audio::Data::planarInterleave(planes, reinterpret_cast<AV::Audio::S16_T*>(out->getData()), sampleCount, channelCount);
+            });
+    }
+    {
+        auto in = createData(AV::Audio::Type::F32);
+        auto out = AV::Audio::Data::create(in->getInfo());
+        const AV::Audio::F32_T* planes[] =
+        {
+            reinterpret_cast<const AV::Audio::F32_T*>(in->getData()),
+            reinterpret_cast<const AV::Audio::F32_T*>(in->getData()) + sampleCount
+        };
+        compare(
+            "planarInterleave F32",
+            [&planes, out]
+            {
+                AV::Audio::Data::planarInterleave(planes, reinterpret_cast<AV::Audio::F32_T*>(out->getData()), sampleCount, channelCount);
+            });
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvCore/Frame.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace djv;
+
+// A sparse sequence with a gap after every few frames, like a render with
+// missing frames.
+const size_t rangeCount = 10000;
+const size_t rangeSize = 3;
+const size_t iterations = 1000000;
+
+namespace
+{
+    Core::Frame::Sequence createSequence()
+    {
+        Core::Frame::Sequence out;
+        Core::Frame::Number frame = 1;
+        for (size_t i = 0; i < rangeCount; ++i)
+        {
+            out.add(Core::Frame::Range(frame, frame + rangeSize - 1));
+            frame += rangeSize + 1;
+        }
+        return out;
+    }
+
+    void print(const std::string& name, const std::chrono::steady_clock::time_point& start, size_t count)
+    {
+        const auto end = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        std::cout << name << ": " << (count ? (ns / static_cast<double>(count)) : 0.0) << "ns" << std::endl;
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    const auto sequence = createSequence();
+    const Core::Frame::Index size = static_cast<Core::Frame::Index>(sequence.getSize());
+    std::cout << "Ranges: " << sequence.getRanges().size() << std::endl;
+    std::cout << "Frames: " << size << std::endl;
+
+    Core::Frame::Number sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        sum += sequence.getFrame((i * 7919) % size);
+    }
+    print("getFrame", start, iterations);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        sum += sequence.getIndex(sequence.getRanges()[(i * 7919) % rangeCount].min);
+    }
+    print("getIndex", start, iterations);
+
+    std::cout << "Checksum: " << sum << std::endl;
+    return 0;
+}
@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAV/Color.h>
+#include <djvAV/FontSystem.h>
+#include <djvAV/Image.h>
+#include <djvAV/Render2D.h>
+
+#include <djvCore/Context.h>
+#include <djvCore/Error.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+using namespace djv;
+
+// Synthetic UI frames that are recorded without an OpenGL context, to measure
+// the CPU cost of building primitives and vertex data.
+const size_t rectCount = 10000;
+const size_t glyphCount = 50000;
+const size_t textLength = 50;
+const size_t imageCount = 1000;
+const size_t colorCount = 8;
+const size_t frameCount = 100;
+const AV::Image::Size frameSize(1920, 1080);
+
+namespace
+{
+    void benchmark(
+        const std::string& name,
+        const std::shared_ptr<AV::Render::Render2D>& render,
+        const std::function<void(void)>& draw)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            render->beginFrame(frameSize);
+            draw();
+            render->endFrame();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        const size_t primitiveCount = render->getPrimitiveCount();
+        std::cout << name << ": " <<
+            (primitiveCount ? (ns / static_cast<double>(frameCount * primitiveCount)) : 0.0) << "ns/primitive, " <<
+            render->getVBODataByteCount() << " bytes/frame, " <<
+            primitiveCount << " primitives, " <<
+            render->getDrawCallCount() << " draw calls, " <<
+            render->getStateChangeCount() << " state changes" << std::endl;
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    int r = 0;
+    try
+    {
+        std::vector<std::string> args;
+        for (int i = 0; i < argc; ++i)
+        {
+            args.push_back(argv[i]);
+        }
+        auto context = Core::Context::create(args);
+        auto fontSystem = AV::Font::System::create(context);
+        auto render = AV::Render::Render2D::create(context, AV::Render::Backend::Record);
+
+        std::vector<AV::Image::Color> colors;
+        for (size_t i = 0; i < colorCount; ++i)
+        {
+            const float v = i / static_cast<float>(colorCount);
+            colors.push_back(AV::Image::Color(v, 1.F - v, .5F));
+        }
+        auto rects = [render, colors]
+        {
+            for (size_t i = 0; i < rectCount; ++i)
+            {
+                render->setFillColor(colors[(i / 100) % colors.size()]);
+                render->drawRect(Core::BBox2f(
+                    static_cast<float>((i * 17) % frameSize.w),
+                    static_cast<float>((i * 31) % frameSize.h),
+                    20.F,
+                    10.F));
+            }
+        };
+
+        const AV::Font::Info fontInfo(1, 1, 14, AV::dpiDefault);
+        std::string text;
+        for (size_t i = 0; i < textLength; ++i)
+        {
+            text.push_back(static_cast<char>('a' + i % 26));
+        }
+        const auto glyphs = fontSystem->getGlyphs(text, fontInfo).get();
+        std::vector<AV::Render::TextRun> textRuns(glyphCount / textLength, AV::Render::TextRun(glyphs));
+        render->setCurrentFont(fontInfo);
+        auto glyphsFunc = [render, glyphs]
+        {
+            for (size_t i = 0; i < glyphCount / textLength; ++i)
+            {
+                render->drawText(glyphs, glm::vec2(
+                    static_cast<float>((i * 17) % frameSize.w),
+                    static_cast<float>((i * 31) % frameSize.h)));
+            }
+        };
+        auto textRunsFunc = [render, &textRuns]
+        {
+            for (size_t i = 0; i < textRuns.size(); ++i)
+            {
+                render->drawText(textRuns[i], glm::vec2(
+                    static_cast<float>((i * 17) % frameSize.w),
+                    static_cast<float>((i * 31) % frameSize.h)));
+            }
+        };
+
+        std::vector<std::shared_ptr<AV::Image::Image> > images;
+        for (size_t i = 0; i < colorCount; ++i)
+        {
+            auto image = AV::Image::Image::create(AV::Image::Info(64, 64, AV::Image::Type::RGBA_U8));
+            image->zero();
+            images.push_back(image);
+        }
+        auto imagesFunc = [render, images]
+        {
+            for (size_t i = 0; i < imageCount; ++i)
+            {
+                render->drawImage(images[i % images.size()], glm::vec2(
+                    static_cast<float>((i * 17) % frameSize.w),
+                    static_cast<float>((i * 31) % frameSize.h)));
+            }
+        };
+
+        benchmark("Rectangles", render, rects);
+        benchmark("Glyphs", render, glyphsFunc);
+        benchmark("Text runs", render, textRunsFunc);
+        benchmark("Images", render, imagesFunc);
+        benchmark("Mixed", render, [rects, textRunsFunc, imagesFunc]
+            {
+                rects();
+                textRunsFunc();
+                imagesFunc();
+            });
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+        r = 1;
+    }
+    return r;
+}
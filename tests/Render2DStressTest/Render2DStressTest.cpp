@@ -47,6 +47,8 @@ using namespace djv;
 
 const size_t drawCount = 10000;
 const size_t randomCount = 1000;
+const size_t gridRows = 50;
+const size_t gridColumns = 50;
 AV::Image::Size windowSize;
 
 struct RandomColor
@@ -127,6 +129,7 @@ private:
     void _drawRandomCircle();
     void _drawRandomText();
     void _drawRandomIcon();
+    void _drawGrid();
     void _render();
 
     GLFWwindow*  _glfwWindow   = nullptr;
@@ -213,7 +216,10 @@ int Application::run()
         std::chrono::duration<float> delta = now - time;
         time = now;
         const float dt = delta.count();
-        std::cout << "FPS: " << (dt > 0.f ? 1.f / dt : 0.f) << std::endl;
+        std::cout << "FPS: " << (dt > 0.f ? 1.f / dt : 0.f) <<
+            ", primitives: " << _render2D->getPrimitiveCount() <<
+            ", draw calls: " << _render2D->getDrawCallCount() <<
+            ", state changes: " << _render2D->getStateChangeCount() << std::endl;
     }
     return 0;
 }
@@ -335,6 +341,23 @@ void Application::_drawRandomIcon()
     _currentIcon = _currentIcon->next;
 }
 
+void Application::_drawGrid()
+{
+    // Draw a grid of cells similar to a user interface, where neighboring
+    // rectangles share the same color and clipping rectangle.
+    const float w = windowSize.w / static_cast<float>(gridColumns);
+    const float h = windowSize.h / static_cast<float>(gridRows);
+    for (size_t y = 0; y < gridRows; ++y)
+    {
+        _render2D->setFillColor(_currentColor->c);
+        for (size_t x = 0; x < gridColumns; ++x)
+        {
+            _render2D->drawRect(Core::BBox2f(x * w + 1.f, y * h + 1.f, w - 2.f, h - 2.f));
+        }
+        _currentColor = _currentColor->next;
+    }
+}
+
 void Application::_render()
 {
     glm::ivec2 size = glm::ivec2(0, 0);
@@ -355,6 +378,7 @@ void Application::_render()
         _drawRandomText();
         _drawRandomIcon();
     }
+    _drawGrid();
     _render2D->endFrame();
 }
 
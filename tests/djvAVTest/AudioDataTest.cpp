@@ -31,6 +31,8 @@
 
 #include <djvAV/AudioData.h>
 
+#include <sstream>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -47,6 +49,7 @@ namespace djv
             _info();
             _data();
             _util();
+            _simd();
             _operators();
         }
 
@@ -140,6 +143,93 @@ namespace djv
             }
         }
         
+        void AudioDataTest::_simd()
+        {
+            {
+                std::stringstream ss;
+                ss << "SIMD: " << Audio::hasSIMD();
+                _print(ss.str());
+            }
+
+            // Compare the SIMD versions with the scalar versions, using a size
+            // that does not fill the last vector.
+            const Audio::Info info(2, Audio::Type::F32, 44000, 101);
+            auto f32 = Audio::Data::create(info);
+            auto p = reinterpret_cast<Audio::F32_T*>(f32->getData());
+            for (size_t i = 0; i < info.sampleCount * info.channelCount; ++i)
+            {
+                p[i] = (static_cast<int>(i * 7919 % 2001) - 1000) / 900.F;
+            }
+            const std::vector<Audio::Type> types = { Audio::Type::S16, Audio::Type::S32, Audio::Type::F32 };
+            for (auto i : types)
+            {
+                auto data = Audio::Data::convert(f32, i);
+                for (auto j : types)
+                {
+                    Audio::setSIMDEnabled(false);
+                    auto scalar = Audio::Data::convert(data, j);
+                    Audio::setSIMDEnabled(true);
+                    auto simd = Audio::Data::convert(data, j);
+                    DJV_ASSERT(*scalar == *simd);
+
+                    auto inPlace = Audio::Data::create(scalar->getInfo());
+                    Audio::Data::convert(data->getData(), i, inPlace->getData(), j, info.sampleCount, info.channelCount);
+                    DJV_ASSERT(*scalar == *inPlace);
+                }
+
+                auto scalar = Audio::Data::create(data->getInfo());
+                auto simd = Audio::Data::create(data->getInfo());
+                Audio::setSIMDEnabled(false);
+                Audio::Data::volume(data->getData(), scalar->getData(), .3F, info.sampleCount, info.channelCount, i);
+                Audio::setSIMDEnabled(true);
+                Audio::Data::volume(data->getData(), simd->getData(), .3F, info.sampleCount, info.channelCount, i);
+                DJV_ASSERT(*scalar == *simd);
+                Audio::Data::volume(data->getData(), data->getData(), .3F, info.sampleCount, info.channelCount, i);
+                DJV_ASSERT(*scalar == *data);
+            }
+            DJV_ASSERT(Audio::isSIMDEnabled() == Audio::hasSIMD());
+
+            {
+                const Audio::S16_T in0[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+                const Audio::S16_T in1[] = { 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+                const Audio::S16_T* in[] = { in0, in1 };
+                Audio::S16_T out[18];
+                Audio::Data::planarInterleave(in, out, 9, 2);
+                for (size_t i = 0; i < 9; ++i)
+                {
+                    DJV_ASSERT(in0[i] == out[i * 2]);
+                    DJV_ASSERT(in1[i] == out[i * 2 + 1]);
+                }
+            }
+
+            {
+                const Audio::F32_T in0[] = { 1.F, 2.F, 3.F, 4.F, 5.F };
+                const Audio::F32_T in1[] = { 11.F, 12.F, 13.F, 14.F, 15.F };
+                const Audio::F32_T* in[] = { in0, in1 };
+                Audio::F32_T out[10];
+                Audio::Data::planarInterleave(in, out, 5, 2);
+                for (size_t i = 0; i < 5; ++i)
+                {
+                    DJV_ASSERT(in0[i] == out[i * 2]);
+                    DJV_ASSERT(in1[i] == out[i * 2 + 1]);
+                }
+            }
+
+            {
+                const Audio::Info info(2, Audio::Type::S32, 44000, 5);
+                auto data = Audio::Data::create(info);
+                auto p = reinterpret_cast<Audio::S32_T*>(data->getData());
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    p[i] = static_cast<Audio::S32_T>(i);
+                }
+                auto interleaved = Audio::Data::planarInterleave(data);
+                auto deinterleaved = Audio::Data::planarDeinterleave(interleaved);
+                DJV_ASSERT(5 == reinterpret_cast<const Audio::S32_T*>(interleaved->getData())[1]);
+                DJV_ASSERT(*data == *deinterleaved);
+            }
+        }
+
         void AudioDataTest::_operators()
         {
             {
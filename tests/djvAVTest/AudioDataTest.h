@@ -45,6 +45,7 @@ namespace djv
             void _info();
             void _data();
             void _util();
+            void _simd();
             void _operators();
         };
         
@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAVTest/AudioResamplerTest.h>
+
+#include <djvAV/AudioResampler.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            std::shared_ptr<Audio::Data> getData(size_t sampleCount, Audio::S16_T value)
+            {
+                auto out = Audio::Data::create(Audio::Info(2, Audio::Type::S16, 48000, sampleCount));
+                auto p = reinterpret_cast<Audio::S16_T*>(out->getData());
+                for (size_t i = 0; i < sampleCount * 2; ++i)
+                {
+                    p[i] = value;
+                }
+                return out;
+            }
+
+            size_t process(
+                const std::shared_ptr<Audio::Resampler>& resampler,
+                size_t chunkCount,
+                Audio::S16_T value,
+                bool& constant)
+            {
+                size_t out = 0;
+                constant = true;
+                for (size_t i = 0; i < chunkCount; ++i)
+                {
+                    auto data = resampler->process(getData(1000, value));
+                    DJV_ASSERT(Audio::Type::S16 == data->getType());
+                    DJV_ASSERT(2 == data->getChannelCount());
+                    auto p = reinterpret_cast<const Audio::S16_T*>(data->getData());
+                    for (size_t j = 0; j < data->getSampleCount() * 2; ++j)
+                    {
+                        // Skip the start where the history is filled with silence.
+                        if (out + j / 2 > 4096 && abs(p[j] - value) > 1)
+                        {
+                            constant = false;
+                        }
+                    }
+                    out += data->getSampleCount();
+                }
+                return out;
+            }
+
+            const float sineFrequency = 1000.F;
+
+            std::shared_ptr<Audio::Data> getSine(size_t sampleCount, size_t offset)
+            {
+                auto out = Audio::Data::create(Audio::Info(2, Audio::Type::S16, 48000, sampleCount));
+                auto p = reinterpret_cast<Audio::S16_T*>(out->getData());
+                for (size_t i = 0; i < sampleCount; ++i)
+                {
+                    const double t = (offset + i) / 48000.0;
+                    const auto value = static_cast<Audio::S16_T>(std::sin(2.0 * Math::pi * sineFrequency * t) * 10000.0);
+                    p[i * 2] = value;
+                    p[i * 2 + 1] = value;
+                }
+                return out;
+            }
+
+            //! Process a continuous sine wave and return the first channel.
+            std::vector<Audio::S16_T> processSine(
+                const std::shared_ptr<Audio::Resampler>& resampler,
+                size_t chunkCount)
+            {
+                std::vector<Audio::S16_T> out;
+                for (size_t i = 0; i < chunkCount; ++i)
+                {
+                    auto data = resampler->process(getSine(1000, i * 1000));
+                    auto p = reinterpret_cast<const Audio::S16_T*>(data->getData());
+                    for (size_t j = 0; j < data->getSampleCount(); ++j)
+                    {
+                        out.push_back(p[j * 2]);
+                    }
+                }
+                return out;
+            }
+
+            //! Get the frequency from the upward zero crossings, skipping the
+            //! start where the history is filled with silence.
+            float getFrequency(const std::vector<Audio::S16_T>& samples)
+            {
+                size_t first = 0;
+                size_t last = 0;
+                size_t count = 0;
+                for (size_t i = 4096; i < samples.size(); ++i)
+                {
+                    if (samples[i - 1] < 0 && samples[i] >= 0)
+                    {
+                        if (0 == count)
+                        {
+                            first = i;
+                        }
+                        last = i;
+                        ++count;
+                    }
+                }
+                return count > 1 ? ((count - 1) * 48000.F / (last - first)) : 0.F;
+            }
+
+        } // namespace
+
+        AudioResamplerTest::AudioResamplerTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::AudioResamplerTest", context)
+        {}
+        
+        void AudioResamplerTest::run(const std::vector<std::string>& args)
+        {
+            _resampler();
+            _varispeed();
+            _preservePitch();
+            _sine();
+        }
+
+        void AudioResamplerTest::_resampler()
+        {
+            auto resampler = Audio::Resampler::create(2, Audio::Type::S16);
+            DJV_ASSERT(2 == resampler->getChannelCount());
+            DJV_ASSERT(Audio::Type::S16 == resampler->getType());
+            DJV_ASSERT(1.0 == resampler->getSpeed());
+            DJV_ASSERT(!resampler->hasPreservePitch());
+
+            resampler->setSpeed(2.0);
+            DJV_ASSERT(2.0 == resampler->getSpeed());
+            resampler->setSpeed(100.0);
+            DJV_ASSERT(Audio::resamplerSpeedMax == resampler->getSpeed());
+            resampler->setSpeed(0.0);
+            DJV_ASSERT(Audio::resamplerSpeedMin == resampler->getSpeed());
+            resampler->setPreservePitch(true);
+            DJV_ASSERT(resampler->hasPreservePitch());
+        }
+
+        void AudioResamplerTest::_varispeed()
+        {
+            for (const auto speed : { .5, 1.0, 1.04, 2.0 })
+            {
+                std::stringstream ss;
+                ss << "Varispeed: " << speed;
+                _print(ss.str());
+
+                auto resampler = Audio::Resampler::create(2, Audio::Type::S16);
+                resampler->setSpeed(speed);
+                bool constant = false;
+                const size_t sampleCount = process(resampler, 50, 10000, constant);
+                const size_t expected = static_cast<size_t>(50000 / speed);
+                DJV_ASSERT(sampleCount <= expected && sampleCount + 100 > expected);
+                DJV_ASSERT(constant);
+
+                resampler->reset();
+                process(resampler, 10, 10000, constant);
+                DJV_ASSERT(constant);
+            }
+        }
+
+        void AudioResamplerTest::_preservePitch()
+        {
+            for (const auto speed : { .5, 1.0, 1.5, 2.0 })
+            {
+                std::stringstream ss;
+                ss << "Preserve pitch: " << speed;
+                _print(ss.str());
+
+                auto resampler = Audio::Resampler::create(2, Audio::Type::S16);
+                resampler->setPreservePitch(true);
+                resampler->setSpeed(speed);
+                bool constant = false;
+                const size_t sampleCount = process(resampler, 50, 10000, constant);
+                const size_t expected = static_cast<size_t>(50000 / speed);
+                DJV_ASSERT(sampleCount <= expected && sampleCount + 5000 > expected);
+                DJV_ASSERT(constant);
+            }
+        }
+
+        void AudioResamplerTest::_sine()
+        {
+            // Resampling changes the frequency along with the speed.
+            for (const auto speed : { .5, 1.0, 1.04, 2.0 })
+            {
+                auto resampler = Audio::Resampler::create(2, Audio::Type::S16);
+                resampler->setSpeed(speed);
+                const auto samples = processSine(resampler, 50);
+                const size_t expected = static_cast<size_t>(50000 / speed);
+                DJV_ASSERT(samples.size() <= expected && samples.size() + 100 > expected);
+                const float frequency = getFrequency(samples);
+                const float expectedFrequency = static_cast<float>(sineFrequency * speed);
+
+                std::stringstream ss;
+                ss << "Varispeed sine: " << speed << ", " << frequency << "Hz";
+                _print(ss.str());
+                DJV_ASSERT(std::abs(frequency - expectedFrequency) < expectedFrequency * .01F);
+            }
+
+            // Preserving the pitch keeps the frequency.
+            for (const auto speed : { .5, 1.0, 1.5, 2.0 })
+            {
+                auto resampler = Audio::Resampler::create(2, Audio::Type::S16);
+                resampler->setPreservePitch(true);
+                resampler->setSpeed(speed);
+                const auto samples = processSine(resampler, 50);
+                const size_t expected = static_cast<size_t>(50000 / speed);
+                DJV_ASSERT(samples.size() <= expected && samples.size() + 5000 > expected);
+                const float frequency = getFrequency(samples);
+
+                std::stringstream ss;
+                ss << "Preserve pitch sine: " << speed << ", " << frequency << "Hz";
+                _print(ss.str());
+                DJV_ASSERT(std::abs(frequency - sineFrequency) < sineFrequency * .01F);
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
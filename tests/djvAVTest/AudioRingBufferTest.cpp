@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAVTest/AudioRingBufferTest.h>
+
+#include <djvAV/AudioRingBuffer.h>
+
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        AudioRingBufferTest::AudioRingBufferTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::AudioRingBufferTest", context)
+        {}
+        
+        void AudioRingBufferTest::run(const std::vector<std::string>& args)
+        {
+            _buffer();
+            _threads();
+        }
+
+        void AudioRingBufferTest::_buffer()
+        {
+            auto buffer = Audio::RingBuffer::create(2, Audio::Type::S16, 4);
+            DJV_ASSERT(2 == buffer->getChannelCount());
+            DJV_ASSERT(Audio::Type::S16 == buffer->getType());
+            DJV_ASSERT(4 == buffer->getSize());
+            DJV_ASSERT(0 == buffer->getReadAvailable());
+            DJV_ASSERT(4 == buffer->getWriteAvailable());
+
+            const Audio::S16_T in[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+            DJV_ASSERT(3 == buffer->write(reinterpret_cast<const uint8_t*>(in), 3));
+            DJV_ASSERT(3 == buffer->getReadAvailable());
+            DJV_ASSERT(1 == buffer->getWriteAvailable());
+
+            Audio::S16_T out[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+            DJV_ASSERT(2 == buffer->read(reinterpret_cast<uint8_t*>(out), 2));
+            DJV_ASSERT(1 == out[0]);
+            DJV_ASSERT(4 == out[3]);
+
+            // Wrap around the end of the buffer.
+            DJV_ASSERT(3 == buffer->write(reinterpret_cast<const uint8_t*>(in + 6), 5));
+            DJV_ASSERT(4 == buffer->getReadAvailable());
+            DJV_ASSERT(0 == buffer->write(reinterpret_cast<const uint8_t*>(in), 1));
+            DJV_ASSERT(4 == buffer->read(reinterpret_cast<uint8_t*>(out), 5));
+            const Audio::S16_T result[] = { 5, 6, 7, 8, 9, 10, 11, 12 };
+            for (size_t i = 0; i < 8; ++i)
+            {
+                DJV_ASSERT(result[i] == out[i]);
+            }
+            DJV_ASSERT(0 == buffer->read(reinterpret_cast<uint8_t*>(out), 1));
+
+            DJV_ASSERT(1 == buffer->write(reinterpret_cast<const uint8_t*>(in), 1));
+            buffer->clear();
+            DJV_ASSERT(0 == buffer->getReadAvailable());
+        }
+
+        void AudioRingBufferTest::_threads()
+        {
+            const size_t sampleCount = 100000;
+            auto buffer = Audio::RingBuffer::create(1, Audio::Type::S32, 64);
+            std::thread producer(
+                [buffer, sampleCount]
+                {
+                    Audio::S32_T value = 0;
+                    while (static_cast<size_t>(value) < sampleCount)
+                    {
+                        value += static_cast<Audio::S32_T>(buffer->write(reinterpret_cast<const uint8_t*>(&value), 1));
+                    }
+                });
+            size_t count = 0;
+            bool ordered = true;
+            while (count < sampleCount)
+            {
+                Audio::S32_T value = 0;
+                if (buffer->read(reinterpret_cast<uint8_t*>(&value), 1))
+                {
+                    ordered &= static_cast<size_t>(value) == count;
+                    ++count;
+                }
+            }
+            producer.join();
+            DJV_ASSERT(ordered);
+            DJV_ASSERT(0 == buffer->getReadAvailable());
+        }
+                
+    } // namespace AVTest
+} // namespace djv
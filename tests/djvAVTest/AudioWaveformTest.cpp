@@ -0,0 +1,186 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAVTest/AudioWaveformTest.h>
+
+#include <djvAV/AudioWaveform.h>
+
+#include <djvCore/FileIO.h>
+
+#include <cmath>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            //! The first channel is a ramp and the second channel is constant.
+            std::shared_ptr<Audio::Waveform> getWaveform(size_t sampleCount)
+            {
+                auto out = Audio::Waveform::create(2, 48000, 512);
+                const size_t chunkSize = 1000;
+                for (size_t i = 0; i < sampleCount; i += chunkSize)
+                {
+                    const size_t size = std::min(chunkSize, sampleCount - i);
+                    auto data = Audio::Data::create(Audio::Info(2, Audio::Type::S16, 48000, size));
+                    auto p = reinterpret_cast<Audio::S16_T*>(data->getData());
+                    for (size_t j = 0; j < size; ++j, p += 2)
+                    {
+                        p[0] = static_cast<Audio::S16_T>((i + j) % 32768);
+                        p[1] = 16384;
+                    }
+                    out->add(data);
+                }
+                out->finish();
+                return out;
+            }
+
+        } // namespace
+
+        AudioWaveformTest::AudioWaveformTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::AudioWaveformTest", context)
+        {}
+        
+        void AudioWaveformTest::run(const std::vector<std::string>& args)
+        {
+            _waveform();
+            _bins();
+            _io();
+        }
+
+        void AudioWaveformTest::_waveform()
+        {
+            {
+                auto waveform = Audio::Waveform::create(2, 48000);
+                DJV_ASSERT(2 == waveform->getChannelCount());
+                DJV_ASSERT(48000 == waveform->getSampleRate());
+                DJV_ASSERT(Audio::waveformBinSampleCount == waveform->getBinSampleCount());
+                DJV_ASSERT(0 == waveform->getSampleCount());
+                waveform->finish();
+                DJV_ASSERT(1 == waveform->getLevelCount());
+                DJV_ASSERT(waveform->getLevel(0, 0).empty());
+                DJV_ASSERT(0 == waveform->getByteCount());
+                DJV_ASSERT(4 == waveform->getBins(0, 0, 100, 4).size());
+            }
+
+            {
+                auto waveform = getWaveform(10000);
+                DJV_ASSERT(10000 == waveform->getSampleCount());
+                DJV_ASSERT(20 == waveform->getLevel(0, 0).size());
+                DJV_ASSERT(6 == waveform->getLevelCount());
+                for (size_t i = 1; i < waveform->getLevelCount(); ++i)
+                {
+                    DJV_ASSERT((waveform->getLevel(0, i - 1).size() + 1) / 2 == waveform->getLevel(0, i).size());
+                }
+                DJV_ASSERT(1 == waveform->getLevel(0, waveform->getLevelCount() - 1).size());
+                DJV_ASSERT(waveform->getChannelCount() * 41 * sizeof(Audio::Waveform::Bin) == waveform->getByteCount());
+            }
+        }
+
+        void AudioWaveformTest::_bins()
+        {
+            auto waveform = getWaveform(100000);
+            {
+                const auto bins = waveform->getBins(0, 0, 100000, 1);
+                DJV_ASSERT(1 == bins.size());
+                DJV_ASSERT(0.F == bins[0].min);
+                DJV_ASSERT(fabsf(bins[0].max - 32767 / 32768.F) < .001F);
+            }
+            {
+                const auto bins = waveform->getBins(1, 0, 100000, 7);
+                DJV_ASSERT(7 == bins.size());
+                for (const auto& bin : bins)
+                {
+                    DJV_ASSERT(fabsf(bin.min - .5F) < .001F);
+                    DJV_ASSERT(fabsf(bin.max - .5F) < .001F);
+                    DJV_ASSERT(fabsf(bin.rms - .5F) < .001F);
+                }
+            }
+            {
+                // Each bin of the first level is returned as is.
+                const auto& level = waveform->getLevel(0, 0);
+                const auto bins = waveform->getBins(0, 0, level.size() * 512, level.size());
+                DJV_ASSERT(level == bins);
+            }
+            {
+                // Bins past the end of the samples are empty.
+                const auto bins = waveform->getBins(0, 0, 400000, 4);
+                DJV_ASSERT(Audio::Waveform::Bin() == bins[3]);
+            }
+        }
+
+        void AudioWaveformTest::_io()
+        {
+            auto waveform = getWaveform(10000);
+            const std::string fileName = "AudioWaveformTest.djvw";
+            {
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Write);
+                waveform->write(io);
+            }
+            {
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Read);
+                auto waveform2 = Audio::Waveform::read(io);
+                DJV_ASSERT(waveform->getChannelCount() == waveform2->getChannelCount());
+                DJV_ASSERT(waveform->getSampleRate() == waveform2->getSampleRate());
+                DJV_ASSERT(waveform->getBinSampleCount() == waveform2->getBinSampleCount());
+                DJV_ASSERT(waveform->getSampleCount() == waveform2->getSampleCount());
+                DJV_ASSERT(waveform->getLevelCount() == waveform2->getLevelCount());
+                for (uint8_t c = 0; c < waveform->getChannelCount(); ++c)
+                {
+                    for (size_t i = 0; i < waveform->getLevelCount(); ++i)
+                    {
+                        DJV_ASSERT(waveform->getLevel(c, i) == waveform2->getLevel(c, i));
+                    }
+                }
+            }
+            {
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Write);
+                io.write("test", 4);
+            }
+            try
+            {
+                FileSystem::FileIO io;
+                io.open(fileName, FileSystem::FileIO::Mode::Read);
+                Audio::Waveform::read(io);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception&)
+            {}
+        }
+
+    } // namespace AVTest
+} // namespace djv
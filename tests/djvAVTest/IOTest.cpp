@@ -32,9 +32,13 @@
 #include <djvAV/IO.h>
 
 #include <djvCore/Context.h>
+#include <djvCore/FileIO.h>
+#include <djvCore/Speed.h>
 #include <djvCore/String.h>
 #include <djvCore/Timer.h>
 
+#include <cstdio>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -56,7 +60,9 @@ namespace djv
             _audioFrame();
             _audioQueue();
             _cache();
+            _threadController();
             _io();
+            _wav();
             _system();
             _operators();
         }
@@ -175,6 +181,11 @@ namespace djv
                 DJV_ASSERT(!queue.isEmpty());
                 DJV_ASSERT(3 == queue.getCount());
                 DJV_ASSERT(frame == queue.getFrame());
+                const auto frames = queue.getFrames(2);
+                DJV_ASSERT(2 == frames.size());
+                DJV_ASSERT(frame == frames[0]);
+                DJV_ASSERT(2 == frames[1].frame);
+                DJV_ASSERT(3 == queue.getFrames(10).size());
                 DJV_ASSERT(frame == queue.popFrame());
                 queue.clearFrames();
                 DJV_ASSERT(queue.isEmpty());
@@ -279,8 +290,148 @@ namespace djv
                     _print(ss.str());
                 }
             }
+
+            {
+                IO::Cache cache;
+                cache.setMax(20);
+                cache.setSequenceSize(20);
+                cache.setCurrentFrame(1);
+                auto image = Image::Image::create(Image::Info(16, 16, Image::Type::RGBA_U8));
+                image->zero();
+                auto compressed = Image::CompressedImage::create(image);
+                cache.add(1, image);
+                cache.add(2, compressed);
+                cache.add(3, compressed);
+                DJV_ASSERT(3 == cache.getCount());
+                DJV_ASSERT(2 == cache.getCompressedCount());
+                DJV_ASSERT(2 * image->getDataByteCount() == cache.getCompressedDataByteCount());
+                DJV_ASSERT(2 * compressed->getCompressedByteCount() == cache.getCompressedByteCount());
+                DJV_ASSERT(image->getDataByteCount() + cache.getCompressedByteCount() == cache.getTotalByteCount());
+                DJV_ASSERT(Frame::Sequence(Frame::Range(1, 3)) == cache.getFrames());
+                DJV_ASSERT(cache.contains(2));
+                std::shared_ptr<AV::Image::Image> image2;
+                DJV_ASSERT(!cache.get(2, image2));
+                std::shared_ptr<AV::Image::CompressedImage> compressed2;
+                DJV_ASSERT(cache.get(2, compressed2));
+                DJV_ASSERT(!cache.get(1, compressed2));
+
+                // Adding an uncompressed frame replaces the compressed frame.
+                cache.add(2, image);
+                DJV_ASSERT(3 == cache.getCount());
+                DJV_ASSERT(1 == cache.getCompressedCount());
+                DJV_ASSERT(cache.get(2, image2));
+
+                cache.clear();
+                DJV_ASSERT(0 == cache.getCount());
+            }
+
+            {
+                IO::CacheCompressionStats stats;
+                DJV_ASSERT(0.F == stats.getRatio());
+                stats.dataByteCount = 100;
+                stats.compressedByteCount = 25;
+                DJV_ASSERT(4.F == stats.getRatio());
+                DJV_ASSERT(stats == stats);
+                DJV_ASSERT(stats != IO::CacheCompressionStats());
+            }
         }
         
+        void IOTest::_threadController()
+        {
+            {
+                const IO::ThreadController controller;
+                DJV_ASSERT(controller.getThreadMax() == controller.getThreadCount());
+                DJV_ASSERT(controller.getQueueSize() > 0);
+            }
+
+            {
+                IO::ThreadController controller;
+                controller.setThreadMax(8);
+                controller.setQueueSize(4);
+                controller.setSpeed(24.F);
+                DJV_ASSERT(8 == controller.getThreadCount());
+                DJV_ASSERT(8 == controller.getState().threadMax);
+                DJV_ASSERT(4 == controller.getQueueSize());
+                DJV_ASSERT(4 == controller.getQueueSizeMin());
+
+                // Cheap frames only need a single thread, which is reached
+                // one step at a time.
+                auto t = std::chrono::steady_clock::time_point();
+                DJV_ASSERT(!controller.update(t));
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    for (size_t j = 0; j < 12; ++j)
+                    {
+                        controller.addDecode(.005);
+                    }
+                    t += std::chrono::seconds(1);
+                    controller.update(t);
+                }
+                DJV_ASSERT(1 == controller.getThreadCount());
+                DJV_ASSERT(4 == controller.getQueueSize());
+                {
+                    std::stringstream ss;
+                    ss << "decode time: " << controller.getState().decodeTime;
+                    _print(ss.str());
+                }
+
+                // Expensive frames need enough threads to keep up.
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    for (size_t j = 0; j < 12; ++j)
+                    {
+                        controller.addDecode(.2);
+                    }
+                    t += std::chrono::seconds(1);
+                    controller.update(t);
+                }
+                DJV_ASSERT(6 == controller.getThreadCount());
+
+                // Starving the queue adds a thread and grows the queue.
+                controller.addDecode(.2);
+                controller.addStarved();
+                t += std::chrono::seconds(1);
+                DJV_ASSERT(controller.update(t));
+                DJV_ASSERT(7 == controller.getThreadCount());
+                DJV_ASSERT(8 == controller.getQueueSize());
+                DJV_ASSERT(4 == controller.getQueueSizeMin());
+                DJV_ASSERT(1 == controller.getState().starvedCount);
+
+                // The queue shrinks back once playback keeps up.
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    controller.addDecode(.2);
+                    t += std::chrono::seconds(1);
+                    controller.update(t);
+                }
+                DJV_ASSERT(6 == controller.getThreadCount());
+                DJV_ASSERT(4 == controller.getQueueSize());
+
+                // The thread count is limited by the maximum.
+                controller.setThreadMax(2);
+                DJV_ASSERT(2 == controller.getThreadCount());
+            }
+
+            {
+                IO::ThreadController controller;
+                controller.setThreadMax(4);
+                auto t = std::chrono::steady_clock::time_point();
+                controller.update(t);
+                controller.addWait(.25);
+                t += std::chrono::seconds(1);
+                controller.update(t);
+                DJV_ASSERT(fuzzyCompare(controller.getState().waitTime, .25F));
+            }
+
+            {
+                IO::ThreadControllerState a;
+                IO::ThreadControllerState b;
+                DJV_ASSERT(a == b);
+                b.threadCount = 2;
+                DJV_ASSERT(a != b);
+            }
+        }
+
         void IOTest::_io()
         {
             if (auto context = getContext().lock())
@@ -380,6 +531,97 @@ namespace djv
             }
         }
         
+        void IOTest::_wav()
+        {
+            if (auto context = getContext().lock())
+            {
+                const std::string fileName = "IOTest.wav";
+                const size_t sampleCount = 10000;
+                const uint8_t channelCount = 2;
+                {
+                    const uint32_t dataSize = static_cast<uint32_t>(sampleCount * channelCount * 2);
+                    FileSystem::FileIO io;
+                    io.open(fileName, FileSystem::FileIO::Mode::Write);
+                    io.write("RIFF", 4);
+                    io.writeU32(36 + dataSize);
+                    io.write("WAVEfmt ", 8);
+                    io.writeU32(16);
+                    io.writeU16(1);
+                    io.writeU16(channelCount);
+                    io.writeU32(44100);
+                    io.writeU32(44100 * channelCount * 2);
+                    io.writeU16(channelCount * 2);
+                    io.writeU16(16);
+                    io.write("data", 4);
+                    io.writeU32(dataSize);
+                    for (size_t i = 0; i < sampleCount; ++i)
+                    {
+                        for (uint8_t c = 0; c < channelCount; ++c)
+                        {
+                            io.write16(static_cast<int16_t>(i * channelCount + c));
+                        }
+                    }
+                }
+
+                auto io = context->getSystemT<AV::IO::System>();
+                auto read = io->read(FileSystem::FileInfo(fileName));
+                const auto info = read->getInfo().get();
+                DJV_ASSERT(1 == info.audio.size());
+                const auto& audioInfo = info.audio[0].info;
+                DJV_ASSERT(channelCount == audioInfo.channelCount);
+                DJV_ASSERT(Audio::Type::S16 == audioInfo.type);
+                DJV_ASSERT(44100 == audioInfo.sampleRate);
+                DJV_ASSERT(sampleCount == audioInfo.sampleCount);
+
+                // Seeking takes a frame, which is converted to a sample with
+                // the default speed.
+                const Time::Speed speed;
+                for (const int64_t seek : { static_cast<int64_t>(0), static_cast<int64_t>(5) })
+                {
+                    read->seek(seek, IO::Direction::Forward);
+                    size_t sample = static_cast<size_t>(Time::scale(seek, speed.swap(), Math::Rational(1, 44100)));
+                    DJV_ASSERT(seek == 0 || (sample > 0 && sample < sampleCount));
+                    bool running = true;
+                    while (running)
+                    {
+                        bool sleep = false;
+                        {
+                            std::lock_guard<std::mutex> lock(read->getMutex());
+                            auto& readQueue = read->getAudioQueue();
+                            if (!readQueue.isEmpty())
+                            {
+                                auto frame = readQueue.popFrame();
+                                const auto* p = reinterpret_cast<const Audio::S16_T*>(frame.audio->getData());
+                                for (size_t i = 0; i < frame.audio->getSampleCount(); ++i, ++sample)
+                                {
+                                    for (uint8_t c = 0; c < channelCount; ++c, ++p)
+                                    {
+                                        DJV_ASSERT(static_cast<int16_t>(sample * channelCount + c) == *p);
+                                    }
+                                }
+                            }
+                            else if (readQueue.isFinished())
+                            {
+                                running = false;
+                            }
+                            else
+                            {
+                                sleep = true;
+                            }
+                        }
+                        if (sleep)
+                        {
+                            std::this_thread::sleep_for(Time::getTime(Time::TimerValue::Fast));
+                        }
+                    }
+                    DJV_ASSERT(sampleCount == sample);
+                }
+
+                read.reset();
+                std::remove(fileName.c_str());
+            }
+        }
+
         void IOTest::_system()
         {
             if (auto context = getContext().lock())
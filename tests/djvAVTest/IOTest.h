@@ -49,7 +49,9 @@ namespace djv
             void _audioFrame();
             void _audioQueue();
             void _cache();
+            void _threadController();
             void _io();
+            void _wav();
             void _system();
             void _operators();
         };
@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAVTest/ImageCompressTest.h>
+
+#include <djvAV/ImageCompress.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ImageCompressTest::ImageCompressTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ImageCompressTest", context)
+        {}
+        
+        void ImageCompressTest::run(const std::vector<std::string>& args)
+        {
+            _compress();
+            _shuffle();
+            _image();
+        }
+
+        void ImageCompressTest::_compress()
+        {
+            std::vector<std::vector<uint8_t> > data;
+            for (size_t size : { 0, 1, 4, 5, 16, 1000, 100000 })
+            {
+                std::vector<uint8_t> zeros(size, 0);
+                data.push_back(zeros);
+                std::vector<uint8_t> ramp(size);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    ramp[i] = i % 7;
+                }
+                data.push_back(ramp);
+                std::vector<uint8_t> noise(size);
+                uint32_t seed = 1;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    seed = seed * 1103515245 + 12345;
+                    noise[i] = seed >> 24;
+                }
+                data.push_back(noise);
+            }
+            for (const auto& i : data)
+            {
+                std::vector<uint8_t> compressed(Image::getCompressBound(i.size()));
+                const size_t size = Image::compress(i.data(), i.size(), compressed.data());
+                DJV_ASSERT(size <= compressed.size());
+                std::vector<uint8_t> out(i.size());
+                DJV_ASSERT(Image::decompress(compressed.data(), size, out.data(), out.size()));
+                DJV_ASSERT(i == out);
+                if (i.size() >= 1000)
+                {
+                    std::stringstream ss;
+                    ss << "compress: " << i.size() << " -> " << size;
+                    _print(ss.str());
+                }
+            }
+
+            {
+                const std::vector<uint8_t> in(1000, 0);
+                std::vector<uint8_t> compressed(Image::getCompressBound(in.size()));
+                const size_t size = Image::compress(in.data(), in.size(), compressed.data());
+                DJV_ASSERT(size < in.size() / 10);
+                std::vector<uint8_t> out(in.size());
+                DJV_ASSERT(!Image::decompress(compressed.data(), size - 1, out.data(), out.size()));
+                DJV_ASSERT(!Image::decompress(compressed.data(), size, out.data(), out.size() - 1));
+                compressed[1] = 0;
+                compressed[2] = 0;
+                DJV_ASSERT(!Image::decompress(compressed.data(), size, out.data(), out.size()));
+            }
+
+            {
+                // The LZ4 block format ends with at least five literals, so
+                // the end of the compressed data is the end of the input.
+                std::vector<uint8_t> in(1000);
+                for (size_t i = 0; i < in.size(); ++i)
+                {
+                    in[i] = static_cast<uint8_t>('a' + i % 8);
+                }
+                std::vector<uint8_t> compressed(Image::getCompressBound(in.size()));
+                const size_t size = Image::compress(in.data(), in.size(), compressed.data());
+                DJV_ASSERT(size < in.size() / 10);
+                DJV_ASSERT(0 == memcmp(compressed.data() + size - 5, in.data() + in.size() - 5, 5));
+                DJV_ASSERT((compressed[size - 6] >> 4) >= 5);
+            }
+        }
+
+        void ImageCompressTest::_shuffle()
+        {
+            for (size_t stride : { 1, 2, 3, 8 })
+            {
+                std::vector<uint8_t> in(101);
+                for (size_t i = 0; i < in.size(); ++i)
+                {
+                    in[i] = static_cast<uint8_t>(i * 31);
+                }
+                std::vector<uint8_t> tmp(in.size());
+                Image::shuffle(in.data(), in.size(), stride, tmp.data());
+                std::vector<uint8_t> out(in.size());
+                Image::unshuffle(tmp.data(), tmp.size(), stride, out.data());
+                DJV_ASSERT(in == out);
+            }
+        }
+
+        void ImageCompressTest::_image()
+        {
+            {
+                auto image = Image::Image::create(Image::Info(64, 32, Image::Type::RGBA_F16));
+                image->setPluginName("ImageCompressTest");
+                Tags tags;
+                tags.setTag("Key", "Value");
+                image->setTags(tags);
+                Image::F16_T* p = reinterpret_cast<Image::F16_T*>(image->getData());
+                for (uint16_t y = 0; y < 32; ++y)
+                {
+                    for (uint16_t x = 0; x < 64; ++x, p += 4)
+                    {
+                        p[0] = x / 63.F;
+                        p[1] = y / 31.F;
+                        p[2] = .5F;
+                        p[3] = 1.F;
+                    }
+                }
+                auto compressed = Image::CompressedImage::create(image);
+                DJV_ASSERT(compressed->getInfo() == image->getInfo());
+                DJV_ASSERT(compressed->getDataByteCount() == image->getDataByteCount());
+                DJV_ASSERT(compressed->getCompressedByteCount() < image->getDataByteCount());
+                DJV_ASSERT(compressed->getRatio() > 1.F);
+                std::stringstream ss;
+                ss << "compressed image ratio: " << compressed->getRatio();
+                _print(ss.str());
+                auto out = compressed->decompress();
+                DJV_ASSERT(out);
+                DJV_ASSERT(*out == *image);
+                DJV_ASSERT(out->getPluginName() == image->getPluginName());
+                DJV_ASSERT(out->getTags() == image->getTags());
+            }
+
+            {
+                auto image = Image::Image::create(Image::Info(16, 16, Image::Type::RGB_U8));
+                uint8_t* p = image->getData();
+                uint32_t seed = 1;
+                for (size_t i = 0; i < image->getDataByteCount(); ++i)
+                {
+                    seed = seed * 1103515245 + 12345;
+                    p[i] = seed >> 24;
+                }
+                auto compressed = Image::CompressedImage::create(image);
+                DJV_ASSERT(compressed->getCompressedByteCount() <= image->getDataByteCount());
+                auto out = compressed->decompress();
+                DJV_ASSERT(out);
+                DJV_ASSERT(*out == *image);
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
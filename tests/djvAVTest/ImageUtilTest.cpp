@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAVTest/ImageUtilTest.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/ImageUtil.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ImageUtilTest::ImageUtilTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ImageUtilTest", context)
+        {}
+        
+        void ImageUtilTest::run(const std::vector<std::string>& args)
+        {
+            _resize();
+            _mipmap();
+        }
+
+        void ImageUtilTest::_resize()
+        {
+            {
+                auto in = Image::Data::create(Image::Info(8, 8, Image::Type::RGBA_F32));
+                float* p = reinterpret_cast<float*>(in->getData());
+                for (size_t i = 0; i < 8 * 8 * 4; ++i)
+                {
+                    p[i] = .5F;
+                }
+                auto out = Image::Data::create(Image::Info(3, 2, Image::Type::RGBA_F32));
+                Image::resize(*in, *out);
+                const float* outP = reinterpret_cast<const float*>(out->getData());
+                for (size_t i = 0; i < 3 * 2 * 4; ++i)
+                {
+                    DJV_ASSERT(fuzzyCompare(outP[i], .5F, .1e-5F));
+                }
+            }
+
+            {
+                auto in = Image::Data::create(Image::Info(1, 2, Image::Type::L_F32, Image::Layout(Image::Mirror(false, true))));
+                float* p = reinterpret_cast<float*>(in->getData());
+                p[0] = 0.F;
+                p[1] = 1.F;
+                auto out = Image::Data::create(Image::Info(1, 2, Image::Type::L_F32));
+                Image::resize(*in, *out);
+                const float* outP = reinterpret_cast<const float*>(out->getData());
+                DJV_ASSERT(fuzzyCompare(outP[0], 1.F));
+                DJV_ASSERT(fuzzyCompare(outP[1], 0.F));
+            }
+
+            {
+                auto in = Image::Data::create(Image::Info(64, 32, Image::Type::RGB_U8));
+                in->zero();
+                auto out = Image::Data::create(Image::Info(16, 16, Image::Type::RGBA_U16));
+                Image::resize(*in, *out);
+                const uint16_t* outP = reinterpret_cast<const uint16_t*>(out->getData(0, 0));
+                DJV_ASSERT(0 == outP[0]);
+                DJV_ASSERT(Image::U16Range.max == outP[3]);
+            }
+        }
+
+        void ImageUtilTest::_mipmap()
+        {
+            DJV_ASSERT(Image::Size(256, 128) == Image::getMipmapSize(Image::Size(1024, 512), 2));
+            DJV_ASSERT(Image::Size(1, 1) == Image::getMipmapSize(Image::Size(4, 2), 4));
+
+            {
+                auto in = Image::Data::create(Image::Info(5, 3, Image::Type::L_U8));
+                for (uint16_t y = 0; y < 3; ++y)
+                {
+                    uint8_t* p = in->getData(y);
+                    for (uint16_t x = 0; x < 5; ++x)
+                    {
+                        p[x] = x < 4 ? (x % 2 ? 100 : 200) : 10;
+                    }
+                }
+                auto out = Image::Data::create(Image::Info(Image::getMipmapSize(in->getSize(), 1), Image::Type::L_U8));
+                DJV_ASSERT(Image::Size(2, 1) == out->getSize());
+                Image::mipmap(*in, *out, 1);
+                const uint8_t* outP = out->getData();
+                DJV_ASSERT(150 == outP[0]);
+                DJV_ASSERT(150 == outP[1]);
+            }
+
+            {
+                auto in = Image::Data::create(Image::Info(4, 4, Image::Type::RGBA_F32));
+                float* p = reinterpret_cast<float*>(in->getData());
+                for (size_t i = 0; i < 4 * 4 * 4; ++i)
+                {
+                    p[i] = (i / 4) % 2 ? 1.F : 0.F;
+                }
+                auto out = Image::Data::create(Image::Info(1, 1, Image::Type::RGBA_F32));
+                Image::mipmap(*in, *out, 2);
+                const float* outP = reinterpret_cast<const float*>(out->getData());
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    DJV_ASSERT(fuzzyCompare(outP[i], .5F));
+                }
+            }
+        }
+                
+    } // namespace AVTest
+} // namespace djv
@@ -29,7 +29,11 @@
 
 #include <djvAVTest/OCIOTest.h>
 
+#include <djvAV/ImageData.h>
 #include <djvAV/OCIO.h>
+#include <djvAV/OCIOProcessor.h>
+
+#include <djvCore/Math.h>
 
 using namespace djv::Core;
 using namespace djv::AV;
@@ -48,6 +52,7 @@ namespace djv
             _view();
             _display();
             _operators();
+            _processor();
         }
 
         void OCIOTest::_convert()
@@ -114,6 +119,39 @@ namespace djv
             }
         }
 
+        void OCIOTest::_processor()
+        {
+            try
+            {
+                OCIO::Processor::create(OCIO::Convert("djvOCIOTestInput", "djvOCIOTestOutput"));
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception&)
+            {}
+
+            {
+                auto processor = OCIO::Processor::create(OCIO::Convert("raw", "raw"), 17);
+                DJV_ASSERT(17 == processor->getLUT3DEdgeLen());
+                processor->setThreadCount(0);
+                DJV_ASSERT(1 == processor->getThreadCount());
+                processor->setThreadCount(3);
+                DJV_ASSERT(3 == processor->getThreadCount());
+
+                auto data = Image::Data::create(Image::Info(16, 16, Image::Type::RGBA_F32));
+                float* p = reinterpret_cast<float*>(data->getData());
+                const size_t size = 16 * 16 * 4;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    p[i] = i / static_cast<float>(size - 1);
+                }
+                processor->apply(*data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    DJV_ASSERT(fuzzyCompare(p[i], i / static_cast<float>(size - 1), .001F));
+                }
+            }
+        }
+
     } // namespace AVTest
 } // namespace djv
 
@@ -45,6 +45,7 @@ namespace djv
             void _view();
             void _display();
             void _operators();
+            void _processor();
         };
         
     } // namespace AVTest
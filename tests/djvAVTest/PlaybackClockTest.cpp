@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAVTest/PlaybackClockTest.h>
+
+#include <djvAV/PlaybackClock.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        PlaybackClockTest::PlaybackClockTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::PlaybackClockTest", context)
+        {}
+        
+        void PlaybackClockTest::run(const std::vector<std::string>& args)
+        {
+            _system();
+            _audio();
+            _presentation();
+        }
+
+        void PlaybackClockTest::_system()
+        {
+            auto clock = PlaybackClock::create();
+            const auto t = std::chrono::steady_clock::now();
+            clock->start(t);
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t), 0.0));
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::milliseconds(500)), .5));
+
+            // The time does not go backwards.
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t), .5));
+
+            clock->start(t + std::chrono::seconds(1));
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::seconds(2)), 1.0));
+        }
+
+        void PlaybackClockTest::_audio()
+        {
+            auto clock = PlaybackClock::create();
+            const auto t = std::chrono::steady_clock::now();
+            clock->start(t);
+            clock->setAudio(48000, 4800);
+
+            // The clock waits for the audio.
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::seconds(1)), 0.0));
+
+            // The latency is subtracted from the audio time.
+            clock->setAudioSamples(48000, t + std::chrono::seconds(1));
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::seconds(1)), .9));
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::milliseconds(1100)), 1.0));
+
+            // Measure an audio device that runs slow.
+            clock->setAudioSamples(48000 + 47520, t + std::chrono::seconds(2));
+            DJV_ASSERT(fuzzyCompare(clock->getDrift(), .99));
+            DJV_ASSERT(fuzzyCompare(clock->getTime(t + std::chrono::seconds(2)), 1.89));
+
+            clock->setAudio(0, 0);
+            DJV_ASSERT(fuzzyCompare(clock->getDrift(), 1.0));
+        }
+
+        void PlaybackClockTest::_presentation()
+        {
+            auto clock = PlaybackClock::create();
+            clock->addPresentation(-.003, 1.0 / 24.0);
+            clock->addPresentation(0.0, 1.0 / 24.0);
+            clock->addPresentation(.01, 1.0 / 24.0);
+            clock->addPresentation(.1, 1.0 / 24.0);
+            clock->addDropped(2);
+            const auto& stats = clock->getPresentationStats();
+            DJV_ASSERT(1 == stats.early);
+            DJV_ASSERT(2 == stats.onTime);
+            DJV_ASSERT(1 == stats.late);
+            DJV_ASSERT(2 == stats.dropped);
+            DJV_ASSERT(presentationHistogramSize == stats.histogram.size());
+            DJV_ASSERT(1 == stats.histogram[presentationHistogramSize / 2]);
+            DJV_ASSERT(1 == stats.histogram[presentationHistogramSize / 2 - 2]);
+            DJV_ASSERT(1 == stats.histogram[presentationHistogramSize - 1]);
+            DJV_ASSERT(stats != PresentationStats());
+
+            clock->resetPresentationStats();
+            DJV_ASSERT(clock->getPresentationStats() == PresentationStats());
+        }
+                
+    } // namespace AVTest
+} // namespace djv
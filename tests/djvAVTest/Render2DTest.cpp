@@ -53,6 +53,8 @@ namespace djv
         {
             _operators();
             _system();
+            _record();
+            _textRun();
         }
         
         void Render2DTest::_system()
@@ -138,6 +140,87 @@ namespace djv
             }
         }
 
+        void Render2DTest::_record()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto render = Render::Render2D::create(context, Render::Backend::Record);
+                DJV_ASSERT(Render::Backend::Record == render->getBackend());
+                const Image::Size size(1280, 720);
+                render->beginFrame(size);
+                render->setFillColor(Image::Color(.6F, .4F, 1.F));
+                render->drawRect(BBox2f(100.F, 100.F, 300.F, 200.F));
+                render->drawRect(BBox2f(400.F, 100.F, 300.F, 200.F));
+                render->setFillColor(Image::Color(1.F, .6F, .4F));
+                render->drawRect(BBox2f(700.F, 100.F, 300.F, 200.F));
+                auto image = Image::Image::create(Image::Info(64, 64, AV::Image::Type::RGBA_U8));
+                image->zero();
+                render->drawImage(image, glm::vec2(600.f, 400.f));
+                render->endFrame();
+                DJV_ASSERT(4 == render->getPrimitiveCount());
+                DJV_ASSERT(3 == render->getDrawCallCount());
+                DJV_ASSERT(render->getVBODataByteCount() > 0);
+                DJV_ASSERT(0 == render->getVBOSize());
+            }
+        }
+
+        void Render2DTest::_textRun()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto render = Render::Render2D::create(context, Render::Backend::Record);
+                auto createGlyph = [](uint16_t width, uint16_t height)
+                {
+                    auto out = Font::Glyph::create();
+                    out->imageData = Image::Data::create(Image::Info(width, height, Image::Type::L_U8));
+                    out->advance = width;
+                    return out;
+                };
+                const Image::Size size(1280, 720);
+
+                Render::TextRun run({ createGlyph(16, 16), createGlyph(16, 16) });
+                for (size_t i = 0; i < 2; ++i)
+                {
+                    render->beginFrame(size);
+                    render->drawText(run, glm::vec2(0.F, 0.F));
+                    render->endFrame();
+                    DJV_ASSERT(1 == render->getTextRunLayoutCount());
+                }
+
+                // Fill the texture atlas with large glyphs so items are
+                // evicted, the run should be laid out again.
+                std::vector<std::shared_ptr<Font::Glyph> > glyphs;
+                for (size_t i = 0; i < 5; ++i)
+                {
+                    glyphs.push_back(createGlyph(8192, 4097));
+                }
+                render->beginFrame(size);
+                for (const auto& i : glyphs)
+                {
+                    render->drawText({ i }, glm::vec2(0.F, 0.F));
+                }
+                render->endFrame();
+                DJV_ASSERT(render->getTextureAtlasEvictionCount() > 0);
+                render->beginFrame(size);
+                render->drawText(run, glm::vec2(0.F, 0.F));
+                render->endFrame();
+                DJV_ASSERT(2 == render->getTextRunLayoutCount());
+
+                // A run whose glyphs do not all fit in the texture atlas evicts
+                // its own glyphs, so it should not be marked as laid out.
+                Render::TextRun largeRun(glyphs);
+                render->beginFrame(size);
+                render->drawText(largeRun, glm::vec2(0.F, 0.F));
+                render->endFrame();
+                const size_t layoutCount = render->getTextRunLayoutCount();
+                DJV_ASSERT(layoutCount > 3);
+                render->beginFrame(size);
+                render->drawText(largeRun, glm::vec2(0.F, 0.F));
+                render->endFrame();
+                DJV_ASSERT(render->getTextRunLayoutCount() > layoutCount);
+            }
+        }
+
         void Render2DTest::_operators()
         {
             {
@@ -42,6 +42,8 @@ namespace djv
             
         private:
             void _system();
+            void _record();
+            void _textRun();
             void _operators();
         };
         
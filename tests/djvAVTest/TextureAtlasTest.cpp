@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+#include <djvAVTest/TextureAtlasTest.h>
+
+#include <djvAV/TextureAtlas.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        TextureAtlasTest::TextureAtlasTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::TextureAtlasTest", context)
+        {}
+        
+        void TextureAtlasTest::run(const std::vector<std::string>& args)
+        {
+            _items();
+            _eviction();
+        }
+
+        void TextureAtlasTest::_items()
+        {
+            Render::TextureAtlas atlas(2, 64, Image::Type::L_U8, GL_NEAREST, 0);
+            DJV_ASSERT(2 == atlas.getTextureCount());
+            DJV_ASSERT(64 == atlas.getTextureSize());
+            DJV_ASSERT(Image::Type::L_U8 == atlas.getTextureType());
+            DJV_ASSERT(2 == atlas.getTextures().size());
+
+            auto data = Image::Data::create(Image::Info(16, 16, Image::Type::L_U8));
+            data->zero();
+            Render::TextureAtlasItem item;
+            const UID uid = atlas.addItem(data, item);
+            DJV_ASSERT(uid != 0);
+            DJV_ASSERT(16 == item.w);
+            DJV_ASSERT(16 == item.h);
+            DJV_ASSERT(0 == item.textureIndex);
+            DJV_ASSERT(0.F == item.textureU.min);
+            DJV_ASSERT(.25F == item.textureU.max);
+            Render::TextureAtlasItem item2;
+            DJV_ASSERT(atlas.getItem(uid, item2));
+            DJV_ASSERT(item.textureU == item2.textureU);
+            DJV_ASSERT(item.textureV == item2.textureV);
+            DJV_ASSERT(!atlas.getItem(uid + 1, item2));
+
+            const auto pageStats = atlas.getPageStats();
+            DJV_ASSERT(2 == pageStats.size());
+            DJV_ASSERT(1 == pageStats[0].itemCount);
+            DJV_ASSERT(1 == pageStats[0].shelfCount);
+            DJV_ASSERT(pageStats[0].occupancy > 0.F);
+            DJV_ASSERT(0 == pageStats[1].itemCount);
+            DJV_ASSERT(atlas.getPercentageUsed() > 0.F);
+
+            auto tooBig = Image::Data::create(Image::Info(65, 16, Image::Type::L_U8));
+            DJV_ASSERT(0 == atlas.addItem(tooBig, item));
+        }
+
+        void TextureAtlasTest::_eviction()
+        {
+            Render::TextureAtlas atlas(1, 64, Image::Type::L_U8, GL_NEAREST, 0);
+            auto data = Image::Data::create(Image::Info(16, 16, Image::Type::L_U8));
+            data->zero();
+            std::vector<UID> uids;
+            Render::TextureAtlasItem item;
+            for (size_t i = 0; i < 16; ++i)
+            {
+                uids.push_back(atlas.addItem(data, item));
+            }
+            DJV_ASSERT(100.F == atlas.getPercentageUsed());
+            DJV_ASSERT(0 == atlas.getEvictionCount());
+
+            // Use the first shelf so the second shelf is evicted.
+            for (size_t i = 0; i < 4; ++i)
+            {
+                DJV_ASSERT(atlas.getItem(uids[i], item));
+            }
+            const size_t generation = atlas.getGeneration();
+            auto small = Image::Data::create(Image::Info(8, 14, Image::Type::L_U8));
+            small->zero();
+            const UID uid = atlas.addItem(small, item);
+            DJV_ASSERT(uid != 0);
+            DJV_ASSERT(1 == atlas.getEvictionCount());
+            DJV_ASSERT(atlas.getGeneration() > generation);
+            for (size_t i = 0; i < 4; ++i)
+            {
+                DJV_ASSERT(atlas.getItem(uids[i], item));
+            }
+            for (size_t i = 4; i < 8; ++i)
+            {
+                DJV_ASSERT(!atlas.getItem(uids[i], item));
+            }
+
+            // Compacting must keep the remaining items.
+            const float percentageUsed = atlas.getPercentageUsed();
+            atlas.compact();
+            DJV_ASSERT(percentageUsed == atlas.getPercentageUsed());
+            DJV_ASSERT(atlas.getItem(uid, item));
+            for (size_t i = 0; i < 4; ++i)
+            {
+                DJV_ASSERT(atlas.getItem(uids[i], item));
+            }
+            for (size_t i = 8; i < 16; ++i)
+            {
+                DJV_ASSERT(atlas.getItem(uids[i], item));
+            }
+
+            // Items must be placed in taller shelves after they are evicted.
+            Render::TextureAtlas atlas2(1, 64, Image::Type::L_U8, GL_NEAREST, 0);
+            auto tall = Image::Data::create(Image::Info(16, 32, Image::Type::L_U8));
+            tall->zero();
+            for (size_t i = 0; i < 8; ++i)
+            {
+                DJV_ASSERT(atlas2.addItem(tall, item) != 0);
+            }
+            const UID uid2 = atlas2.addItem(data, item);
+            DJV_ASSERT(uid2 != 0);
+            DJV_ASSERT(1 == atlas2.getEvictionCount());
+            atlas2.compact();
+            DJV_ASSERT(atlas2.getItem(uid2, item));
+        }
+        
+    } // namespace AVTest
+} // namespace djv
@@ -36,6 +36,8 @@
 #include <djvCore/ResourceSystem.h>
 #include <djvCore/Timer.h>
 
+#include <thread>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -56,6 +58,9 @@ namespace djv
                     resourceSystem->getPath(FileSystem::ResourcePath::Icons),
                     "96DPI/djvIconFile.png"));
                 auto system = context->getSystemT<ThumbnailSystem>();
+                system->setPaused(true);
+                DJV_ASSERT(system->isPaused());
+                const size_t droppedRequestCount = system->getDroppedRequestCount();
                 auto infoFuture = system->getInfo(fileInfo);
                 auto imageFuture = system->getImage(fileInfo, Image::Size(32, 32));
                 
@@ -63,6 +68,29 @@ namespace djv
                 auto imageCancelFuture = system->getImage(fileInfo, Image::Size(32, 32));
                 system->cancelInfo(infoCancelFuture.uid);
                 system->cancelImage(imageCancelFuture.uid);
+
+                ThumbnailSystem::RequestOptions requestOptions;
+                requestOptions.generation = std::make_shared<ThumbnailSystem::Generation>();
+                auto infoStaleFuture = system->getInfo(fileInfo, requestOptions);
+                auto imageStaleFuture = system->getImage(fileInfo, Image::Size(32, 32), Image::Type::None, requestOptions);
+                requestOptions.priority = 1;
+                system->setInfoOptions(infoStaleFuture.uid, requestOptions);
+                system->setImageOptions(imageStaleFuture.uid, requestOptions);
+                requestOptions.generation->set(1);
+                DJV_ASSERT(requestOptions.generation->get() == 1);
+                DJV_ASSERT(2 == system->getInfoRequestCount());
+                DJV_ASSERT(2 == system->getImageRequestCount());
+                {
+                    std::stringstream ss;
+                    ss << "info request count: " << system->getInfoRequestCount();
+                    _print(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "image request count: " << system->getImageRequestCount();
+                    _print(ss.str());
+                }
+                system->setPaused(false);
                 
                 IO::Info info;
                 std::shared_ptr<Image::Image> image;
@@ -83,6 +111,66 @@ namespace djv
                     }
                 }
                 
+                DJV_ASSERT(info.video.size());
+                DJV_ASSERT(image);
+
+                // The stale requests are dropped without being handled.
+                try
+                {
+                    infoStaleFuture.future.get();
+                    DJV_ASSERT(false);
+                }
+                catch (const std::future_error&)
+                {}
+                try
+                {
+                    imageStaleFuture.future.get();
+                    DJV_ASSERT(false);
+                }
+                catch (const std::future_error&)
+                {}
+                DJV_ASSERT(system->getDroppedRequestCount() - droppedRequestCount == 2);
+
+                // The higher priority request is handled first. The remaining
+                // lower priority requests are made stale once it finishes, so
+                // the ones that have not been started are dropped.
+                {
+                    system->setPaused(true);
+                    ThumbnailSystem::RequestOptions lowOptions;
+                    lowOptions.priority = 1;
+                    lowOptions.generation = std::make_shared<ThumbnailSystem::Generation>();
+                    std::vector<ThumbnailSystem::ImageFuture> lowFutures;
+                    const size_t lowCount = std::thread::hardware_concurrency() * 10 + 10;
+                    for (size_t i = 0; i < lowCount; ++i)
+                    {
+                        const uint16_t size = static_cast<uint16_t>(64 + i);
+                        lowFutures.push_back(system->getImage(fileInfo, Image::Size(size, size), Image::Type::None, lowOptions));
+                    }
+                    auto highFuture = system->getImage(fileInfo, Image::Size(16, 16));
+                    DJV_ASSERT(lowCount + 1 == system->getImageRequestCount());
+                    system->setPaused(false);
+                    DJV_ASSERT(highFuture.future.get());
+                    lowOptions.generation->set(1);
+                    size_t dropped = 0;
+                    for (auto& i : lowFutures)
+                    {
+                        try
+                        {
+                            i.future.get();
+                        }
+                        catch (const std::future_error&)
+                        {
+                            ++dropped;
+                        }
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << "dropped low priority requests: " << dropped << "/" << lowCount;
+                        _print(ss.str());
+                    }
+                    DJV_ASSERT(dropped > 0);
+                }
+                
                 if (info.video.size())
                 {
                     std::stringstream ss;
@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions, and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions, and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the names of the copyright holders nor the names of any
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//------------------------------------------------------------------------------
+
+
+#include <djvAVTest/TiledImageTest.h>
+
+#include <djvAV/TiledImage.h>
+
+#include <cstring>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        TiledImageTest::TiledImageTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::TiledImageTest", context)
+        {}
+        
+        void TiledImageTest::run(const std::vector<std::string>& args)
+        {
+            _info();
+            _tiles();
+            _requests();
+        }
+
+        void TiledImageTest::_info()
+        {
+            {
+                const Image::TiledInfo info;
+                DJV_ASSERT(!info.isValid());
+                DJV_ASSERT(0 == info.getTileColumns());
+                DJV_ASSERT(0 == info.getTileRows());
+            }
+            {
+                const Image::TiledInfo info(100000, 1000, Image::Size(512, 256), Image::Type::RGBA_F32);
+                DJV_ASSERT(info.isValid());
+                DJV_ASSERT(196 == info.getTileColumns());
+                DJV_ASSERT(4 == info.getTileRows());
+                DJV_ASSERT(Image::Size(512, 256) == info.getTileInfo(0, 0).size);
+                DJV_ASSERT(Image::Size(160, 232) == info.getTileInfo(195, 3).size);
+                DJV_ASSERT(Image::Type::RGBA_F32 == info.getTileInfo(0, 0).type);
+                DJV_ASSERT(info == info);
+                DJV_ASSERT(info != Image::TiledInfo());
+            }
+        }
+
+        void TiledImageTest::_tiles()
+        {
+            const Image::TiledInfo info(1000, 1000, Image::Size(256, 256), Image::Type::L_U8);
+            auto image = Image::TiledImage::create(
+                info,
+                [info](uint32_t column, uint32_t row)
+                {
+                    auto out = Image::Image::create(info.getTileInfo(column, row));
+                    out->zero();
+                    *out->getData() = static_cast<uint8_t>(row * info.getTileColumns() + column);
+                    return out;
+                });
+            DJV_ASSERT(info == image->getInfo());
+            DJV_ASSERT(!image->hasTile(0, 0));
+
+            auto tile = image->getTile(1, 2);
+            DJV_ASSERT(9 == *tile->getData());
+            DJV_ASSERT(image->hasTile(1, 2));
+            DJV_ASSERT(tile == image->getTile(1, 2));
+            DJV_ASSERT(1 == image->getTileReadCount());
+            DJV_ASSERT(tile->getDataByteCount() == image->getTileCacheByteCount());
+
+            // Fill the cache past the maximum so the least recently used tile
+            // is removed.
+            const size_t tileByteCount = info.getTileInfo(0, 0).getDataByteCount();
+            image->setTileCacheMax(tileByteCount * 2);
+            image->getTile(0, 0);
+            image->getTile(1, 2);
+            image->getTile(2, 2);
+            DJV_ASSERT(!image->hasTile(0, 0));
+            DJV_ASSERT(image->hasTile(1, 2));
+            DJV_ASSERT(image->hasTile(2, 2));
+            DJV_ASSERT(image->getTileCacheByteCount() <= image->getTileCacheMax());
+            DJV_ASSERT(3 == image->getTileReadCount());
+        }
+
+        void TiledImageTest::_requests()
+        {
+            const Image::TiledInfo info(4096, 2048, Image::Size(512, 512), Image::Type::L_U8);
+            auto image = Image::TiledImage::create(
+                info,
+                [info](uint32_t column, uint32_t row)
+                {
+                    auto out = Image::Image::create(info.getTileInfo(column, row));
+                    memset(out->getData(), static_cast<uint8_t>(row * info.getTileColumns() + column + 1), out->getDataByteCount());
+                    return out;
+                });
+            DJV_ASSERT(!image->getCachedTile(0, 0));
+            auto overview = image->getOverview();
+            DJV_ASSERT(overview);
+            DJV_ASSERT(1024 == overview->getWidth());
+            DJV_ASSERT(512 == overview->getHeight());
+            DJV_ASSERT(0 == *overview->getData());
+
+            // Read all of the tiles in the background.
+            const uint32_t columns = info.getTileColumns();
+            const uint32_t rows = info.getTileRows();
+            size_t requested = 0;
+            while (requested < columns * rows || image->getTileRequestCount() > 0)
+            {
+                if (requested < columns * rows &&
+                    image->requestTile(requested % columns, static_cast<uint32_t>(requested / columns)))
+                {
+                    ++requested;
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            DJV_ASSERT(!image->requestTile(0, 0));
+            DJV_ASSERT(image->getTileRequestErrors().empty());
+            DJV_ASSERT(columns * rows == image->getTileReadCount());
+            for (uint32_t row = 0; row < rows; ++row)
+            {
+                for (uint32_t column = 0; column < columns; ++column)
+                {
+                    DJV_ASSERT(image->getCachedTile(column, row));
+                    DJV_ASSERT(image->hasOverviewTile(column, row));
+                }
+            }
+
+            // Check that the overview was filled in from the tiles.
+            overview = image->getOverview();
+            DJV_ASSERT(1 == *overview->getData(0, 0));
+            DJV_ASSERT(columns * rows == *overview->getData(1023, 511));
+        }
+        
+    } // namespace AVTest
+} // namespace djv
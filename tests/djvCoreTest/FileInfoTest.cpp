@@ -50,6 +50,7 @@ namespace djv
             _ctor();
             _path();
             _sequences();
+            _fileNameTemplate();
             _util();
             _operators();
             _serialize();
@@ -234,6 +235,52 @@ namespace djv
             }
         }
 
+        void FileInfoTest::_fileNameTemplate()
+        {
+            {
+                const FileSystem::FileNameTemplate fileNameTemplate;
+                DJV_ASSERT(fileNameTemplate.get().empty());
+            }
+            
+            {
+                FileSystem::FileInfo fileInfo("/tmp/render.0001-0100.exr");
+                fileInfo.evalSequence();
+                for (const bool path : { true, false })
+                {
+                    const auto fileNameTemplate = fileInfo.getFileNameTemplate(path);
+                    for (const auto frame : { Frame::invalid, 1, 10, 100, 10000, -1, -10 })
+                    {
+                        DJV_ASSERT(fileInfo.getFileName(frame, path) == fileNameTemplate.get(frame));
+                    }
+                }
+                std::string buffer;
+                const auto fileNameTemplate = fileInfo.getFileNameTemplate();
+                DJV_ASSERT("/tmp/render.0010.exr" == fileNameTemplate.format(10, buffer));
+                DJV_ASSERT("/tmp/render.-0010.exr" == fileNameTemplate.format(-10, buffer));
+
+                const std::vector<Frame::Number> frames = { 1, 2, 3 };
+                std::vector<std::string> fileNames = { "a", "b", "c", "d" };
+                fileNameTemplate.get(frames, fileNames);
+                DJV_ASSERT(3 == fileNames.size());
+                DJV_ASSERT("/tmp/render.0001.exr" == fileNames[0]);
+                DJV_ASSERT("/tmp/render.0002.exr" == fileNames[1]);
+                DJV_ASSERT("/tmp/render.0003.exr" == fileNames[2]);
+            }
+            
+            {
+                const FileSystem::FileInfo fileInfo("/tmp/render.1.exr");
+                const auto fileNameTemplate = fileInfo.getFileNameTemplate();
+                DJV_ASSERT(fileInfo.getFileName() == fileNameTemplate.get());
+                DJV_ASSERT(fileInfo.getFileName(10) == fileNameTemplate.get(10));
+            }
+            
+            {
+                const std::string root(1, FileSystem::Path::getCurrentSeparator());
+                const FileSystem::FileInfo fileInfo(root);
+                DJV_ASSERT(root == fileInfo.getFileNameTemplate().get());
+            }
+        }
+
         void FileInfoTest::_util()
         {
             {
@@ -56,8 +56,8 @@ namespace djv
         {
             {
                 const Frame::Sequence sequence;
-                DJV_ASSERT(0 == sequence.ranges.size());
-                DJV_ASSERT(0 == sequence.pad);
+                DJV_ASSERT(0 == sequence.getRanges().size());
+                DJV_ASSERT(0 == sequence.getPad());
                 DJV_ASSERT(!sequence.isValid());
                 DJV_ASSERT(!sequence.contains(0));
                 DJV_ASSERT(0 == sequence.getSize());
@@ -67,8 +67,8 @@ namespace djv
             
             {
                 const Frame::Sequence sequence(Frame::Range(0, 99), 4);
-                DJV_ASSERT(1 == sequence.ranges.size());
-                DJV_ASSERT(4 == sequence.pad);
+                DJV_ASSERT(1 == sequence.getRanges().size());
+                DJV_ASSERT(4 == sequence.getPad());
                 DJV_ASSERT(sequence.isValid());
                 DJV_ASSERT(sequence.contains(0));
                 DJV_ASSERT(100 == sequence.getSize());
@@ -78,8 +78,8 @@ namespace djv
             
             {
                 const Frame::Sequence sequence({ Frame::Range(0, 9), Frame::Range(10, 99) }, 4);
-                DJV_ASSERT(2 == sequence.ranges.size());
-                DJV_ASSERT(4 == sequence.pad);
+                DJV_ASSERT(2 == sequence.getRanges().size());
+                DJV_ASSERT(4 == sequence.getPad());
                 DJV_ASSERT(sequence.isValid());
                 DJV_ASSERT(sequence.contains(0));
                 DJV_ASSERT(100 == sequence.getSize());
@@ -90,16 +90,55 @@ namespace djv
             {
                 Frame::Sequence sequence({ Frame::Range(10, 9), Frame::Range(3, 1) });
                 sequence.sort();
-                DJV_ASSERT(sequence.ranges[0] == Frame::Range(1, 3));
-                DJV_ASSERT(sequence.ranges[1] == Frame::Range(9, 10));
+                DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 3));
+                DJV_ASSERT(sequence.getRanges()[1] == Frame::Range(9, 10));
+            }
+            
+            {
+                Frame::Sequence sequence;
+                sequence.add(Frame::Range(1, 3));
+                sequence.add(Frame::Range(5));
+                sequence.add(Frame::Range(10, 12));
+                DJV_ASSERT(7 == sequence.getSize());
+                DJV_ASSERT(1 == sequence.getFrame(0));
+                DJV_ASSERT(5 == sequence.getFrame(3));
+                DJV_ASSERT(12 == sequence.getFrame(6));
+                DJV_ASSERT(Frame::invalid == sequence.getFrame(7));
+                DJV_ASSERT(Frame::invalid == sequence.getFrame(-1));
+                DJV_ASSERT(3 == sequence.getIndex(5));
+                DJV_ASSERT(5 == sequence.getIndex(11));
+                DJV_ASSERT(Frame::invalidIndex == sequence.getIndex(4));
+                DJV_ASSERT(Frame::invalidIndex == sequence.getIndex(13));
+                DJV_ASSERT(sequence.contains(10));
+                DJV_ASSERT(!sequence.contains(9));
+            }
+
+            {
+                Frame::Sequence sequence;
+                sequence.setRanges({ Frame::Range(1, 3), Frame::Range(10, 12) });
+                DJV_ASSERT(2 == sequence.getRanges().size());
+                DJV_ASSERT(6 == sequence.getSize());
+                DJV_ASSERT(10 == sequence.getFrame(3));
+                DJV_ASSERT(4 == sequence.getIndex(11));
+                sequence.setRanges({ Frame::Range(5) });
+                DJV_ASSERT(1 == sequence.getSize());
+                DJV_ASSERT(5 == sequence.getFrame(0));
+            }
+
+            {
+                const Frame::Sequence sequence({ Frame::Range(10, 12), Frame::Range(1, 3) });
+                DJV_ASSERT(10 == sequence.getFrame(0));
+                DJV_ASSERT(1 == sequence.getFrame(3));
+                DJV_ASSERT(0 == sequence.getIndex(10));
+                DJV_ASSERT(5 == sequence.getIndex(3));
             }
             
             {
                 Frame::Sequence sequence(Frame::Range(1, 3));
                 sequence.merge(Frame::Range(3, 10));
-                DJV_ASSERT(sequence.ranges[0] == Frame::Range(1, 10));
+                DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 10));
                 sequence.merge(Frame::Range(12, 100));
-                DJV_ASSERT(sequence.ranges[0] == Frame::Range(1, 10));
+                DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 10));
             }
         }
         
@@ -129,7 +168,7 @@ namespace djv
                     ss << sequence;
                     _print(ss.str());
                 }
-                DJV_ASSERT(0 == sequence.ranges.size());
+                DJV_ASSERT(0 == sequence.getRanges().size());
             }
             
             {
@@ -140,9 +179,9 @@ namespace djv
                     ss << sequence;
                     _print(ss.str());
                 }
-                DJV_ASSERT(1 == sequence.ranges.size());
-                DJV_ASSERT(1 == sequence.ranges[0].min);
-                DJV_ASSERT(1 == sequence.ranges[0].max);
+                DJV_ASSERT(1 == sequence.getRanges().size());
+                DJV_ASSERT(1 == sequence.getRanges()[0].min);
+                DJV_ASSERT(1 == sequence.getRanges()[0].max);
             }
             
             {
@@ -153,9 +192,9 @@ namespace djv
                     ss << sequence;
                     _print(ss.str());
                 }
-                DJV_ASSERT(1 == sequence.ranges.size());
-                DJV_ASSERT(1 == sequence.ranges[0].min);
-                DJV_ASSERT(3 == sequence.ranges[0].max);
+                DJV_ASSERT(1 == sequence.getRanges().size());
+                DJV_ASSERT(1 == sequence.getRanges()[0].min);
+                DJV_ASSERT(3 == sequence.getRanges()[0].max);
             }
             
             {
@@ -166,11 +205,11 @@ namespace djv
                     ss << sequence;
                     _print(ss.str());
                 }
-                DJV_ASSERT(2 == sequence.ranges.size());
-                DJV_ASSERT(1 == sequence.ranges[0].min);
-                DJV_ASSERT(1 == sequence.ranges[0].max);
-                DJV_ASSERT(3 == sequence.ranges[1].min);
-                DJV_ASSERT(3 == sequence.ranges[1].max);
+                DJV_ASSERT(2 == sequence.getRanges().size());
+                DJV_ASSERT(1 == sequence.getRanges()[0].min);
+                DJV_ASSERT(1 == sequence.getRanges()[0].max);
+                DJV_ASSERT(3 == sequence.getRanges()[1].min);
+                DJV_ASSERT(3 == sequence.getRanges()[1].max);
             }
             
             {
@@ -181,13 +220,13 @@ namespace djv
                     ss << sequence;
                     _print(ss.str());
                 }
-                DJV_ASSERT(3 == sequence.ranges.size());
-                DJV_ASSERT(1 == sequence.ranges[0].min);
-                DJV_ASSERT(3 == sequence.ranges[0].max);
-                DJV_ASSERT(5 == sequence.ranges[1].min);
-                DJV_ASSERT(6 == sequence.ranges[1].max);
-                DJV_ASSERT(8 == sequence.ranges[2].min);
-                DJV_ASSERT(8 == sequence.ranges[2].max);
+                DJV_ASSERT(3 == sequence.getRanges().size());
+                DJV_ASSERT(1 == sequence.getRanges()[0].min);
+                DJV_ASSERT(3 == sequence.getRanges()[0].max);
+                DJV_ASSERT(5 == sequence.getRanges()[1].min);
+                DJV_ASSERT(6 == sequence.getRanges()[1].max);
+                DJV_ASSERT(8 == sequence.getRanges()[2].min);
+                DJV_ASSERT(8 == sequence.getRanges()[2].max);
             }
             
             {
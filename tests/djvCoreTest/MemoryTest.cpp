@@ -30,6 +30,7 @@
 #include <djvCoreTest/MemoryTest.h>
 
 #include <djvCore/Memory.h>
+#include <djvCore/OS.h>
 
 #include <iostream>
 
@@ -49,6 +50,7 @@ namespace djv
             _enum();
             _endian();
             _hash();
+            _cacheBudget();
         }
         
         void MemoryTest::_label()
@@ -186,8 +188,73 @@ namespace djv
                 ss << "hash: " << hash;
                 _print(ss.str());
             }
+
+            DJV_ASSERT(14695981039346656037ULL == Memory::getStableHash(std::string()));
+            DJV_ASSERT(0xaf63dc4c8601ec8cULL == Memory::getStableHash("a"));
+            DJV_ASSERT(Memory::getStableHash("a") != Memory::getStableHash("b"));
         }
         
+        void MemoryTest::_cacheBudget()
+        {
+            {
+                const Memory::CacheBudget budget;
+                DJV_ASSERT(0 == budget.getBudget());
+                DJV_ASSERT(0 == budget.getPressureCount());
+            }
+
+            {
+                Memory::CacheBudget budget;
+                budget.setRange(Memory::gigabyte, 12 * Memory::gigabyte);
+                DJV_ASSERT(Memory::gigabyte == budget.getMin());
+                DJV_ASSERT(12 * Memory::gigabyte == budget.getMax());
+                DJV_ASSERT(Memory::gigabyte == budget.getBudget());
+
+                // The budget starts at the available memory minus the reserve.
+                OS::MemoryInfo info;
+                info.total = 16 * Memory::gigabyte;
+                info.available = 8 * Memory::gigabyte;
+                DJV_ASSERT(budget.update(info, 0));
+                const size_t reserve = info.total / 10;
+                DJV_ASSERT(info.available - reserve == budget.getBudget());
+
+                // The budget grows gradually.
+                info.available = 10 * Memory::gigabyte;
+                const size_t prev = budget.getBudget();
+                DJV_ASSERT(budget.update(info, 0));
+                DJV_ASSERT(budget.getBudget() > prev);
+                DJV_ASSERT(budget.getBudget() < info.available - reserve);
+
+                // The budget shrinks right away.
+                info.available = 4 * Memory::gigabyte;
+                DJV_ASSERT(budget.update(info, 2 * Memory::gigabyte));
+                DJV_ASSERT(2 * Memory::gigabyte + info.available - reserve == budget.getBudget());
+
+                // Memory pressure releases part of the cache.
+                info.pressure = 20.F;
+                DJV_ASSERT(budget.update(info, 4 * Memory::gigabyte));
+                DJV_ASSERT(3 * Memory::gigabyte == budget.getBudget());
+                DJV_ASSERT(1 == budget.getPressureCount());
+                budget.update(info, 3 * Memory::gigabyte);
+                DJV_ASSERT(1 == budget.getPressureCount());
+                info.pressure = 0.F;
+                budget.update(info, 2 * Memory::gigabyte);
+
+                // Running low on memory is also pressure.
+                info.available = Memory::megabyte;
+                DJV_ASSERT(budget.update(info, 2 * Memory::gigabyte));
+                DJV_ASSERT(Memory::gigabyte == budget.getBudget());
+                DJV_ASSERT(2 == budget.getPressureCount());
+
+                // The budget is limited by the range.
+                info.available = 100 * Memory::gigabyte;
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    budget.update(info, 0);
+                }
+                DJV_ASSERT(12 * Memory::gigabyte == budget.getBudget());
+            }
+        }
+
     } // namespace CoreTest
 } // namespace djv
 
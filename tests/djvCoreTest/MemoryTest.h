@@ -47,6 +47,7 @@ namespace djv
             void _enum();
             void _endian();
             void _hash();
+            void _cacheBudget();
         };
         
     } // namespace CoreTest
@@ -69,6 +69,15 @@ namespace djv
                 ss << "RAM: " << OS::getRAMSize();
                 _print(ss.str());
             }
+
+            {
+                const auto info = OS::getMemoryInfo();
+                DJV_ASSERT(info.available <= info.total);
+                std::stringstream ss;
+                ss << "Memory: " << info.available << "/" << info.total << ", resident " <<
+                    info.resident << ", pressure " << info.pressure;
+                _print(ss.str());
+            }
             
             {
                 std::stringstream ss;
@@ -62,20 +62,28 @@
 
 #include <djvAVTest/AVSystemTest.h>
 #include <djvAVTest/AudioDataTest.h>
+#include <djvAVTest/AudioResamplerTest.h>
+#include <djvAVTest/AudioRingBufferTest.h>
 #include <djvAVTest/AudioTest.h>
+#include <djvAVTest/AudioWaveformTest.h>
 #include <djvAVTest/ColorTest.h>
 #include <djvAVTest/EnumTest.h>
 #include <djvAVTest/FontSystemTest.h>
 #include <djvAVTest/IOTest.h>
+#include <djvAVTest/ImageCompressTest.h>
 #include <djvAVTest/ImageConvertTest.h>
 #include <djvAVTest/ImageDataTest.h>
 #include <djvAVTest/ImageTest.h>
+#include <djvAVTest/ImageUtilTest.h>
 #include <djvAVTest/OCIOSystemTest.h>
 #include <djvAVTest/OCIOTest.h>
 #include <djvAVTest/PixelTest.h>
+#include <djvAVTest/PlaybackClockTest.h>
 #include <djvAVTest/Render2DTest.h>
 #include <djvAVTest/ThumbnailSystemTest.h>
+#include <djvAVTest/TiledImageTest.h>
 #include <djvAVTest/TagsTest.h>
+#include <djvAVTest/TextureAtlasTest.h>
 
 #include <djvUITest/EnumTest.h>
 #include <djvUITest/WidgetTest.h>
@@ -138,20 +146,28 @@ int main(int argc, char ** argv)
 
         tests.emplace_back(new AVTest::AVSystemTest(context));
         tests.emplace_back(new AVTest::AudioDataTest(context));
+        tests.emplace_back(new AVTest::AudioResamplerTest(context));
+        tests.emplace_back(new AVTest::AudioRingBufferTest(context));
         tests.emplace_back(new AVTest::AudioTest(context));
+        tests.emplace_back(new AVTest::AudioWaveformTest(context));
         tests.emplace_back(new AVTest::ColorTest(context));
         tests.emplace_back(new AVTest::EnumTest(context));
         tests.emplace_back(new AVTest::FontSystemTest(context));
         tests.emplace_back(new AVTest::IOTest(context));
+        tests.emplace_back(new AVTest::ImageCompressTest(context));
         tests.emplace_back(new AVTest::ImageConvertTest(context));
         tests.emplace_back(new AVTest::ImageDataTest(context));
         tests.emplace_back(new AVTest::ImageTest(context));
+        tests.emplace_back(new AVTest::ImageUtilTest(context));
         tests.emplace_back(new AVTest::OCIOSystemTest(context));
         tests.emplace_back(new AVTest::OCIOTest(context));
         tests.emplace_back(new AVTest::PixelTest(context));
+        tests.emplace_back(new AVTest::PlaybackClockTest(context));
         tests.emplace_back(new AVTest::Render2DTest(context));
         tests.emplace_back(new AVTest::ThumbnailSystemTest(context));
+        tests.emplace_back(new AVTest::TiledImageTest(context));
         tests.emplace_back(new AVTest::TagsTest(context));
+        tests.emplace_back(new AVTest::TextureAtlasTest(context));
 
         tests.emplace_back(new UITest::EnumTest(context));
         tests.emplace_back(new UITest::WidgetTest(context));